@@ -0,0 +1,522 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_ALT_LANDMARKS_HPP
+#define BOOST_GRAPH_ALT_LANDMARKS_HPP
+
+/*
+ * Landmark lower bounds for A* search (ALT: A*, landmarks and the triangle
+ * inequality; A. V. Goldberg and C. Harrelson, "Computing the shortest
+ * path: A* search meets graph theory", SODA 2005).
+ *
+ * For a landmark L, the triangle inequality gives
+ *   d(v, t) >= d(L, t) - d(L, v)  and  d(v, t) >= d(v, L) - d(t, L),
+ * and the heuristic is the largest of these bounds over all landmarks.
+ * The distances from every landmark (and, for directed graphs with
+ * in_edges(), to every landmark) are computed once with
+ * dijkstra_shortest_paths and stored as unsigned integers of type Storage,
+ * in units of scale(): the largest distance is rounded to the largest
+ * value of Storage but one, which marks the vertices out of reach.  The
+ * bounds are rounded down, so that the heuristic stays admissible, but
+ * rounding can make it inconsistent by less than scale(), and astar_search
+ * then examines some vertices more than once.  When the weights are
+ * integers and the distances fit in Storage, the scale is 1 and nothing is
+ * lost.
+ *
+ * The landmarks are chosen by one of two rules:
+ * - farthest_landmarks: each landmark is the vertex farthest from the ones
+ *   chosen so far (the first one, from a random vertex);
+ * - avoid_landmarks (Goldberg and Werneck, "Computing point-to-point
+ *   shortest paths from external memory", ALENEX 2005): grow a shortest
+ *   path tree from a random vertex r, weigh each vertex v by how much the
+ *   current bound underestimates d(r, v), and take a leaf of the heaviest
+ *   subtree that has no landmark yet.  This places the new landmark behind
+ *   the region the current ones cover worst, and usually gives better
+ *   bounds than farthest_landmarks for the same number of landmarks.
+ */
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <boost/limits.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_unsigned.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/reverse_graph.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/astar_search.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  enum landmark_selection { farthest_landmarks, avoid_landmarks };
+
+  namespace detail {
+
+    // Records the vertices in the order Dijkstra's algorithm settles them,
+    // in which every vertex comes after its predecessor
+    template <typename Vertex>
+    struct alt_settle_order : public dijkstra_visitor<>
+    {
+      explicit alt_settle_order(std::vector<Vertex>& order) : order(&order) {}
+
+      template <typename Graph>
+      void examine_vertex(Vertex u, const Graph&) { order->push_back(u); }
+
+      std::vector<Vertex>* order;
+    };
+
+  } // namespace detail
+
+  // The A* heuristic of a set of landmarks for one target vertex: the
+  // largest bound given by the terms d(L, t) - d(L, u) of the landmarks in
+  // forward and d(u, L) - d(t, L) of those in reverse
+  template <typename Landmarks>
+  class alt_heuristic
+    : public astar_heuristic<typename Landmarks::graph_type,
+                             typename Landmarks::distance_type>
+  {
+  public:
+    typedef typename Landmarks::vertex_descriptor vertex_descriptor;
+    typedef typename Landmarks::distance_type distance_type;
+
+    alt_heuristic(const Landmarks& landmarks, vertex_descriptor t,
+                  const std::vector<std::size_t>& forward,
+                  const std::vector<std::size_t>& reverse)
+      : m_landmarks(&landmarks), m_target(landmarks.index_of(t)),
+        m_forward(forward), m_reverse(reverse) {}
+
+    distance_type operator()(vertex_descriptor u) const
+    {
+      return m_landmarks->index_lower_bound(m_landmarks->index_of(u),
+                                            m_target, m_forward, m_reverse);
+    }
+
+  private:
+    const Landmarks* m_landmarks;
+    std::size_t m_target;
+    std::vector<std::size_t> m_forward, m_reverse;
+  };
+
+  // Distance tables of a set of landmarks.  The tables take
+  // 2 * num_landmarks() * sizeof(Storage) bytes per vertex (half that for
+  // undirected graphs, and for directed graphs without in_edges(), for
+  // which only the distances from the landmarks are known), and do not
+  // refer to the graph once built.  The weights must be nonnegative.
+  template <typename Graph,
+            typename WeightMap =
+              typename property_map<Graph, edge_weight_t>::const_type,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type,
+            typename Storage = boost::uint32_t>
+  class alt_landmarks
+  {
+    typedef graph_traits<Graph> Traits;
+
+    BOOST_STATIC_ASSERT((is_unsigned<Storage>::value));
+
+    BOOST_STATIC_CONSTANT(bool, is_undirected =
+      (is_convertible<typename Traits::directed_category,
+                      undirected_tag>::value));
+    BOOST_STATIC_CONSTANT(bool, has_reverse = (!is_undirected &&
+      is_convertible<typename Traits::traversal_category,
+                     bidirectional_graph_tag>::value));
+
+  public:
+    typedef Graph graph_type;
+    typedef typename Traits::vertex_descriptor vertex_descriptor;
+    typedef typename property_traits<WeightMap>::value_type distance_type;
+    typedef Storage storage_type;
+    typedef alt_heuristic<alt_landmarks> heuristic_type;
+
+    alt_landmarks(const Graph& g, std::size_t num_landmarks,
+                  landmark_selection selection = avoid_landmarks)
+      : m_weight(get(edge_weight, g)), m_index(get(vertex_index, g))
+    { build(g, num_landmarks, selection, 1); }
+
+    alt_landmarks(const Graph& g, std::size_t num_landmarks,
+                  landmark_selection selection, WeightMap weight,
+                  VertexIndexMap index, unsigned int seed = 1)
+      : m_weight(weight), m_index(index)
+    { build(g, num_landmarks, selection, seed); }
+
+    // Uses the vertices in [first, last) as landmarks
+    template <typename InputIterator>
+    alt_landmarks(const Graph& g, InputIterator first, InputIterator last,
+                  WeightMap weight, VertexIndexMap index)
+      : m_weight(weight), m_index(index)
+    {
+      init(g);
+      for (; first != last; ++first)
+        add_landmark(g, get(m_index, *first));
+      quantize();
+    }
+
+    // The heuristic for searches towards t from any vertex, with all the
+    // landmarks.  It is consistent when every landmark can reach every
+    // vertex, as in a strongly connected graph.
+    heuristic_type heuristic(vertex_descriptor t) const
+    { return heuristic_type(*this, t, m_all, has_reverse ? m_all : m_none); }
+
+    // The heuristic for a search from s to t.  It only uses the terms of
+    // the landmarks that reach s and of those that t reaches, which keeps
+    // it consistent on the vertices s reaches, and of these the max_active
+    // that give the best bounds for s (A. V. Goldberg and C. Harrelson's
+    // active landmarks): fewer terms make the heuristic cheaper to
+    // evaluate, at the cost of weaker bounds away from s.
+    heuristic_type
+    heuristic(vertex_descriptor s, vertex_descriptor t,
+              std::size_t max_active = std::size_t(-1)) const
+    {
+      const Storage unreachable = (std::numeric_limits<Storage>::max)();
+      std::size_t si = get(m_index, s), ti = get(m_index, t);
+      // (bound at s, index of the landmark, reverse term)
+      typedef std::pair<boost::intmax_t, std::pair<std::size_t, bool> > term;
+      std::vector<term> terms;
+      for (std::size_t i = 0; i < m_landmarks.size(); ++i) {
+        // L reaches s, so it reaches every vertex s reaches
+        Storage fs = from_row(si)[i], ft = from_row(ti)[i];
+        if (fs != unreachable) {
+          boost::intmax_t bound = (std::numeric_limits<boost::intmax_t>::max)();
+          if (ft != unreachable) {
+            bound = boost::intmax_t(ft) - boost::intmax_t(fs);
+            if (is_undirected) bound = (std::max)(bound, -bound);
+          }
+          terms.push_back(term(bound, std::make_pair(i, false)));
+        }
+        // t reaches L, so every vertex that reaches t reaches L
+        if (has_reverse && to_row(ti)[i] != unreachable) {
+          Storage ts = to_row(si)[i], tt = to_row(ti)[i];
+          boost::intmax_t bound = (std::numeric_limits<boost::intmax_t>::max)();
+          if (ts != unreachable)
+            bound = boost::intmax_t(ts) - boost::intmax_t(tt);
+          terms.push_back(term(bound, std::make_pair(i, true)));
+        }
+      }
+      std::sort(terms.begin(), terms.end(), std::greater<term>());
+      if (terms.size() > max_active) terms.resize(max_active);
+      std::vector<std::size_t> forward, reverse;
+      for (std::size_t j = 0; j < terms.size(); ++j)
+        (terms[j].second.second ? reverse : forward)
+          .push_back(terms[j].second.first);
+      return heuristic_type(*this, t, forward, reverse);
+    }
+
+    // A lower bound on the distance from u to t, with all the landmarks.
+    // When the tables show that u cannot reach t, the bound is the largest
+    // distance in the tables: the vertices that cannot reach t then keep
+    // their order by distance from the source in astar_search, which an
+    // infinite bound would lose, and the heuristic stays consistent since
+    // no edge leads from them to a vertex that can reach t.  The sum of
+    // that distance and any distance from the source must fit in
+    // distance_type.
+    distance_type lower_bound(vertex_descriptor u, vertex_descriptor t) const
+    {
+      return index_lower_bound(get(m_index, u), get(m_index, t), m_all,
+                               has_reverse ? m_all : m_none);
+    }
+
+    const std::vector<vertex_descriptor>& landmarks() const
+    { return m_landmarks; }
+
+    std::size_t num_landmarks() const { return m_landmarks.size(); }
+
+    // The distance one unit of Storage stands for
+    distance_type scale() const { return m_scale; }
+
+    std::size_t index_of(vertex_descriptor v) const { return get(m_index, v); }
+
+    distance_type
+    index_lower_bound(std::size_t u, std::size_t t,
+                      const std::vector<std::size_t>& forward,
+                      const std::vector<std::size_t>& reverse) const
+    {
+      const Storage unreachable = (std::numeric_limits<Storage>::max)();
+      boost::intmax_t best = 0;
+      if (!forward.empty()) {
+        const Storage* from_u = from_row(u);
+        const Storage* from_t = from_row(t);
+        for (std::size_t j = 0; j < forward.size(); ++j) {
+          std::size_t i = forward[j];
+          if (from_u[i] == unreachable) continue;
+          // L reaches u but not t, so neither does u
+          if (from_t[i] == unreachable) return m_beyond;
+          boost::intmax_t bound = boost::intmax_t(from_t[i])
+                                  - boost::intmax_t(from_u[i]);
+          if (is_undirected) bound = (std::max)(bound, -bound);
+          best = (std::max)(best, bound);
+        }
+      }
+      if (!reverse.empty()) {
+        const Storage* to_u = to_row(u);
+        const Storage* to_t = to_row(t);
+        for (std::size_t j = 0; j < reverse.size(); ++j) {
+          std::size_t i = reverse[j];
+          if (to_t[i] == unreachable) continue;
+          // t reaches L but u does not, so u does not reach t
+          if (to_u[i] == unreachable) return m_beyond;
+          best = (std::max)(best, boost::intmax_t(to_u[i])
+                                  - boost::intmax_t(to_t[i]));
+        }
+      }
+      // Both distances were rounded down, so their difference may be up to
+      // one unit too large
+      if (!m_exact) --best;
+      return best > 0 ? distance_type(best) * m_scale : distance_type();
+    }
+
+  private:
+    typedef std::vector<distance_type> distance_table;
+
+    const Storage* from_row(std::size_t v) const
+    { return &m_from[v * m_landmarks.size()]; }
+
+    const Storage* to_row(std::size_t v) const
+    { return &m_to[v * m_landmarks.size()]; }
+
+    void init(const Graph& g)
+    {
+      BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+      m_inf = (std::numeric_limits<distance_type>::max)();
+      m_vertices.resize(num_vertices(g));
+      typename Traits::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        m_vertices[get(m_index, *vi)] = *vi;
+    }
+
+    void build(const Graph& g, std::size_t num_landmarks,
+               landmark_selection selection, unsigned int seed)
+    {
+      init(g);
+      std::size_t n = m_vertices.size();
+      num_landmarks = (std::min)(num_landmarks, n);
+      minstd_rand gen(seed);
+      variate_generator<minstd_rand&, uniform_int<std::size_t> >
+        random_vertex(gen, uniform_int<std::size_t>(0, n == 0 ? 0 : n - 1));
+      m_is_landmark.assign(n, false);
+      while (m_landmarks.size() < num_landmarks) {
+        std::size_t r = random_vertex();
+        std::size_t l = selection == farthest_landmarks
+                          ? select_farthest(g, r) : select_avoid(g, r);
+        // Every vertex is covered: fall back on a vertex that is not a
+        // landmark yet
+        while (l == n || m_is_landmark[l]) l = random_vertex();
+        add_landmark(g, l);
+      }
+      quantize();
+    }
+
+    void add_landmark(const Graph& g, std::size_t l)
+    {
+      if (m_is_landmark.size() != m_vertices.size())
+        m_is_landmark.assign(m_vertices.size(), false);
+      m_is_landmark[l] = true;
+      m_landmarks.push_back(m_vertices[l]);
+      m_from_exact.push_back(distance_table());
+      distances(g, l, m_from_exact.back());
+      m_to_exact.push_back(distance_table());
+      distances_to(g, l, m_to_exact.back(), mpl::bool_<has_reverse>());
+    }
+
+    template <typename G, typename Weight>
+    void distances(const G& g, std::size_t s, Weight weight,
+                   distance_table& d, vertex_descriptor* predecessor = 0,
+                   std::vector<vertex_descriptor>* order = 0) const
+    {
+      d.assign(m_vertices.size(), m_inf);
+      std::vector<vertex_descriptor> ignored;
+      detail::alt_settle_order<vertex_descriptor>
+        vis(order ? *order : ignored);
+      if (predecessor)
+        dijkstra_shortest_paths
+          (g, m_vertices[s],
+           weight_map(weight).vertex_index_map(m_index)
+             .distance_map(make_iterator_property_map(d.begin(), m_index))
+             .predecessor_map(make_iterator_property_map(predecessor,
+                                                         m_index))
+             .visitor(vis));
+      else
+        dijkstra_shortest_paths
+          (g, m_vertices[s],
+           weight_map(weight).vertex_index_map(m_index)
+             .distance_map(make_iterator_property_map(d.begin(), m_index)));
+    }
+
+    void distances(const Graph& g, std::size_t s, distance_table& d) const
+    { distances(g, s, m_weight, d); }
+
+    void distances_to(const Graph& g, std::size_t s, distance_table& d,
+                      mpl::true_) const
+    {
+      distances(make_reverse_graph(g), s,
+                detail::reverse_graph_edge_property_map<WeightMap>(m_weight),
+                d);
+    }
+
+    void distances_to(const Graph&, std::size_t, distance_table&,
+                      mpl::false_) const {}
+
+    // Bound on d(u, t) from the exact tables of the landmarks so far
+    double exact_lower_bound(std::size_t u, std::size_t t) const
+    {
+      double best = 0;
+      for (std::size_t i = 0; i < m_from_exact.size(); ++i) {
+        const distance_table& from = m_from_exact[i];
+        const distance_table& to =
+          is_undirected ? m_from_exact[i] : m_to_exact[i];
+        if (from[u] != m_inf && from[t] != m_inf)
+          best = (std::max)(best, double(from[t]) - double(from[u]));
+        if ((is_undirected || has_reverse) && to[u] != m_inf && to[t] != m_inf)
+          best = (std::max)(best, double(to[u]) - double(to[t]));
+      }
+      return best;
+    }
+
+    // The vertex farthest from the landmarks so far, or from r for the
+    // first one; only vertices reachable from them count
+    std::size_t select_farthest(const Graph& g, std::size_t r) const
+    {
+      std::size_t n = m_vertices.size();
+      distance_table nearest;
+      if (m_landmarks.empty()) distances(g, r, nearest);
+      else {
+        nearest.assign(n, m_inf);
+        for (std::size_t i = 0; i < m_from_exact.size(); ++i)
+          for (std::size_t v = 0; v < n; ++v)
+            if (m_from_exact[i][v] != m_inf)
+              nearest[v] = nearest[v] == m_inf
+                             ? m_from_exact[i][v]
+                             : (std::min)(nearest[v], m_from_exact[i][v]);
+      }
+      std::size_t best = n;
+      for (std::size_t v = 0; v < n; ++v)
+        if (nearest[v] != m_inf && !m_is_landmark[v]
+            && (best == n || nearest[best] < nearest[v]))
+          best = v;
+      return best;
+    }
+
+    // A leaf of the subtree of the shortest path tree from r whose vertices
+    // have the worst bounds in total, among those without a landmark
+    std::size_t select_avoid(const Graph& g, std::size_t r) const
+    {
+      std::size_t n = m_vertices.size();
+      distance_table d;
+      std::vector<vertex_descriptor> predecessor(n), order;
+      distances(g, r, m_weight, d, &predecessor[0], &order);
+
+      std::vector<double> size(n, 0.);
+      std::vector<bool> has_landmark(n, false);
+      std::vector<std::size_t> heaviest_child(n, n);
+      for (std::size_t i = order.size(); i-- > 0; ) {
+        std::size_t v = get(m_index, order[i]);
+        if (m_is_landmark[v]) has_landmark[v] = true;
+        if (has_landmark[v]) size[v] = 0;
+        else size[v] += double(d[v]) - exact_lower_bound(r, v);
+        std::size_t p = get(m_index, predecessor[v]);
+        if (p == v) continue;
+        if (has_landmark[v]) has_landmark[p] = true;
+        size[p] += size[v];
+        if (heaviest_child[p] == n || size[heaviest_child[p]] < size[v])
+          heaviest_child[p] = v;
+      }
+
+      std::size_t w = n;
+      for (std::size_t i = 0; i < order.size(); ++i) {
+        std::size_t v = get(m_index, order[i]);
+        if (size[v] > 0 && (w == n || size[w] < size[v])) w = v;
+      }
+      if (w == n) return n;
+      while (heaviest_child[w] != n && size[heaviest_child[w]] > 0)
+        w = heaviest_child[w];
+      return w;
+    }
+
+    // Rounds the exact tables to units of m_scale, and lays them out by
+    // vertex so that a bound reads two contiguous rows
+    void quantize()
+    {
+      const Storage unreachable = (std::numeric_limits<Storage>::max)();
+      std::size_t n = m_vertices.size(), k = m_landmarks.size();
+      distance_type largest = distance_type();
+      for (std::size_t i = 0; i < k; ++i)
+        for (std::size_t v = 0; v < n; ++v) {
+          if (m_from_exact[i][v] != m_inf)
+            largest = (std::max)(largest, m_from_exact[i][v]);
+          if (has_reverse && m_to_exact[i][v] != m_inf)
+            largest = (std::max)(largest, m_to_exact[i][v]);
+        }
+      set_scale(largest, Storage(unreachable - 1),
+                mpl::bool_<is_integral<distance_type>::value>());
+      m_beyond = distance_type(round_down(largest)) * m_scale;
+
+      m_from.assign(n * k, unreachable);
+      if (has_reverse) m_to.assign(n * k, unreachable);
+      for (std::size_t i = 0; i < k; ++i)
+        for (std::size_t v = 0; v < n; ++v) {
+          if (m_from_exact[i][v] != m_inf)
+            m_from[v * k + i] = round_down(m_from_exact[i][v]);
+          if (has_reverse && m_to_exact[i][v] != m_inf)
+            m_to[v * k + i] = round_down(m_to_exact[i][v]);
+        }
+      std::vector<distance_table>().swap(m_from_exact);
+      std::vector<distance_table>().swap(m_to_exact);
+      std::vector<bool>().swap(m_is_landmark);
+      m_all.resize(k);
+      for (std::size_t i = 0; i < k; ++i) m_all[i] = i;
+    }
+
+    void set_scale(distance_type largest, Storage top, mpl::true_)
+    {
+      m_scale = distance_type(largest / top);
+      if (m_scale * top < largest) ++m_scale;
+      if (m_scale == distance_type()) m_scale = distance_type(1);
+      m_exact = m_scale == distance_type(1);
+    }
+
+    void set_scale(distance_type largest, Storage top, mpl::false_)
+    {
+      m_scale = largest > distance_type() ? largest / top : distance_type(1);
+      m_exact = false;
+    }
+
+    Storage round_down(distance_type d) const
+    {
+      const Storage top = (std::numeric_limits<Storage>::max)() - 1;
+      distance_type q = d / m_scale;
+      return q >= distance_type(top) ? top : Storage(std::floor(double(q)));
+    }
+
+    WeightMap m_weight;
+    VertexIndexMap m_index;
+    distance_type m_inf;
+    distance_type m_scale;
+    distance_type m_beyond;
+    bool m_exact;
+    std::vector<vertex_descriptor> m_vertices;
+    std::vector<vertex_descriptor> m_landmarks;
+    std::vector<Storage> m_from, m_to;
+    std::vector<std::size_t> m_all, m_none;
+
+    // Used while the landmarks are being chosen
+    std::vector<bool> m_is_landmark;
+    std::vector<distance_table> m_from_exact, m_to_exact;
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_ALT_LANDMARKS_HPP
@@ -0,0 +1,510 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_APPROXIMATE_BETWEENNESS_CENTRALITY_HPP
+#define BOOST_GRAPH_APPROXIMATE_BETWEENNESS_CENTRALITY_HPP
+
+/*
+ * Approximate betweenness centrality by sampling.
+ *
+ * Each sample runs one single-source search of Brandes' algorithm and
+ * turns it into a value in [0, 1] for every vertex (and edge) whose mean
+ * is its betweenness divided by the number of ordered pairs of vertices:
+ *
+ *  - source_sampling: the dependencies on a random source, divided by
+ *    n - 1 (Brandes and Pich; Bader et al.);
+ *  - path_sampling: whether the vertex is inside a shortest path drawn
+ *    uniformly between a random pair of vertices (Riondato and
+ *    Kornaropoulos).
+ *
+ * Sampling stops as soon as empirical Bernstein bounds show that every
+ * mean is within epsilon of its expectation, checked at geometrically
+ * spaced sample counts, and at the latest after the number of samples that
+ * guarantees this a priori (Hoeffding's bound for source sampling, the
+ * VC-dimension bound of Riondato and Kornaropoulos for path sampling).
+ * Each of the two rules gets half of the failure probability delta.
+ */
+
+#include <stack>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/pending/disjoint_sets.hpp>
+#include <boost/pending/queue.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/limits.hpp>
+
+namespace boost {
+
+enum betweenness_sampling { source_sampling, path_sampling };
+
+namespace detail { namespace graph {
+
+  // Slots of the edges in the sample sums.  Without an edge centrality
+  // map there are none, and the edge index map is unused.
+  template<typename EdgeCentralityMap, typename EdgeIndexMap>
+  struct approximate_betweenness_edges
+  {
+    BOOST_STATIC_CONSTANT(bool, enabled = true);
+
+    template<typename Edge>
+    static std::size_t slot(EdgeIndexMap edge_index, const Edge& e)
+    { return get(edge_index, e); }
+
+    // One past the largest edge index, which need not be num_edges(g)
+    // once edges have been removed
+    template<typename Graph>
+    static std::size_t size(const Graph& g, EdgeIndexMap edge_index)
+    {
+      std::size_t m = 0;
+      typename graph_traits<Graph>::edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+        m = (std::max)(m, std::size_t(get(edge_index, *ei)) + 1);
+      return m;
+    }
+
+    template<typename Graph>
+    static void
+    store(const Graph& g, EdgeCentralityMap edge_centrality_map,
+          EdgeIndexMap edge_index, const std::vector<double>& sum,
+          double factor)
+    {
+      typedef typename property_traits<EdgeCentralityMap>::value_type
+        centrality_type;
+      typename graph_traits<Graph>::edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+        put(edge_centrality_map, *ei,
+            centrality_type(sum[get(edge_index, *ei)] * factor));
+    }
+  };
+
+  template<typename EdgeIndexMap>
+  struct approximate_betweenness_edges<dummy_property_map, EdgeIndexMap>
+  {
+    BOOST_STATIC_CONSTANT(bool, enabled = false);
+
+    template<typename Edge>
+    static std::size_t slot(EdgeIndexMap, const Edge&) { return 0; }
+
+    template<typename Graph>
+    static std::size_t size(const Graph&, EdgeIndexMap) { return 0; }
+
+    template<typename Graph>
+    static void
+    store(const Graph&, dummy_property_map, EdgeIndexMap,
+          const std::vector<double>&, double) { }
+  };
+
+  // Upper bound on the number of vertices of a shortest path: twice the
+  // eccentricity of any vertex plus one in each component of an
+  // unweighted undirected graph, the number of vertices of the largest
+  // weakly connected component otherwise
+  template<typename Graph, typename VertexIndexMap>
+  std::size_t
+  approximate_vertex_diameter(const Graph& g, VertexIndexMap vertex_index,
+                              bool unweighted)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename graph_traits<Graph>::vertex_iterator vertex_iterator;
+    typedef typename graph_traits<Graph>::out_edge_iterator out_edge_iterator;
+    typedef typename graph_traits<Graph>::directed_category directed_category;
+    const bool is_undirected =
+      is_convertible<directed_category*, undirected_tag*>::value;
+    std::size_t n = num_vertices(g), bound = 0;
+    vertex_iterator vi, vi_end;
+
+    if (is_undirected && unweighted) {
+      std::vector<std::size_t> level(n, (std::numeric_limits<std::size_t>::max)());
+      boost::queue<vertex_descriptor> Q;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        if (level[get(vertex_index, *vi)] != (std::numeric_limits<std::size_t>::max)())
+          continue;
+        std::size_t eccentricity = 0;
+        level[get(vertex_index, *vi)] = 0;
+        Q.push(*vi);
+        while (!Q.empty()) {
+          vertex_descriptor u = Q.top();
+          Q.pop();
+          std::size_t d = level[get(vertex_index, u)];
+          eccentricity = (std::max)(eccentricity, d);
+          out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei) {
+            std::size_t& t = level[get(vertex_index, target(*ei, g))];
+            if (t == (std::numeric_limits<std::size_t>::max)()) {
+              t = d + 1;
+              Q.push(target(*ei, g));
+            }
+          }
+        }
+        bound = (std::max)(bound, 2 * eccentricity + 1);
+      }
+      return (std::min)(bound, n);
+    }
+
+    std::vector<std::size_t> rank(n), parent(n), size(n, 0);
+    disjoint_sets<std::size_t*, std::size_t*> ds(&rank[0], &parent[0]);
+    for (std::size_t i = 0; i < n; ++i) ds.make_set(i);
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+      out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei)
+        ds.union_set(get(vertex_index, *vi),
+                     get(vertex_index, target(*ei, g)));
+    }
+    for (std::size_t i = 0; i < n; ++i)
+      bound = (std::max)(bound, ++size[ds.find_set(i)]);
+    return bound;
+  }
+
+  // Largest half-width, over the items, of the two-sided empirical
+  // Bernstein confidence intervals (Maurer and Pontil) of the means of k
+  // samples in [0, 1], with log_term = ln(4 / probability of failure)
+  inline double
+  max_bernstein_deviation(const std::vector<double>& sum,
+                          const std::vector<double>& sum_of_squares,
+                          std::size_t k, double log_term)
+  {
+    double worst = 7 * log_term / (3 * double(k - 1));
+    double base = worst;
+    for (std::size_t i = 0; i < sum.size(); ++i) {
+      double mean = sum[i] / double(k);
+      double variance = (sum_of_squares[i] - double(k) * mean * mean)
+                        / double(k - 1);
+      if (variance > 0)
+        worst = (std::max)(worst,
+                           std::sqrt(2 * variance * log_term / double(k))
+                           + base);
+    }
+    return worst;
+  }
+
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap,
+           typename ShortestPaths, typename RandomGenerator>
+  std::size_t
+  approximate_betweenness_centrality_impl
+    (const Graph& g,
+     CentralityMap centrality,
+     EdgeCentralityMap edge_centrality_map,
+     VertexIndexMap vertex_index,
+     EdgeIndexMap edge_index,
+     ShortestPaths shortest_paths,
+     bool unweighted,
+     betweenness_sampling method,
+     double epsilon,
+     double delta,
+     RandomGenerator& gen)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename graph_traits<Graph>::edge_descriptor edge_descriptor;
+    typedef typename graph_traits<Graph>::degree_size_type degree_size_type;
+    typedef typename mpl::if_c<(is_same<CentralityMap,
+                                        dummy_property_map>::value),
+                               EdgeCentralityMap,
+                               CentralityMap>::type a_centrality_map;
+    typedef typename property_traits<a_centrality_map>::value_type
+      centrality_type;
+    typedef approximate_betweenness_edges<EdgeCentralityMap, EdgeIndexMap>
+      edge_slots;
+
+    std::vector<vertex_descriptor> verts(vertices(g).first,
+                                         vertices(g).second);
+    std::size_t n = verts.size();
+    std::size_t m = edge_slots::size(g, edge_index);
+    std::vector<double> sum(n, 0.0), sum_of_squares(n, 0.0);
+    std::vector<double> edge_sum(m, 0.0), edge_sum_of_squares(m, 0.0);
+
+    // Number of samples after which the estimates are within epsilon with
+    // probability at least 1 - delta / 2, whatever the samples
+    double items = double(n + m);
+    std::size_t max_samples = 0;
+    if (n >= 2 && method == source_sampling) {
+      max_samples = std::size_t(std::ceil(std::log(4 * items / delta)
+                                          / (2 * epsilon * epsilon)));
+    } else if (n >= 2) {
+      // The VC dimension of the sets of shortest paths through one vertex
+      // is at most 1 + log2 of the number of inner vertices of a shortest
+      // path; a path has one edge more than inner vertices
+      std::size_t diameter =
+        approximate_vertex_diameter(g, vertex_index, unweighted);
+      std::size_t inner = edge_slots::enabled ? diameter - 1 : diameter - 2;
+      double dimension = 1;
+      if (diameter > 2 && inner > 1)
+        dimension += std::floor(std::log(double(inner)) / std::log(2.0));
+      max_samples = std::size_t(std::ceil(0.5 / (epsilon * epsilon)
+                                          * (dimension
+                                             + std::log(2 / delta))));
+    }
+
+    // With at least as many samples as vertices, using every source once
+    // is cheaper and exact
+    bool exact = method == source_sampling && max_samples >= n;
+    if (exact) max_samples = n;
+
+    std::vector<std::vector<edge_descriptor> > incoming_vec(n);
+    std::vector<double> distance_vec(n), dependency_vec(n);
+    std::vector<degree_size_type> path_count_vec(n, 0);
+    iterator_property_map<typename std::vector<std::vector<edge_descriptor> >::iterator,
+                          VertexIndexMap>
+      incoming(incoming_vec.begin(), vertex_index);
+    iterator_property_map<std::vector<double>::iterator, VertexIndexMap>
+      distance(distance_vec.begin(), vertex_index),
+      dependency(dependency_vec.begin(), vertex_index);
+    iterator_property_map<typename std::vector<degree_size_type>::iterator,
+                          VertexIndexMap>
+      path_count(path_count_vec.begin(), vertex_index);
+
+    typedef uniform_int<std::size_t> distrib_type;
+    variate_generator<RandomGenerator&, distrib_type>
+      random_index(gen, distrib_type(0, n == 0 ? 0 : n - 1));
+    std::stack<vertex_descriptor> ordered_vertices;
+
+    std::size_t k = 0, checkpoint = 0;
+    for (std::size_t round = 1; k < max_samples; ++round) {
+      // Adaptive stopping: round j may fail with probability delta / 2^(j+1)
+      double log_term = std::log(4 * items / delta) + (round + 1) * std::log(2.0);
+      if (round == 1)
+        checkpoint = std::size_t(std::ceil(1 + 7 * log_term / (3 * epsilon)));
+      else
+        checkpoint *= 2;
+      if (exact) checkpoint = n;
+      std::size_t target = (std::min)(checkpoint, max_samples);
+
+      for (; k < target; ++k) {
+        vertex_descriptor s = verts[exact ? k : random_index()];
+        put(path_count, s, 1);
+        shortest_paths(g, s, ordered_vertices, incoming, distance,
+                       path_count, vertex_index);
+
+        if (method == source_sampling) {
+          while (!ordered_vertices.empty()) {
+            vertex_descriptor w = ordered_vertices.top();
+            ordered_vertices.pop();
+            for (typename std::vector<edge_descriptor>::iterator
+                   vw = incoming[w].begin(); vw != incoming[w].end(); ++vw) {
+              vertex_descriptor v = source(*vw, g);
+              double factor = double(get(path_count, v))
+                              / double(get(path_count, w));
+              factor *= 1 + get(dependency, w);
+              put(dependency, v, get(dependency, v) + factor);
+              if (edge_slots::enabled) {
+                double x = factor / double(n - 1);
+                std::size_t i = edge_slots::slot(edge_index, *vw);
+                edge_sum[i] += x;
+                edge_sum_of_squares[i] += x * x;
+              }
+            }
+            if (w != s) {
+              double x = get(dependency, w) / double(n - 1);
+              sum[get(vertex_index, w)] += x;
+              sum_of_squares[get(vertex_index, w)] += x * x;
+            }
+            incoming[w].clear();
+            put(path_count, w, 0);
+            put(dependency, w, 0.0);
+          }
+        } else {
+          // Draw a shortest path to a random target t != s backwards,
+          // taking each incoming edge with probability proportional to the
+          // number of shortest paths through it
+          vertex_descriptor t = s;
+          while (t == s) t = verts[random_index()];
+          if (get(path_count, t) != 0) {
+            vertex_descriptor w = t;
+            while (w != s) {
+              typedef uniform_int<degree_size_type> path_distrib_type;
+              variate_generator<RandomGenerator&, path_distrib_type>
+                random_path(gen, path_distrib_type(0, get(path_count, w) - 1));
+              degree_size_type r = random_path();
+              typename std::vector<edge_descriptor>::iterator
+                vw = incoming[w].begin();
+              while (r >= get(path_count, source(*vw, g))) {
+                r -= get(path_count, source(*vw, g));
+                ++vw;
+              }
+              vertex_descriptor v = source(*vw, g);
+              if (edge_slots::enabled) {
+                std::size_t i = edge_slots::slot(edge_index, *vw);
+                edge_sum[i] += 1;
+                edge_sum_of_squares[i] += 1;
+              }
+              if (v != s) {
+                sum[get(vertex_index, v)] += 1;
+                sum_of_squares[get(vertex_index, v)] += 1;
+              }
+              w = v;
+            }
+          }
+          while (!ordered_vertices.empty()) {
+            vertex_descriptor w = ordered_vertices.top();
+            ordered_vertices.pop();
+            incoming[w].clear();
+            put(path_count, w, 0);
+          }
+        }
+      }
+
+      if (exact || k >= max_samples) break;
+      if ((std::max)(max_bernstein_deviation(sum, sum_of_squares, k, log_term),
+                     max_bernstein_deviation(edge_sum, edge_sum_of_squares, k,
+                                             log_term)) <= epsilon)
+        break;
+    }
+
+    // Scale the means back to sums over the pairs of vertices
+    typedef typename graph_traits<Graph>::directed_category directed_category;
+    const bool is_undirected =
+      is_convertible<directed_category*, undirected_tag*>::value;
+    double factor = k == 0 ? 0.0
+      : double(n) * double(n - 1) / double(k) / (is_undirected ? 2 : 1);
+    for (std::size_t i = 0; i < n; ++i)
+      put(centrality, verts[i],
+          centrality_type(sum[get(vertex_index, verts[i])] * factor));
+    edge_slots::store(g, edge_centrality_map, edge_index, edge_sum, factor);
+    return k;
+  }
+
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap, typename WeightMap,
+           typename RandomGenerator>
+  std::size_t
+  approximate_betweenness_centrality_dispatch2
+    (const Graph& g, CentralityMap centrality,
+     EdgeCentralityMap edge_centrality_map, VertexIndexMap vertex_index,
+     EdgeIndexMap edge_index, WeightMap weight_map,
+     betweenness_sampling method, double epsilon, double delta,
+     RandomGenerator& gen)
+  {
+    return approximate_betweenness_centrality_impl
+      (g, centrality, edge_centrality_map, vertex_index, edge_index,
+       brandes_dijkstra_shortest_paths<WeightMap>(weight_map), false,
+       method, epsilon, delta, gen);
+  }
+
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap,
+           typename RandomGenerator>
+  std::size_t
+  approximate_betweenness_centrality_dispatch2
+    (const Graph& g, CentralityMap centrality,
+     EdgeCentralityMap edge_centrality_map, VertexIndexMap vertex_index,
+     EdgeIndexMap edge_index, param_not_found,
+     betweenness_sampling method, double epsilon, double delta,
+     RandomGenerator& gen)
+  {
+    return approximate_betweenness_centrality_impl
+      (g, centrality, edge_centrality_map, vertex_index, edge_index,
+       brandes_unweighted_shortest_paths(), true,
+       method, epsilon, delta, gen);
+  }
+
+  // The edge index map is looked up only when there is an edge centrality
+  // map, so that graphs without edge indices can compute vertex centrality
+  template<typename EdgeCentralityMap>
+  struct approximate_betweenness_centrality_dispatch1
+  {
+    template<typename Graph, typename CentralityMap, typename VertexIndexMap,
+             typename RandomGenerator, typename Params>
+    static std::size_t
+    run(const Graph& g, CentralityMap centrality,
+        EdgeCentralityMap edge_centrality_map, VertexIndexMap vertex_index,
+        betweenness_sampling method, double epsilon, double delta,
+        RandomGenerator& gen, const Params& params)
+    {
+      return approximate_betweenness_centrality_dispatch2
+        (g, centrality, edge_centrality_map, vertex_index,
+         choose_const_pmap(get_param(params, edge_index), g, edge_index),
+         get_param(params, edge_weight), method, epsilon, delta, gen);
+    }
+  };
+
+  template<>
+  struct approximate_betweenness_centrality_dispatch1<param_not_found>
+  {
+    template<typename Graph, typename CentralityMap, typename VertexIndexMap,
+             typename RandomGenerator, typename Params>
+    static std::size_t
+    run(const Graph& g, CentralityMap centrality, param_not_found,
+        VertexIndexMap vertex_index, betweenness_sampling method,
+        double epsilon, double delta, RandomGenerator& gen,
+        const Params& params)
+    {
+      return approximate_betweenness_centrality_dispatch2
+        (g, centrality, dummy_property_map(), vertex_index,
+         dummy_property_map(), get_param(params, edge_weight),
+         method, epsilon, delta, gen);
+    }
+  };
+
+} } // end namespace detail::graph
+
+// Estimates the centralities computed by brandes_betweenness_centrality so
+// that, with probability at least 1 - delta, every estimate is within
+// epsilon times the number of ordered pairs of vertices (unordered pairs
+// for undirected graphs) of the exact value.  Returns the number of
+// samples drawn.  Named parameters: centrality_map, edge_centrality_map,
+// weight_map, vertex_index_map and edge_index_map.
+template<typename Graph, typename RandomGenerator,
+         typename Param, typename Tag, typename Rest>
+std::size_t
+approximate_betweenness_centrality
+  (const Graph& g, betweenness_sampling method, double epsilon,
+   double delta, RandomGenerator& gen,
+   const bgl_named_params<Param,Tag,Rest>& params
+   BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph,vertex_list_graph_tag))
+{
+  typedef bgl_named_params<Param,Tag,Rest> named_params;
+
+  typedef typename get_param_type<edge_centrality_t, named_params>::type ec;
+  return detail::graph::approximate_betweenness_centrality_dispatch1<ec>::run(
+    g,
+    choose_param(get_param(params, vertex_centrality),
+                 dummy_property_map()),
+    get_param(params, edge_centrality),
+    choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+    method, epsilon, delta, gen, params);
+}
+
+/**
+ * Function object that computes approximate edge centralities for
+ * betweenness_centrality_clustering.
+ */
+template<typename RandomGenerator>
+class approximate_edge_betweenness
+{
+ public:
+  approximate_edge_betweenness(betweenness_sampling method, double epsilon,
+                               double delta, RandomGenerator& gen)
+    : method(method), epsilon(epsilon), delta(delta), gen(&gen) {}
+
+  template<typename Graph, typename EdgeCentralityMap,
+           typename VertexIndexMap>
+  void operator()(const Graph& g, EdgeCentralityMap edge_centrality,
+                  VertexIndexMap vertex_index) const
+  {
+    approximate_betweenness_centrality
+      (g, method, epsilon, delta, *gen,
+       edge_centrality_map(edge_centrality).vertex_index_map(vertex_index));
+  }
+
+ private:
+  betweenness_sampling method;
+  double epsilon;
+  double delta;
+  RandomGenerator* gen;
+};
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_APPROXIMATE_BETWEENNESS_CENTRALITY_HPP
@@ -24,6 +24,7 @@
 #include <boost/graph/breadth_first_search.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/property_maps/constant_property_map.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/property_map/vector_property_map.hpp>
@@ -234,13 +235,15 @@ namespace boost {
 
 
 
+  // With the given queue, such as a d_ary_heap_indirect,
+  // radix_heap_indirect or dial_queue_indirect keyed on the cost map
   template <typename VertexListGraph, typename AStarHeuristic,
             typename AStarVisitor, typename PredecessorMap,
             typename CostMap, typename DistanceMap,
             typename WeightMap, typename ColorMap,
             typename VertexIndexMap,
             typename CompareFunction, typename CombineFunction,
-            typename CostInf, typename CostZero>
+            typename CostInf, typename CostZero, typename UpdatableQueue>
   inline void
   astar_search_no_init
     (const VertexListGraph &g,
@@ -248,20 +251,12 @@ namespace boost {
      AStarHeuristic h, AStarVisitor vis,
      PredecessorMap predecessor, CostMap cost,
      DistanceMap distance, WeightMap weight,
-     ColorMap color, VertexIndexMap index_map,
+     ColorMap color, VertexIndexMap /*index_map*/,
      CompareFunction compare, CombineFunction combine,
-     CostInf /*inf*/, CostZero zero)
+     CostInf /*inf*/, CostZero zero, UpdatableQueue& Q)
   {
-    typedef typename graph_traits<VertexListGraph>::vertex_descriptor
-      Vertex;
-    typedef boost::vector_property_map<std::size_t, VertexIndexMap> IndexInHeapMap;
-    IndexInHeapMap index_in_heap(index_map);
-    typedef d_ary_heap_indirect<Vertex, 4, IndexInHeapMap, CostMap, CompareFunction>
-      MutableQueue;
-    MutableQueue Q(cost, index_in_heap, compare);
-
     detail::astar_bfs_visitor<AStarHeuristic, AStarVisitor,
-        MutableQueue, PredecessorMap, CostMap, DistanceMap,
+        UpdatableQueue, PredecessorMap, CostMap, DistanceMap,
         WeightMap, ColorMap, CombineFunction, CompareFunction>
       bfs_vis(h, vis, Q, predecessor, cost, distance, weight,
               color, combine, compare, zero);
@@ -269,6 +264,42 @@ namespace boost {
     breadth_first_visit(g, s, Q, bfs_vis, color);
   }
 
+  template <typename VertexListGraph, typename AStarHeuristic,
+            typename AStarVisitor, typename PredecessorMap,
+            typename CostMap, typename DistanceMap,
+            typename WeightMap, typename ColorMap,
+            typename VertexIndexMap,
+            typename CompareFunction, typename CombineFunction,
+            typename CostInf, typename CostZero>
+  inline void
+  astar_search_no_init
+    (const VertexListGraph &g,
+     typename graph_traits<VertexListGraph>::vertex_descriptor s,
+     AStarHeuristic h, AStarVisitor vis,
+     PredecessorMap predecessor, CostMap cost,
+     DistanceMap distance, WeightMap weight,
+     ColorMap color, VertexIndexMap index_map,
+     CompareFunction compare, CombineFunction combine,
+     CostInf inf, CostZero zero)
+  {
+    // A radix heap for unsigned integer costs, a d-ary heap otherwise.  The
+    // radix heap stays correct, only slower, when an inconsistent heuristic
+    // makes the minimum cost decrease.
+    typedef typename property_traits<CostMap>::value_type Cost;
+    typedef detail::dijkstra_queue_generator<VertexListGraph, VertexIndexMap,
+      CostMap, CompareFunction,
+      typename detail::dijkstra_queue_kind<Cost, CompareFunction,
+                                           CombineFunction>::type>
+      QueueGenerator;
+    boost::scoped_array<std::size_t> index_in_heap_map_holder;
+    typename QueueGenerator::type Q =
+      QueueGenerator::build(g, index_map, cost, compare, weight,
+                            index_in_heap_map_holder);
+
+    astar_search_no_init(g, s, h, vis, predecessor, cost, distance, weight,
+                         color, index_map, compare, combine, inf, zero, Q);
+  }
+
   namespace graph_detail {
     template <typename A, typename B>
     struct select1st {
@@ -0,0 +1,112 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// One bit per vertex property map that can be updated by several threads at
+// once, like a concurrent two_bit_color_map with only two colors.
+
+#ifndef BOOST_GRAPH_ATOMIC_BIT_MAP_HPP
+#define BOOST_GRAPH_ATOMIC_BIT_MAP_HPP
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <atomic>
+#include <limits>
+#include <boost/property_map/property_map.hpp>
+#include <boost/shared_array.hpp>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+
+template<typename IndexMap = identity_property_map>
+struct atomic_bit_map
+{
+  typedef std::size_t word_type;
+
+  std::size_t n;
+  IndexMap index;
+  shared_array<std::atomic<word_type> > data;
+
+  BOOST_STATIC_CONSTANT(int, bits_per_word = std::numeric_limits<word_type>::digits);
+  typedef typename property_traits<IndexMap>::key_type key_type;
+  typedef bool value_type;
+  typedef void reference;
+  typedef read_write_property_map_tag category;
+
+  explicit atomic_bit_map(std::size_t n, const IndexMap& index = IndexMap())
+    : n(n), index(index), data(new std::atomic<word_type>[num_words(n)])
+  {
+    // Fill to false
+    for (std::size_t i = 0; i < num_words(n); ++i)
+      data[i].store(0, std::memory_order_relaxed);
+  }
+
+  static std::size_t num_words(std::size_t n)
+  { return (n + bits_per_word - 1) / bits_per_word; }
+};
+
+template<typename IndexMap>
+inline bool
+get(const atomic_bit_map<IndexMap>& pm,
+    typename property_traits<IndexMap>::key_type key)
+{
+  BOOST_STATIC_CONSTANT(int, bits_per_word = atomic_bit_map<IndexMap>::bits_per_word);
+  typename property_traits<IndexMap>::value_type i = get(pm.index, key);
+  BOOST_ASSERT ((std::size_t)i < pm.n);
+  return (pm.data[i / bits_per_word].load(std::memory_order_acquire)
+          >> (i % bits_per_word)) & 1;
+}
+
+template<typename IndexMap>
+inline void
+put(const atomic_bit_map<IndexMap>& pm,
+    typename property_traits<IndexMap>::key_type key,
+    bool value)
+{
+  typedef typename atomic_bit_map<IndexMap>::word_type word_type;
+  BOOST_STATIC_CONSTANT(int, bits_per_word = atomic_bit_map<IndexMap>::bits_per_word);
+  typename property_traits<IndexMap>::value_type i = get(pm.index, key);
+  BOOST_ASSERT ((std::size_t)i < pm.n);
+  word_type mask = word_type(1) << (i % bits_per_word);
+  if (value)
+    pm.data[i / bits_per_word].fetch_or(mask, std::memory_order_acq_rel);
+  else
+    pm.data[i / bits_per_word].fetch_and(~mask, std::memory_order_acq_rel);
+}
+
+// Set the bit of key and return true if this call changed it from false to
+// true.  When several threads race on the same key, exactly one of them
+// gets true.  The bit is read first so that keys that are already set cost
+// no atomic read-modify-write.
+template<typename IndexMap>
+inline bool
+test_and_set(const atomic_bit_map<IndexMap>& pm,
+             typename property_traits<IndexMap>::key_type key)
+{
+  typedef typename atomic_bit_map<IndexMap>::word_type word_type;
+  BOOST_STATIC_CONSTANT(int, bits_per_word = atomic_bit_map<IndexMap>::bits_per_word);
+  typename property_traits<IndexMap>::value_type i = get(pm.index, key);
+  BOOST_ASSERT ((std::size_t)i < pm.n);
+  std::atomic<word_type>& word = pm.data[i / bits_per_word];
+  word_type mask = word_type(1) << (i % bits_per_word);
+  if (word.load(std::memory_order_relaxed) & mask) return false;
+  return (word.fetch_or(mask, std::memory_order_acq_rel) & mask) == 0;
+}
+
+template<typename IndexMap>
+inline atomic_bit_map<IndexMap>
+make_atomic_bit_map(std::size_t n, const IndexMap& index_map)
+{
+  return atomic_bit_map<IndexMap>(n, index_map);
+}
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_ATOMIC_BIT_MAP_HPP
@@ -68,15 +68,34 @@ struct bc_clustering_threshold
   T dividend;
 };
 
+namespace detail { namespace graph {
+
+  /// Computes the exact edge centralities for @ref
+  /// betweenness_centrality_clustering
+  struct brandes_edge_betweenness
+  {
+    template<typename Graph, typename EdgeCentralityMap,
+             typename VertexIndexMap>
+    void operator()(const Graph& g, EdgeCentralityMap edge_centrality,
+                    VertexIndexMap vertex_index) const
+    {
+      brandes_betweenness_centrality(g,
+                                     edge_centrality_map(edge_centrality)
+                                     .vertex_index_map(vertex_index));
+    }
+  };
+
+} } // end namespace detail::graph
+
 /** Graph clustering based on edge betweenness centrality.
  * 
  * This algorithm implements graph clustering based on edge
  * betweenness centrality. It is an iterative algorithm, where in each
  * step it compute the edge betweenness centrality (via @ref
- * brandes_betweenness_centrality) and removes the edge with the
- * maximum betweenness centrality. The @p done function object
- * determines when the algorithm terminates (the edge found when the
- * algorithm terminates will not be removed).
+ * brandes_betweenness_centrality, or via @p compute_centrality) and
+ * removes the edge with the maximum betweenness centrality. The @p done
+ * function object determines when the algorithm terminates (the edge
+ * found when the algorithm terminates will not be removed).
  *
  * @param g The graph on which clustering will be performed. The type
  * of this parameter (@c MutableGraph) must be a model of the
@@ -102,13 +121,20 @@ struct bc_clustering_threshold
  * property map must model the ReadablePropertyMap concept and its
  * value type must be an integral type. Defaults to 
  * @c get(vertex_index, g).
+ *
+ * @param compute_centrality (IN) The function object that fills @p
+ * edge_centrality, called as @c compute_centrality(g, edge_centrality,
+ * vertex_index) before each removal. An @ref
+ * approximate_edge_betweenness makes the algorithm feasible on large
+ * graphs. Defaults to exact centralities.
  */
 template<typename MutableGraph, typename Done, typename EdgeCentralityMap,
-         typename VertexIndexMap>
+         typename VertexIndexMap, typename EdgeCentralityFunction>
 void 
 betweenness_centrality_clustering(MutableGraph& g, Done done,
                                   EdgeCentralityMap edge_centrality,
-                                  VertexIndexMap vertex_index)
+                                  VertexIndexMap vertex_index,
+                                  EdgeCentralityFunction compute_centrality)
 {
   typedef typename property_traits<EdgeCentralityMap>::value_type
     centrality_type;
@@ -123,9 +149,7 @@ betweenness_centrality_clustering(MutableGraph& g, Done done,
 
   bool is_done;
   do {
-    brandes_betweenness_centrality(g, 
-                                   edge_centrality_map(edge_centrality)
-                                   .vertex_index_map(vertex_index));
+    compute_centrality(g, edge_centrality, vertex_index);
     std::pair<edge_iterator, edge_iterator> edges_iters = edges(g);
     edge_descriptor e = *max_element(edges_iters.first, edges_iters.second, cmp);
     is_done = done(get(edge_centrality, e), e, g);
@@ -133,6 +157,20 @@ betweenness_centrality_clustering(MutableGraph& g, Done done,
   } while (!is_done && !has_no_edges(g));
 }
 
+/**
+ * \overload
+ */ 
+template<typename MutableGraph, typename Done, typename EdgeCentralityMap,
+         typename VertexIndexMap>
+void 
+betweenness_centrality_clustering(MutableGraph& g, Done done,
+                                  EdgeCentralityMap edge_centrality,
+                                  VertexIndexMap vertex_index)
+{
+  betweenness_centrality_clustering(g, done, edge_centrality, vertex_index,
+                                    detail::graph::brandes_edge_betweenness());
+}
+
 /**
  * \overload
  */ 
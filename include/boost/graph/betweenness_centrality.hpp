@@ -222,6 +222,8 @@ namespace detail { namespace graph {
 
       visitor_type<Graph, IncomingMap, DistanceMap, PathCountMap>
         visitor(incoming, distance, path_count, ov);
+      // The distance map may still hold the distances of the previous source
+      put(distance, s, 0);
       
       std::vector<default_color_type> 
         colors(num_vertices(g), color_traits<default_color_type>::white());
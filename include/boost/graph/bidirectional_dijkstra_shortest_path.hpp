@@ -0,0 +1,292 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
+#define BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
+
+/*
+ * Point-to-point shortest path by bidirectional Dijkstra search.
+ *
+ * A forward search from s on the out-edges and a backward search from t on
+ * the in-edges run alternately, each step advancing the search with the
+ * smaller queue.  Whenever an edge reaches a vertex labelled by the other
+ * search, the length of the s-t path through it is a candidate mu.  The
+ * searches stop as soon as the sum of the smallest keys of the two queues
+ * is not less than mu: every shorter path would have to go through a
+ * vertex still in both queues.
+ */
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <boost/limits.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/relax.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/search_workspace.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // Edges scanned by the forward (out-edges) and backward (in-edges)
+    // searches
+    template <typename Graph, bool Forward>
+    struct bidirectional_dijkstra_edges;
+
+    template <typename Graph>
+    struct bidirectional_dijkstra_edges<Graph, true>
+    {
+      typedef typename graph_traits<Graph>::out_edge_iterator edge_iterator;
+      static std::pair<edge_iterator, edge_iterator>
+      edges_of(typename graph_traits<Graph>::vertex_descriptor u,
+               const Graph& g)
+      { return out_edges(u, g); }
+    };
+
+    template <typename Graph>
+    struct bidirectional_dijkstra_edges<Graph, false>
+    {
+      typedef typename graph_traits<Graph>::in_edge_iterator edge_iterator;
+      static std::pair<edge_iterator, edge_iterator>
+      edges_of(typename graph_traits<Graph>::vertex_descriptor u,
+               const Graph& g)
+      { return in_edges(u, g); }
+    };
+
+    // One of the two searches: labels and predecessors in a
+    // search_workspace, and a queue over it, with out_edges(u, g) or
+    // in_edges(u, g) as the edges to scan
+    template <typename Graph, typename Workspace, typename Compare,
+              typename Combine, bool Forward>
+    struct bidirectional_dijkstra_search
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef typename Workspace::distance_type D;
+      typedef typename Workspace::distance_map_type DistanceMap;
+      typedef typename Workspace::predecessor_map_type PredecessorMap;
+      typedef typename dijkstra_workspace_queue<Vertex,
+        typename Workspace::index_in_heap_map_type, DistanceMap, Compare,
+        typename dijkstra_queue_kind<D, Compare, Combine>::type>::type Queue;
+
+      bidirectional_dijkstra_search(Workspace& workspace, Vertex start,
+                                    const Compare& compare, D zero)
+        : distance(workspace.distance_map()),
+          predecessor(workspace.predecessor_map()),
+          queue(distance, workspace.index_in_heap_map(), compare)
+      {
+        put(distance, start, zero);
+        put(predecessor, start, start);
+        queue.push(start);
+      }
+
+      template <typename Edge>
+      static Vertex next(Edge e, const Graph& g)
+      { return Forward ? target(e, g) : source(e, g); }
+
+      // Scan the vertex at the top of the queue, and lower mu to the length
+      // of the best path through the vertices it reaches that are labelled
+      // by the other search
+      template <typename WeightMap, typename Other>
+      void step(const Graph& g, WeightMap weight, const Other& other,
+                const Compare& compare, const Combine& combine, D inf, D zero,
+                D& mu, Vertex& meeting)
+      {
+        Vertex u = queue.top();
+        queue.pop();
+        D du = get(distance, u);
+        typedef bidirectional_dijkstra_edges<Graph, Forward> Edges;
+        std::pair<typename Edges::edge_iterator,
+                  typename Edges::edge_iterator> edges = Edges::edges_of(u, g);
+        for (; edges.first != edges.second; ++edges.first) {
+          Vertex v = next(*edges.first, g);
+          typename property_traits<WeightMap>::value_type w =
+            get(weight, *edges.first);
+          if (compare(combine(zero, w), zero))
+            boost::throw_exception(negative_edge());
+          D dv = get(distance, v);
+          D through_u = combine(du, w);
+          if (compare(through_u, dv)) {
+            put(distance, v, through_u);
+            put(predecessor, v, u);
+            if (dv == inf) queue.push(v);
+            else queue.update(v);
+            dv = through_u;
+          }
+          D other_dv = get(other.distance, v);
+          if (other_dv != inf && compare(combine(dv, other_dv), mu)) {
+            mu = combine(dv, other_dv);
+            meeting = v;
+          }
+        }
+      }
+
+      D top_distance() const { return get(distance, queue.top()); }
+
+      DistanceMap distance;
+      PredecessorMap predecessor;
+      Queue queue;
+    };
+
+    template <typename Graph, typename OutputIterator, typename WeightMap,
+              typename Workspace, typename Compare, typename Combine>
+    typename Workspace::distance_type
+    bidirectional_dijkstra_impl
+      (const Graph& g,
+       typename graph_traits<Graph>::vertex_descriptor s,
+       typename graph_traits<Graph>::vertex_descriptor t,
+       OutputIterator path, WeightMap weight,
+       Workspace& forward_workspace, Workspace& backward_workspace,
+       Compare compare, Combine combine,
+       typename Workspace::distance_type zero)
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef typename Workspace::distance_type D;
+      BOOST_ASSERT(&forward_workspace != &backward_workspace);
+
+      if (s == t) {
+        *path++ = s;
+        return zero;
+      }
+
+      forward_workspace.reset();
+      backward_workspace.reset();
+      D inf = forward_workspace.distance_inf();
+      bidirectional_dijkstra_search<Graph, Workspace, Compare, Combine, true>
+        forward(forward_workspace, s, compare, zero);
+      bidirectional_dijkstra_search<Graph, Workspace, Compare, Combine, false>
+        backward(backward_workspace, t, compare, zero);
+
+      D mu = inf;
+      Vertex meeting = s;
+      while (!forward.queue.empty() && !backward.queue.empty()
+             && compare(combine(forward.top_distance(),
+                                backward.top_distance()), mu)) {
+        if (forward.queue.size() <= backward.queue.size())
+          forward.step(g, weight, backward, compare, combine, inf, zero, mu,
+                       meeting);
+        else
+          backward.step(g, weight, forward, compare, combine, inf, zero, mu,
+                        meeting);
+      }
+      if (mu == inf) return inf;
+
+      // s ... meeting from the forward tree, then meeting ... t from the
+      // backward one
+      std::vector<Vertex> prefix;
+      for (Vertex v = meeting; v != s; v = get(forward.predecessor, v))
+        prefix.push_back(v);
+      prefix.push_back(s);
+      for (std::size_t i = prefix.size(); i-- > 0; )
+        *path++ = prefix[i];
+      for (Vertex v = meeting; v != t; ) {
+        v = get(backward.predecessor, v);
+        *path++ = v;
+      }
+      return mu;
+    }
+
+  } // namespace detail
+
+  // Writes the vertices of a shortest path from s to t, s and t included,
+  // to path, and returns its length; when t is not reachable from s,
+  // writes nothing and returns inf.  The graph must provide in_edges(),
+  // the weights must be nonnegative, and combine must also accept two
+  // distances, as closed_plus does.
+  template <typename Graph, typename OutputIterator, typename WeightMap,
+            typename VertexIndexMap, typename Compare, typename Combine,
+            typename DistInf, typename DistZero>
+  DistInf
+  bidirectional_dijkstra_shortest_path
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     typename graph_traits<Graph>::vertex_descriptor t,
+     OutputIterator path, WeightMap weight, VertexIndexMap index,
+     Compare compare, Combine combine, DistInf inf, DistZero zero)
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    search_workspace<Graph, DistInf, VertexIndexMap>
+      forward(g, index, inf), backward(g, index, inf);
+    return detail::bidirectional_dijkstra_impl(g, s, t, path, weight,
+                                               forward, backward, compare,
+                                               combine, DistInf(zero));
+  }
+
+  // The same with the state of the two searches kept in two workspaces,
+  // so that a query costs time in the vertices it reaches instead of the
+  // vertices of the graph; the distances are compared with std::less and
+  // added with closed_plus, up to the infinity of the workspaces
+  template <typename Graph, typename OutputIterator, typename WeightMap,
+            typename Distance, typename VertexIndexMap>
+  Distance
+  bidirectional_dijkstra_shortest_path
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     typename graph_traits<Graph>::vertex_descriptor t,
+     OutputIterator path, WeightMap weight,
+     search_workspace<Graph, Distance, VertexIndexMap>& forward,
+     search_workspace<Graph, Distance, VertexIndexMap>& backward)
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_STATIC_ASSERT((is_same<typename property_traits<WeightMap>
+                                   ::value_type, Distance>::value));
+    return detail::bidirectional_dijkstra_impl
+      (g, s, t, path, weight, forward, backward, std::less<Distance>(),
+       closed_plus<Distance>(forward.distance_inf()), Distance());
+  }
+
+  // Named parameter version: weight_map, vertex_index_map,
+  // distance_compare, distance_combine, distance_inf and distance_zero.  The
+  // distances have the value type of the weight map.
+  template <typename Graph, typename OutputIterator,
+            typename P, typename T, typename R>
+  inline typename detail::edge_weight_value<Graph, P, T, R>::type
+  bidirectional_dijkstra_shortest_path
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     typename graph_traits<Graph>::vertex_descriptor t,
+     OutputIterator path, const bgl_named_params<P, T, R>& params)
+  {
+    typedef typename detail::edge_weight_value<Graph, P, T, R>::type D;
+    D inf = choose_param(get_param(params, distance_inf_t()),
+                         (std::numeric_limits<D>::max)());
+    return bidirectional_dijkstra_shortest_path
+      (g, s, t, path,
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       choose_param(get_param(params, distance_compare_t()), std::less<D>()),
+       choose_param(get_param(params, distance_combine_t()),
+                    closed_plus<D>(inf)),
+       inf,
+       choose_param(get_param(params, distance_zero_t()), D()));
+  }
+
+  template <typename Graph, typename OutputIterator>
+  inline typename property_traits<
+    typename property_map<Graph, edge_weight_t>::const_type>::value_type
+  bidirectional_dijkstra_shortest_path
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     typename graph_traits<Graph>::vertex_descriptor t,
+     OutputIterator path)
+  {
+    return bidirectional_dijkstra_shortest_path(g, s, t, path,
+                                                weight_map(get(edge_weight, g)));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
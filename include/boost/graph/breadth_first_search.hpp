@@ -24,8 +24,11 @@
 #include <boost/graph/overloading.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/two_bit_color_map.hpp>
+#include <boost/graph/search_workspace.hpp>
 #include <boost/graph/detail/mpi_include.hpp>
 #include <boost/concept/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 #include BOOST_GRAPH_MPI_INCLUDE(<boost/graph/distributed/concepts.hpp>)
 
@@ -324,6 +327,51 @@ namespace boost {
       }
     };
 
+    template <class VertexListGraph, class P, class T, class R>
+    void bfs_workspace_dispatch
+      (VertexListGraph& g,
+       typename graph_traits<VertexListGraph>::vertex_descriptor s,
+       const bgl_named_params<P, T, R>& params,
+       param_not_found)
+    {
+      typedef typename get_param_type< vertex_color_t, bgl_named_params<P,T,R> >::type C;
+      bfs_dispatch<C>::apply(g, s, params, get_param(params, vertex_color));
+    }
+
+    // The colors live in the workspace, which starts a new generation
+    // instead of whitening every vertex, and the visitor sees
+    // initialize_vertex for a vertex only when the search first gets to
+    // it.  The workspace distance of s is zero, so that record_distances
+    // can count the hops in it.
+    template <class VertexListGraph, class P, class T, class R,
+              class Workspace>
+    void bfs_workspace_dispatch
+      (VertexListGraph& g,
+       typename graph_traits<VertexListGraph>::vertex_descriptor s,
+       const bgl_named_params<P, T, R>& params,
+       boost::reference_wrapper<Workspace> workspace)
+    {
+      BOOST_STATIC_ASSERT((is_same<typename get_param_type<vertex_color_t,
+                             bgl_named_params<P,T,R> >::type,
+                             param_not_found>::value));
+      typedef typename graph_traits<VertexListGraph>::vertex_descriptor
+        Vertex;
+      boost::queue<Vertex> Q;
+      typename lookup_named_param_def<graph_visitor_t,
+        bgl_named_params<P,T,R>, bfs_visitor<null_visitor> >::type vis
+        = choose_param(get_param(params, graph_visitor),
+                       make_bfs_visitor(null_visitor()));
+      workspace.get().reset();
+      vis.initialize_vertex(s, g);
+      put(workspace.get().distance_map(), s,
+          typename Workspace::distance_type());
+      breadth_first_visit
+        (g, s,
+         choose_param(get_param(params, buffer_param_t()), boost::ref(Q)).get(),
+         make_search_workspace_visitor(vis, workspace.get()),
+         workspace.get().color_map());
+    }
+
   } // namespace detail
 
 #if 1
@@ -339,9 +387,8 @@ namespace boost {
     // graph is not really const since we may write to property maps
     // of the graph.
     VertexListGraph& ng = const_cast<VertexListGraph&>(g);
-    typedef typename get_param_type< vertex_color_t, bgl_named_params<P,T,R> >::type C;
-    detail::bfs_dispatch<C>::apply(ng, s, params,
-                                   get_param(params, vertex_color));
+    detail::bfs_workspace_dispatch(ng, s, params,
+                                   get_param(params, search_workspace_t()));
   }
 #endif
 
@@ -9,6 +9,7 @@
 
 #include <boost/graph/detail/geodesic.hpp>
 #include <boost/graph/exterior_property.hpp>
+#include <boost/graph/multi_source_bfs.hpp>
 #include <boost/concept/assert.hpp>
 
 namespace boost
@@ -151,6 +152,44 @@ all_closeness_centralities(const Graph& g,
     all_closeness_centralities(g, dist, cent, measure_closeness<Result>(g, DistanceMap()));
 }
 
+// The closeness centralities of the vertices of an unweighted graph, with
+// the distances found by breadth-first searches run 256 at a time instead
+// of taken from a distance matrix.
+template <typename Graph,
+          typename CentralityMap,
+          typename Measure>
+inline void
+all_closeness_centralities_bfs(const Graph& g,
+                               CentralityMap cent,
+                               Measure measure)
+{
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    BOOST_CONCEPT_ASSERT(( WritablePropertyMapConcept<CentralityMap,Vertex> ));
+    BOOST_CONCEPT_ASSERT(( DistanceMeasureConcept<Measure,Graph> ));
+    typedef typename Measure::distance_type Distance;
+
+    std::vector<detail::bfs_distance_summary> summaries;
+    detail::all_bfs_distance_summaries<4>(g, get(vertex_index, g), summaries);
+    typename graph_traits<Graph>::vertex_iterator i, end;
+    for(boost::tie(i, end) = vertices(g); i != end; ++i) {
+        Distance d = summaries[get(vertex_index, g, *i)]
+            .template total<Distance>(num_vertices(g));
+        put(cent, *i, measure(d, g));
+    }
+}
+
+template <typename Graph, typename CentralityMap>
+inline void
+all_closeness_centralities_bfs(const Graph& g, CentralityMap cent)
+{
+    typedef typename graph_traits<Graph>::vertices_size_type Distance;
+    typedef typename property_traits<CentralityMap>::value_type Result;
+
+    all_closeness_centralities_bfs(g, cent,
+                                   closeness_measure<Graph, Distance, Result>());
+}
+
 } /* namespace boost */
 
 #endif
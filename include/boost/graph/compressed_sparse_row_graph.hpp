@@ -83,6 +83,16 @@ enum edges_are_unsorted_multi_pass_t {edges_are_unsorted_multi_pass};
 // greatly simplifies handling of edge properties.
 enum edges_are_unsorted_multi_pass_global_t {edges_are_unsorted_multi_pass_global};
 
+// A type (edges_are_unsorted_parallel_t) and a value
+// (edges_are_unsorted_parallel) used to indicate that the edge list passed
+// into the CSR graph is not sorted by source vertex and that the graph should
+// be built by several threads.  The edge (and edge property) iterators must be
+// random access.  The graph built is identical to the one built from the same
+// edges with edges_are_unsorted_multi_pass, but this version needs temporary
+// storage for one degree counter per vertex and thread.  Only available when
+// the compiler supports C++11 threads.
+enum edges_are_unsorted_parallel_t {edges_are_unsorted_parallel};
+
 // A type (construct_inplace_from_sources_and_targets_t) and a value
 // (construct_inplace_from_sources_and_targets) used to indicate that mutable
 // vectors of sources and targets (and possibly edge properties) are being used
@@ -317,6 +327,38 @@ class compressed_sparse_row_graph<directedS, VertexProperty, EdgeProperty, Graph
     m_forward.assign_unsorted_multi_pass_edges(edge_begin, edge_end, ep_iter, numlocalverts, global_to_local, source_pred);
   }
 
+#ifndef BOOST_GRAPH_NO_THREADS
+  //  From number of vertices and random-access unsorted list of edges, built
+  //  using num_threads threads (0 means one per hardware thread)
+  template <typename RandomAccessIterator>
+  compressed_sparse_row_graph(edges_are_unsorted_parallel_t,
+                              RandomAccessIterator edge_begin,
+                              RandomAccessIterator edge_end,
+                              vertices_size_type numverts,
+                              std::size_t num_threads,
+                              const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+  {
+    m_forward.assign_unsorted_edges_parallel(edge_begin, edge_end, numverts, typed_identity_property_map<vertices_size_type>(), keep_all(), boost::graph::detail::resolve_num_threads(num_threads));
+  }
+
+  //  From number of vertices and random-access unsorted list of edges, plus
+  //  edge properties, built using num_threads threads (0 means one per
+  //  hardware thread)
+  template <typename RandomAccessIterator, typename EdgePropertyIterator>
+  compressed_sparse_row_graph(edges_are_unsorted_parallel_t,
+                              RandomAccessIterator edge_begin,
+                              RandomAccessIterator edge_end,
+                              EdgePropertyIterator ep_iter,
+                              vertices_size_type numverts,
+                              std::size_t num_threads,
+                              const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_forward(), m_property(prop)
+  {
+    m_forward.assign_unsorted_edges_parallel(edge_begin, edge_end, ep_iter, numverts, typed_identity_property_map<vertices_size_type>(), keep_all(), boost::graph::detail::resolve_num_threads(num_threads));
+  }
+#endif // BOOST_GRAPH_NO_THREADS
+
   //  From number of vertices and sorted list of edges (new interface)
   template<typename InputIterator>
   compressed_sparse_row_graph(edges_are_sorted_t,
@@ -885,6 +927,42 @@ class compressed_sparse_row_graph<bidirectionalS, VertexProperty, EdgeProperty,
     set_up_backward_property_links();
   }
 
+#ifndef BOOST_GRAPH_NO_THREADS
+  //  From number of vertices and random-access unsorted list of edges, built
+  //  using num_threads threads (0 means one per hardware thread)
+  template <typename RandomAccessIterator>
+  compressed_sparse_row_graph(edges_are_unsorted_parallel_t,
+                              RandomAccessIterator edge_begin,
+                              RandomAccessIterator edge_end,
+                              vertices_size_type numverts,
+                              std::size_t num_threads,
+                              const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+  {
+    num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+    m_forward.assign_unsorted_edges_parallel(edge_begin, edge_end, numverts, typed_identity_property_map<Vertex>(), keep_all(), num_threads);
+    m_backward.assign_transpose_parallel(m_forward, num_threads);
+  }
+
+  //  From number of vertices and random-access unsorted list of edges, plus
+  //  edge properties, built using num_threads threads (0 means one per
+  //  hardware thread)
+  template <typename RandomAccessIterator, typename EdgePropertyIterator>
+  compressed_sparse_row_graph(edges_are_unsorted_parallel_t,
+                              RandomAccessIterator edge_begin,
+                              RandomAccessIterator edge_end,
+                              EdgePropertyIterator ep_iter,
+                              vertices_size_type numverts,
+                              std::size_t num_threads,
+                              const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_forward(), m_property(prop)
+  {
+    num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+    m_forward.assign_unsorted_edges_parallel(edge_begin, edge_end, ep_iter, numverts, typed_identity_property_map<Vertex>(), keep_all(), num_threads);
+    m_backward.assign_transpose_parallel(m_forward, num_threads);
+  }
+#endif // BOOST_GRAPH_NO_THREADS
+
   //   Requires IncidenceGraph and a vertex index map
   template<typename Graph, typename VertexIndexMap>
   compressed_sparse_row_graph(const Graph& g, const VertexIndexMap& vi,
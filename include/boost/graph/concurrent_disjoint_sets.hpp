@@ -0,0 +1,133 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_CONCURRENT_DISJOINT_SETS_HPP
+#define BOOST_GRAPH_CONCURRENT_DISJOINT_SETS_HPP
+
+// Disjoint sets of the integers 0, ..., n - 1 that several threads may
+// update and query at once without locking, after R. J. Anderson and
+// H. Woll, "Wait-free parallel algorithms for the union-find problem"
+// (STOC 1991) and S. V. Jayanti and R. E. Tarjan, "A randomized concurrent
+// algorithm for disjoint set union" (PODC 2016).
+//
+// The parent of each element is an atomic integer.  find_set() splits the
+// path it follows, replacing each parent by the grandparent with a
+// compare-and-swap that may fail harmlessly.  union_set() links the root
+// that comes first in a fixed pseudo-random order of the elements under
+// the other one by compare-and-swap, and starts again from the new roots if
+// another thread linked the first one meanwhile.
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <atomic>
+#include <boost/cstdint.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+
+template <typename Index = std::size_t>
+class concurrent_disjoint_sets
+{
+ public:
+  typedef Index value_type;
+
+  // n singleton sets
+  explicit concurrent_disjoint_sets(Index n) : m_parent(n)
+  {
+    for (Index x = 0; x < n; ++x)
+      m_parent[x].store(x, std::memory_order_relaxed);
+  }
+
+  Index size() const { return Index(m_parent.size()); }
+
+  // Makes x a singleton again; only for an element that no other set
+  // contains, as in initialize_incremental_components
+  void make_set(Index x)
+  {
+    BOOST_ASSERT (std::size_t(x) < m_parent.size());
+    m_parent[x].store(x, std::memory_order_release);
+  }
+
+  // The representative of the set of x, which another thread may change
+  // by a later union_set
+  Index find_set(Index x)
+  {
+    BOOST_ASSERT (std::size_t(x) < m_parent.size());
+    for (;;) {
+      Index p = m_parent[x].load(std::memory_order_acquire);
+      Index gp = m_parent[p].load(std::memory_order_acquire);
+      if (p == gp) return p;
+      m_parent[x].compare_exchange_weak(p, gp, std::memory_order_acq_rel);
+      x = p;
+    }
+  }
+
+  // Whether x and y are in the same set, the answer being true at some
+  // time during the call
+  bool same_set(Index x, Index y)
+  {
+    for (;;) {
+      x = find_set(x);
+      y = find_set(y);
+      if (x == y) return true;
+      // Two different roots answer the question only if the first one is
+      // still a root once the second one was found
+      if (m_parent[x].load(std::memory_order_acquire) == x) return false;
+    }
+  }
+
+  // Joins the sets of x and y; returns whether they were different
+  bool union_set(Index x, Index y)
+  {
+    for (;;) {
+      x = find_set(x);
+      y = find_set(y);
+      if (x == y) return false;
+      if (precedes(y, x)) std::swap(x, y);
+      Index expected = x;
+      if (m_parent[x].compare_exchange_strong(expected, y,
+                                              std::memory_order_acq_rel))
+        return true;
+    }
+  }
+
+  // The parent of x, which is x itself for a representative
+  Index parent(Index x) const
+  {
+    return m_parent[x].load(std::memory_order_acquire);
+  }
+
+ private:
+  concurrent_disjoint_sets(const concurrent_disjoint_sets&);
+  concurrent_disjoint_sets& operator=(const concurrent_disjoint_sets&);
+
+  // The linking order: a bijective mix of the bits of each element, so
+  // that no sequence of unions builds long paths
+  static bool precedes(Index x, Index y)
+  {
+    boost::uint64_t hx = mix(x), hy = mix(y);
+    return hx < hy || (hx == hy && x < y);
+  }
+
+  static boost::uint64_t mix(Index x)
+  {
+    boost::uint64_t z = boost::uint64_t(x) + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  std::vector<std::atomic<Index> > m_parent;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_CONCURRENT_DISJOINT_SETS_HPP
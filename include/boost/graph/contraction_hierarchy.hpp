@@ -0,0 +1,529 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
+#define BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
+
+/*
+ * Contraction hierarchies (R. Geisberger, P. Sanders, D. Schultes and
+ * D. Delling, "Contraction hierarchies: faster and simpler hierarchical
+ * routing in road networks", WEA 2008).
+ *
+ * Preprocessing removes the vertices one at a time, in the order of twice
+ * their edge difference (the number of shortcuts that removing the vertex
+ * needs minus the number of edges it removes) plus the number of neighbors
+ * already removed and the depth of the vertex in the hierarchy so far; the
+ * last two spread the contraction evenly over the graph.  The priorities are
+ * updated lazily: the vertex with the smallest one is recomputed before being
+ * removed, and put back if it is no longer the smallest.  Removing v adds a
+ * shortcut (u, w) for each pair of edges (u, v), (v, w) unless a local
+ * witness search from u that avoids v finds a path to w that is not longer.
+ *
+ * Each edge, original or shortcut, is stored once, with the vertex
+ * removed first: edges to vertices removed later go to the upward graph
+ * and edges from them, reversed, to the downward graph.  A query runs
+ * Dijkstra's algorithm from s on the upward graph and from t on the
+ * downward graph, both of which only go up in the hierarchy, and skips
+ * the vertices that can be reached more cheaply from a vertex higher up
+ * (stall-on-demand).  Shortcuts record the vertex they bypass, which is
+ * how the path in the original graph is recovered.
+ */
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  // Edge property of the upward and downward graphs: the length of the edge
+  // and, for a shortcut, the vertex it bypasses (no_middle for an edge of
+  // the input graph)
+  template <typename Distance>
+  struct contraction_hierarchy_edge
+  {
+    static const std::size_t no_middle = std::size_t(-1);
+
+    contraction_hierarchy_edge() : weight(), middle(no_middle) {}
+    contraction_hierarchy_edge(Distance weight, std::size_t middle)
+      : weight(weight), middle(middle) {}
+
+    Distance weight;
+    std::size_t middle;
+  };
+
+  template <typename Distance>
+  const std::size_t contraction_hierarchy_edge<Distance>::no_middle;
+
+  // Preprocessed graph for point-to-point shortest-path queries.  The
+  // vertices of the upward and downward graphs are the indices of the
+  // vertices of the input graph, and the hierarchy does not refer to the
+  // input graph once built.  Queries reuse buffers owned by the hierarchy
+  // and only reset the entries they touched, so each takes time in the size
+  // of the search space rather than the number of vertices; for the same
+  // reason, queries on one object must not run concurrently.
+  template <typename Graph,
+            typename WeightMap =
+              typename property_map<Graph, edge_weight_t>::const_type,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class contraction_hierarchy
+  {
+    typedef graph_traits<Graph> Traits;
+
+  public:
+    typedef typename Traits::vertex_descriptor vertex_descriptor;
+    typedef typename property_traits<WeightMap>::value_type distance_type;
+    typedef contraction_hierarchy_edge<distance_type> edge_property_type;
+    typedef compressed_sparse_row_graph<directedS, no_property,
+                                        edge_property_type> search_graph;
+
+    // Witness searches give up after settling this many vertices; a lost
+    // witness only costs a superfluous shortcut
+    BOOST_STATIC_CONSTANT(std::size_t, witness_search_limit = 500);
+
+    explicit contraction_hierarchy(const Graph& g)
+      : m_inf((std::numeric_limits<distance_type>::max)())
+    { build(g, get(edge_weight, g), get(vertex_index, g)); }
+
+    contraction_hierarchy(const Graph& g, WeightMap weight,
+                          VertexIndexMap index)
+      : m_inf((std::numeric_limits<distance_type>::max)())
+    { build(g, weight, index); }
+
+    // Writes the vertices of a shortest path from s to t, s and t included,
+    // to path and returns its length; writes nothing and returns
+    // std::numeric_limits<distance_type>::max() if there is none
+    template <typename OutputIterator>
+    distance_type
+    shortest_path(vertex_descriptor s, vertex_descriptor t,
+                  OutputIterator path) const
+    {
+      std::size_t si = get(m_index, s), ti = get(m_index, t);
+      std::size_t meeting;
+      distance_type d = search(si, ti, meeting);
+      if (d != m_inf) {
+        *path++ = s;
+        unpack_path(meeting, path);
+      }
+      m_forward.reset(m_inf);
+      m_backward.reset(m_inf);
+      return d;
+    }
+
+    distance_type distance(vertex_descriptor s, vertex_descriptor t) const
+    {
+      std::size_t meeting;
+      distance_type d = search(get(m_index, s), get(m_index, t), meeting);
+      m_forward.reset(m_inf);
+      m_backward.reset(m_inf);
+      return d;
+    }
+
+    // Position of v in the contraction order
+    std::size_t rank(vertex_descriptor v) const
+    { return m_rank[get(m_index, v)]; }
+
+    std::size_t num_shortcuts() const { return m_num_shortcuts; }
+
+    // Edges (u, v) of the augmented graph with rank(u) < rank(v)
+    const search_graph& upward_graph() const { return m_upward; }
+
+    // Edges (u, v) of the augmented graph with rank(u) > rank(v), as (v, u)
+    const search_graph& downward_graph() const { return m_downward; }
+
+  private:
+    static const std::size_t none = edge_property_type::no_middle;
+
+    // Edge of the graph left during preprocessing, seen from one endpoint
+    struct arc
+    {
+      arc(std::size_t other, distance_type weight, std::size_t middle)
+        : other(other), weight(weight), middle(middle) {}
+      std::size_t other;
+      distance_type weight;
+      std::size_t middle;
+    };
+
+    struct shortcut
+    {
+      shortcut(std::size_t source, std::size_t target,
+               distance_type weight, std::size_t middle)
+        : source(source), target(target), weight(weight), middle(middle) {}
+      std::size_t source, target;
+      distance_type weight;
+      std::size_t middle;
+    };
+
+    typedef std::pair<distance_type, std::size_t> queue_entry;
+    typedef std::priority_queue<queue_entry, std::vector<queue_entry>,
+                                std::greater<queue_entry> > queue_type;
+
+    // Labels of one Dijkstra search, reset through the list of the entries
+    // it touched
+    struct search_state
+    {
+      void init(std::size_t n, distance_type inf)
+      {
+        distance.assign(n, inf);
+        predecessor.resize(n);
+        middle.resize(n);
+      }
+
+      void label(std::size_t v, distance_type d, std::size_t p,
+                 std::size_t m, distance_type inf)
+      {
+        if (distance[v] == inf) touched.push_back(v);
+        distance[v] = d;
+        predecessor[v] = p;
+        middle[v] = m;
+        queue.push(queue_entry(d, v));
+      }
+
+      void reset(distance_type inf)
+      {
+        for (std::size_t i = 0; i < touched.size(); ++i)
+          distance[touched[i]] = inf;
+        touched.clear();
+        while (!queue.empty()) queue.pop();
+      }
+
+      std::vector<distance_type> distance;
+      std::vector<std::size_t> predecessor, middle;
+      std::vector<std::size_t> touched;
+      queue_type queue;
+    };
+
+    void build(const Graph& g, WeightMap weight, VertexIndexMap index)
+    {
+      BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+      std::size_t n = num_vertices(g);
+      m_index = index;
+      m_vertices.resize(n);
+      m_out.resize(n);
+      m_in.resize(n);
+      typename Traits::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        std::size_t u = get(index, *vi);
+        m_vertices[u] = *vi;
+        typename Traits::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei) {
+          distance_type w = get(weight, *ei);
+          if (w < distance_type())
+            boost::throw_exception(negative_edge());
+          std::size_t v = get(index, target(*ei, g));
+          if (u != v) add_arc(u, v, w, none);
+        }
+      }
+      m_forward.init(n, m_inf);
+      m_backward.init(n, m_inf);
+
+      // Contract the vertices in the order of their priorities
+      m_contracted_neighbors.assign(n, 0);
+      m_level.assign(n, 0);
+      typedef std::pair<long, std::size_t> priority_entry;
+      std::priority_queue<priority_entry, std::vector<priority_entry>,
+                          std::greater<priority_entry> > order;
+      for (std::size_t v = 0; v < n; ++v)
+        order.push(priority_entry(priority(v), v));
+
+      std::vector<std::pair<std::size_t, std::size_t> > up_edges, down_edges;
+      std::vector<edge_property_type> up_properties, down_properties;
+      std::vector<shortcut> shortcuts;
+      std::vector<std::size_t> neighbors;
+      m_rank.resize(n);
+      m_num_shortcuts = 0;
+      for (std::size_t r = 0; !order.empty(); ) {
+        std::size_t v = order.top().second;
+        order.pop();
+        long p = priority(v);
+        if (!order.empty() && p > order.top().first) {
+          order.push(priority_entry(p, v));
+          continue;
+        }
+        m_rank[v] = r++;
+
+        shortcuts.clear();
+        find_shortcuts(v, &shortcuts);
+        neighbors.clear();
+        for (std::size_t i = 0; i < m_out[v].size(); ++i) {
+          const arc& a = m_out[v][i];
+          up_edges.push_back(std::make_pair(v, a.other));
+          up_properties.push_back(edge_property_type(a.weight, a.middle));
+          remove_arc(m_in[a.other], v);
+          neighbors.push_back(a.other);
+        }
+        for (std::size_t i = 0; i < m_in[v].size(); ++i) {
+          const arc& a = m_in[v][i];
+          down_edges.push_back(std::make_pair(v, a.other));
+          down_properties.push_back(edge_property_type(a.weight, a.middle));
+          remove_arc(m_out[a.other], v);
+          neighbors.push_back(a.other);
+        }
+        std::vector<arc>().swap(m_out[v]);
+        std::vector<arc>().swap(m_in[v]);
+        for (std::size_t i = 0; i < shortcuts.size(); ++i) {
+          const shortcut& s = shortcuts[i];
+          if (add_arc(s.source, s.target, s.weight, s.middle))
+            ++m_num_shortcuts;
+        }
+
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+        for (std::size_t i = 0; i < neighbors.size(); ++i) {
+          std::size_t w = neighbors[i];
+          ++m_contracted_neighbors[w];
+          m_level[w] = (std::max)(m_level[w], m_level[v] + 1);
+        }
+      }
+      std::vector<long>().swap(m_contracted_neighbors);
+      std::vector<long>().swap(m_level);
+      std::vector<std::vector<arc> >().swap(m_out);
+      std::vector<std::vector<arc> >().swap(m_in);
+
+      m_upward = search_graph(edges_are_unsorted_multi_pass, up_edges.begin(),
+                              up_edges.end(), up_properties.begin(), n);
+      m_downward = search_graph(edges_are_unsorted_multi_pass,
+                                down_edges.begin(), down_edges.end(),
+                                down_properties.begin(), n);
+    }
+
+    // Adds the edge (u, v) or shortens the existing one; returns true if the
+    // edge is new
+    bool add_arc(std::size_t u, std::size_t v, distance_type w,
+                 std::size_t middle)
+    {
+      std::vector<arc>& out = m_out[u];
+      for (std::size_t i = 0; i < out.size(); ++i)
+        if (out[i].other == v) {
+          if (w < out[i].weight) {
+            out[i].weight = w;
+            out[i].middle = middle;
+            std::vector<arc>& in = m_in[v];
+            for (std::size_t j = 0; j < in.size(); ++j)
+              if (in[j].other == u) {
+                in[j].weight = w;
+                in[j].middle = middle;
+              }
+          }
+          return false;
+        }
+      out.push_back(arc(v, w, middle));
+      m_in[v].push_back(arc(u, w, middle));
+      return true;
+    }
+
+    static void remove_arc(std::vector<arc>& arcs, std::size_t other)
+    {
+      for (std::size_t i = 0; i < arcs.size(); ++i)
+        if (arcs[i].other == other) {
+          arcs[i] = arcs.back();
+          arcs.pop_back();
+          return;
+        }
+    }
+
+    // Lower values are contracted first
+    long priority(std::size_t v)
+    {
+      long added = long(find_shortcuts(v, 0));
+      return 2 * (added - long(m_in[v].size() + m_out[v].size()))
+             + m_contracted_neighbors[v] + m_level[v];
+    }
+
+    // Counts the shortcuts needed to remove v, and appends them to shortcuts
+    // unless it is null
+    std::size_t find_shortcuts(std::size_t v, std::vector<shortcut>* shortcuts)
+    {
+      const std::vector<arc>& in = m_in[v];
+      const std::vector<arc>& out = m_out[v];
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < in.size(); ++i) {
+        std::size_t u = in[i].other;
+        distance_type bound = distance_type();
+        bool any = false;
+        for (std::size_t j = 0; j < out.size(); ++j)
+          if (out[j].other != u && bound < in[i].weight + out[j].weight) {
+            bound = in[i].weight + out[j].weight;
+            any = true;
+          }
+        if (!any) continue;
+        witness_search(u, v, bound);
+        for (std::size_t j = 0; j < out.size(); ++j) {
+          std::size_t w = out[j].other;
+          distance_type via = in[i].weight + out[j].weight;
+          if (w == u || !(via < m_forward.distance[w])) continue;
+          ++count;
+          if (shortcuts) shortcuts->push_back(shortcut(u, w, via, v));
+        }
+        m_forward.reset(m_inf);
+      }
+      return count;
+    }
+
+    // Dijkstra's algorithm from source on the remaining graph without
+    // avoid, up to distance bound or witness_search_limit settled vertices
+    void witness_search(std::size_t source, std::size_t avoid,
+                        distance_type bound)
+    {
+      search_state& state = m_forward;
+      state.label(source, distance_type(), source, none, m_inf);
+      for (std::size_t settled = 0;
+           !state.queue.empty() && settled < witness_search_limit;
+           ++settled) {
+        queue_entry top = state.queue.top();
+        state.queue.pop();
+        std::size_t u = top.second;
+        if (state.distance[u] < top.first) continue;
+        if (bound < top.first) break;
+        const std::vector<arc>& out = m_out[u];
+        for (std::size_t i = 0; i < out.size(); ++i) {
+          std::size_t w = out[i].other;
+          distance_type d = top.first + out[i].weight;
+          if (w != avoid && d < state.distance[w])
+            state.label(w, d, u, none, m_inf);
+        }
+      }
+    }
+
+    // Has a vertex higher up a shorter path to v than the one found?
+    bool stalled(const search_graph& reverse, const search_state& state,
+                 std::size_t v, distance_type dv) const
+    {
+      typename graph_traits<search_graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(v, reverse); ei != ei_end; ++ei) {
+        distance_type du = state.distance[target(*ei, reverse)];
+        if (du != m_inf && du + reverse[*ei].weight < dv) return true;
+      }
+      return false;
+    }
+
+    // One step of the forward or backward search
+    void step(const search_graph& forward, const search_graph& reverse,
+              search_state& state, const search_state& other,
+              distance_type& mu, std::size_t& meeting) const
+    {
+      queue_entry top = state.queue.top();
+      state.queue.pop();
+      std::size_t u = top.second;
+      if (state.distance[u] < top.first) return;
+      if (other.distance[u] != m_inf && top.first + other.distance[u] < mu) {
+        mu = top.first + other.distance[u];
+        meeting = u;
+      }
+      if (stalled(reverse, state, u, top.first)) return;
+      typename graph_traits<search_graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(u, forward); ei != ei_end; ++ei) {
+        std::size_t v = target(*ei, forward);
+        distance_type d = top.first + forward[*ei].weight;
+        if (d < state.distance[v])
+          state.label(v, d, u, forward[*ei].middle, m_inf);
+      }
+    }
+
+    distance_type search(std::size_t s, std::size_t t,
+                         std::size_t& meeting) const
+    {
+      distance_type mu = m_inf;
+      meeting = s;
+      m_forward.label(s, distance_type(), s, none, m_inf);
+      m_backward.label(t, distance_type(), t, none, m_inf);
+      // Each search stops once its smallest key is not below mu
+      for (bool forward_turn = true; ; forward_turn = !forward_turn) {
+        bool forward_done = m_forward.queue.empty()
+                            || !(m_forward.queue.top().first < mu);
+        bool backward_done = m_backward.queue.empty()
+                             || !(m_backward.queue.top().first < mu);
+        if (forward_done && backward_done) break;
+        if (forward_done) forward_turn = false;
+        else if (backward_done) forward_turn = true;
+        if (forward_turn)
+          step(m_upward, m_downward, m_forward, m_backward, mu, meeting);
+        else
+          step(m_downward, m_upward, m_backward, m_forward, mu, meeting);
+      }
+      return mu;
+    }
+
+    // Middle vertex of the edge (u, v) of the augmented graph
+    std::size_t middle_of(std::size_t u, std::size_t v) const
+    {
+      bool up = m_rank[u] < m_rank[v];
+      const search_graph& g = up ? m_upward : m_downward;
+      std::size_t from = up ? u : v, to = up ? v : u;
+      typename graph_traits<search_graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(from, g); ei != ei_end; ++ei)
+        if (target(*ei, g) == to) return g[*ei].middle;
+      BOOST_ASSERT(false);
+      return none;
+    }
+
+    // Writes the vertices after s of the path found by the last search
+    template <typename OutputIterator>
+    void unpack_path(std::size_t meeting, OutputIterator& path) const
+    {
+      // Edges of the augmented graph from s to meeting, then to t
+      std::vector<shortcut> edges;
+      for (std::size_t v = meeting; v != m_forward.predecessor[v];
+           v = m_forward.predecessor[v])
+        edges.push_back(shortcut(m_forward.predecessor[v], v,
+                                 distance_type(), m_forward.middle[v]));
+      std::vector<shortcut> pending(edges.rbegin(), edges.rend());
+      edges.clear();
+      for (std::size_t v = meeting; v != m_backward.predecessor[v];
+           v = m_backward.predecessor[v])
+        edges.push_back(shortcut(v, m_backward.predecessor[v],
+                                 distance_type(), m_backward.middle[v]));
+      pending.insert(pending.end(), edges.begin(), edges.end());
+
+      // Replace each shortcut (u, w) bypassing v by (u, v) and (v, w)
+      std::reverse(pending.begin(), pending.end());
+      while (!pending.empty()) {
+        shortcut e = pending.back();
+        pending.pop_back();
+        if (e.middle == none) {
+          *path++ = m_vertices[e.target];
+        } else {
+          pending.push_back(shortcut(e.middle, e.target, distance_type(),
+                                     middle_of(e.middle, e.target)));
+          pending.push_back(shortcut(e.source, e.middle, distance_type(),
+                                     middle_of(e.source, e.middle)));
+        }
+      }
+    }
+
+    distance_type m_inf;
+    VertexIndexMap m_index;
+    std::vector<vertex_descriptor> m_vertices;
+    std::vector<std::size_t> m_rank;
+    std::size_t m_num_shortcuts;
+    search_graph m_upward, m_downward;
+    mutable search_state m_forward, m_backward;
+
+    // The remaining graph during preprocessing
+    std::vector<std::vector<arc> > m_out, m_in;
+    std::vector<long> m_contracted_neighbors, m_level;
+  };
+
+  template <typename Graph, typename WeightMap, typename VertexIndexMap>
+  const std::size_t
+  contraction_hierarchy<Graph, WeightMap, VertexIndexMap>::none;
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,285 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DEGENERACY_ALL_CLIQUES_HPP
+#define BOOST_GRAPH_DEGENERACY_ALL_CLIQUES_HPP
+
+/*
+ * Enumeration of the maximal cliques of a sparse graph by the algorithm of
+ * D. Eppstein, M. Loffler and D. Strash, "Listing all maximal cliques in
+ * sparse graphs in near-optimal time", ISAAC 2010.
+ *
+ * The vertices are taken in a degeneracy order, given by
+ * smallest_last_vertex_ordering on a simple copy of the graph, in which each
+ * vertex has at most d neighbors after it, d being the degeneracy of the
+ * graph.  The maximal cliques whose first vertex in that order is v are those
+ * that the Bron-Kerbosch algorithm with the pivoting rule of Tomita, Tanaka
+ * and Takahashi finds from the clique {v}, with the neighbors of v after it
+ * as candidates and those before it as excluded vertices.  These at most d
+ * candidates and the excluded vertices are numbered locally, and their
+ * adjacency is stored as rows of bits, so that every set operation of the
+ * search is a loop over words and the pivot is chosen by counting bits: each
+ * candidate has a row over all the local vertices, and each excluded vertex a
+ * row over the candidates only, which takes O(d * degree(v)) bits.
+ */
+
+#include <vector>
+#include <deque>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/smallest_last_ordering.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/bron_kerbosch_all_cliques.hpp>
+#include <boost/graph/detail/bit_scan.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // The graph in which the cliques are searched, by vertex index: the
+    // sorted neighbors of each vertex, without self-loops or repetitions;
+    // in a directed graph, u and v are neighbors if there are arcs both
+    // ways, as in bron_kerbosch_all_cliques.  position[i] is the position
+    // of vertex i in the degeneracy order, and order[k] the vertex at
+    // position k.
+    template <typename Graph>
+    struct clique_search_graph
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+
+      explicit clique_search_graph(const Graph& g)
+        : verts(num_vertices(g)), order(num_vertices(g)),
+          position(num_vertices(g)), offsets(num_vertices(g) + 1)
+      {
+        std::size_t n = num_vertices(g);
+        typename property_map<Graph, vertex_index_t>::const_type
+          index = get(vertex_index, g);
+        typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+          verts[get(index, *vi)] = *vi;
+
+        std::vector<std::size_t> out_offsets(n + 1), out;
+        for (std::size_t i = 0; i < n; ++i) {
+          typename graph_traits<Graph>::adjacency_iterator ai, ai_end;
+          for (boost::tie(ai, ai_end) = adjacent_vertices(verts[i], g);
+               ai != ai_end; ++ai)
+            if (get(index, *ai) != i) out.push_back(get(index, *ai));
+          std::sort(out.begin() + out_offsets[i], out.end());
+          out.erase(std::unique(out.begin() + out_offsets[i], out.end()),
+                    out.end());
+          out_offsets[i + 1] = out.size();
+        }
+        bool directed = is_directed(g);
+        for (std::size_t i = 0; i < n; ++i) {
+          for (std::size_t j = out_offsets[i]; j < out_offsets[i + 1]; ++j)
+            if (!directed
+                || std::binary_search(out.begin() + out_offsets[out[j]],
+                                      out.begin() + out_offsets[out[j] + 1], i))
+              neighbors.push_back(out[j]);
+          offsets[i + 1] = neighbors.size();
+        }
+
+        // smallest_last_vertex_ordering needs a graph without self-loops or
+        // parallel edges, and puts the first vertex removed last
+        typedef compressed_sparse_row_graph<directedS> Simple;
+        std::vector<std::pair<std::size_t, std::size_t> > edges;
+        edges.reserve(neighbors.size());
+        for (std::size_t i = 0; i < n; ++i)
+          for (std::size_t j = offsets[i]; j < offsets[i + 1]; ++j)
+            edges.push_back(std::make_pair(i, neighbors[j]));
+        Simple simple(edges_are_sorted, edges.begin(), edges.end(), n);
+        std::vector<std::size_t> smallest_last
+          = smallest_last_vertex_ordering(simple);
+        for (std::size_t k = 0; k < n; ++k) {
+          std::size_t i = smallest_last[n - 1 - k];
+          order[k] = i;
+          position[i] = k;
+        }
+      }
+
+      std::vector<Vertex> verts;
+      std::vector<std::size_t> order, position, offsets, neighbors;
+    };
+
+    // Enumerates the maximal cliques whose first vertex in the degeneracy
+    // order is a given vertex; keeps its workspace from one vertex to the
+    // next
+    template <typename Graph, typename Visitor>
+    class degeneracy_clique_search
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef boost::uint64_t word;
+
+    public:
+      degeneracy_clique_search(const Graph& g,
+                               const clique_search_graph<Graph>& sg,
+                               Visitor& vis, std::size_t min)
+        : g(g), sg(sg), vis(vis), min(min),
+          local_of(num_vertices(g), none()) {}
+
+      void operator()(std::size_t i)
+      {
+        members.clear();
+        std::size_t pi = sg.position[i];
+        for (std::size_t j = sg.offsets[i]; j < sg.offsets[i + 1]; ++j)
+          if (sg.position[sg.neighbors[j]] > pi)
+            members.push_back(sg.neighbors[j]);
+        p = members.size();
+        for (std::size_t j = sg.offsets[i]; j < sg.offsets[i + 1]; ++j)
+          if (sg.position[sg.neighbors[j]] < pi)
+            members.push_back(sg.neighbors[j]);
+        std::size_t s = members.size();
+        if (s == 0) {
+          // An isolated vertex
+          if (min <= 1) {
+            clique.assign(1, sg.verts[i]);
+            vis.clique(clique, g);
+          }
+          return;
+        }
+        wp = (p + 63) / 64;
+        ws = (s + 63) / 64;
+        for (std::size_t a = 0; a < s; ++a) local_of[members[a]] = a;
+
+        // The rows of the candidates over all the local vertices, and those
+        // of the excluded vertices over the candidates
+        prow.assign(p * ws, 0);
+        xrow.assign((s - p) * wp, 0);
+        for (std::size_t a = 0; a < p; ++a) {
+          std::size_t ga = members[a];
+          for (std::size_t j = sg.offsets[ga]; j < sg.offsets[ga + 1]; ++j) {
+            std::size_t b = local_of[sg.neighbors[j]];
+            if (b == none()) continue;
+            prow[a * ws + b / 64] |= word(1) << (b % 64);
+            if (b >= p) xrow[(b - p) * wp + a / 64] |= word(1) << (a % 64);
+          }
+        }
+        for (std::size_t a = 0; a < s; ++a) local_of[members[a]] = none();
+
+        // Sets of the first level: every candidate, every excluded vertex
+        level = 2 * wp + ws;
+        sets.assign((p + 1) * level, 0);
+        for (std::size_t a = 0; a < s; ++a)
+          sets[(a < p ? 0 : wp) + a / 64] |= word(1) << (a % 64);
+
+        clique.clear();
+        clique.push_back(sg.verts[i]);
+        expand(0);
+      }
+
+    private:
+      static std::size_t none() { return ~std::size_t(0); }
+
+      // The first wp words of the row of the local vertex a
+      const word* candidate_row(std::size_t a) const
+      { return a < p ? &prow[a * ws] : &xrow[(a - p) * wp]; }
+
+      void expand(std::size_t depth)
+      {
+        word* cands = &sets[depth * level];
+        word* excluded = cands + wp;
+        word* branches = excluded + ws;
+
+        std::size_t num_cands = 0;
+        for (std::size_t w = 0; w < wp; ++w)
+          num_cands += graph::detail::popcount(cands[w]);
+        if (num_cands == 0) {
+          word any = 0;
+          for (std::size_t w = 0; w < ws; ++w) any |= excluded[w];
+          if (any == 0 && clique.size() >= min) vis.clique(clique, g);
+          return;
+        }
+        if (clique.size() + num_cands < min) return;
+
+        // The pivot has the most neighbors among the candidates
+        std::size_t pivot = 0, best = 0;
+        bool found = false;
+        for (std::size_t w = 0; w < ws && best < num_cands; ++w) {
+          word bits = excluded[w] | (w < wp ? cands[w] : 0);
+          for (; bits != 0 && best < num_cands; bits &= bits - 1) {
+            std::size_t a = 64 * w + graph::detail::lowest_bit(bits);
+            const word* row = candidate_row(a);
+            std::size_t count = 0;
+            for (std::size_t x = 0; x < wp; ++x)
+              count += graph::detail::popcount(cands[x] & row[x]);
+            if (!found || count > best) {
+              pivot = a;
+              best = count;
+              found = true;
+            }
+          }
+        }
+        const word* pivot_row = candidate_row(pivot);
+        for (std::size_t w = 0; w < wp; ++w)
+          branches[w] = cands[w] & ~pivot_row[w];
+
+        word* next = cands + level;
+        for (std::size_t w = 0; w < wp; ++w)
+          for (word bits = branches[w]; bits != 0; bits &= bits - 1) {
+            std::size_t a = 64 * w + graph::detail::lowest_bit(bits);
+            const word* row = &prow[a * ws];
+            for (std::size_t x = 0; x < wp; ++x) next[x] = cands[x] & row[x];
+            for (std::size_t x = 0; x < ws; ++x)
+              next[wp + x] = excluded[x] & row[x];
+            clique.push_back(sg.verts[members[a]]);
+            expand(depth + 1);
+            clique.pop_back();
+            cands[w] &= ~(word(1) << (a % 64));
+            excluded[w] |= word(1) << (a % 64);
+          }
+      }
+
+      const Graph& g;
+      const clique_search_graph<Graph>& sg;
+      Visitor& vis;
+      std::size_t min;
+      std::vector<std::size_t> local_of, members;
+      std::size_t p, wp, ws, level;
+      std::vector<word> prow, xrow, sets;
+      std::deque<Vertex> clique;
+    };
+
+  } // namespace detail
+
+  // Visits the maximal cliques of g with at least min vertices, as
+  // bron_kerbosch_all_cliques does, but in a different order.  Suited to
+  // sparse graphs and to dense parts of them.
+  template <typename Graph, typename Visitor>
+  void degeneracy_all_cliques(const Graph& g, Visitor vis, std::size_t min)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( AdjacencyGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    BOOST_CONCEPT_ASSERT(( CliqueVisitorConcept<Visitor,std::deque<Vertex>,Graph> ));
+
+    detail::clique_search_graph<Graph> sg(g);
+    detail::degeneracy_clique_search<Graph, Visitor> search(g, sg, vis, min);
+    for (std::size_t k = 0; k < sg.order.size(); ++k) search(sg.order[k]);
+  }
+
+  // Singleton cliques are not visited, as in bron_kerbosch_all_cliques
+  template <typename Graph, typename Visitor>
+  inline void degeneracy_all_cliques(const Graph& g, Visitor vis)
+  { degeneracy_all_cliques(g, vis, 2); }
+
+  template <typename Graph>
+  inline std::size_t degeneracy_clique_number(const Graph& g)
+  {
+    std::size_t ret = 0;
+    degeneracy_all_cliques(g, find_max_clique(ret));
+    return ret;
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DEGENERACY_ALL_CLIQUES_HPP
@@ -0,0 +1,414 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+#define BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+
+/*
+ * Multithreaded single-source shortest paths by delta-stepping (U. Meyer
+ * and P. Sanders, "Delta-stepping: a parallelizable shortest path
+ * algorithm", Journal of Algorithms 49(1), 2003).
+ *
+ * Tentative distances are kept in buckets of width delta.  The lowest
+ * non-empty bucket is settled in phases: its vertices relax their light
+ * edges (weight <= delta) in parallel, which may put vertices back into the
+ * same bucket, until the bucket stays empty; then every vertex settled in
+ * the bucket relaxes its heavy edges once.  Distances are lowered with an
+ * atomic compare-and-swap, and each thread keeps its own buckets.
+ *
+ * The buckets form a ring of at most delta_stepping_max_ring() buckets
+ * past the current one.  With a small delta and large weights, vertices
+ * farther away go to an overflow bucket per thread instead, which is
+ * poured into the ring once the current bucket comes close enough.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <limits>
+#include <atomic>
+#include <functional>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/atomic_bit_map.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    inline std::size_t delta_stepping_max_ring() { return 4096; }
+
+    // Largest edge weight, after checking that there are no negative ones
+    template <typename Graph, typename WeightMap>
+    typename property_traits<WeightMap>::value_type
+    delta_stepping_max_weight(const Graph& g, WeightMap weight,
+                              const std::vector<typename graph_traits<Graph>::vertex_descriptor>& verts,
+                              std::size_t num_threads)
+    {
+      typedef typename property_traits<WeightMap>::value_type weight_type;
+      std::vector<weight_type> max_weight(num_threads, weight_type(0));
+      std::vector<char> negative(num_threads, 0);
+      graph::detail::parallel_for_blocks(num_threads, verts.size(),
+        [&](std::size_t t, std::size_t first, std::size_t last) {
+          for (std::size_t i = first; i < last; ++i) {
+            typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(verts[i], g); ei != ei_end;
+                 ++ei) {
+              weight_type w = get(weight, *ei);
+              if (w < weight_type(0)) negative[t] = 1;
+              else if (max_weight[t] < w) max_weight[t] = w;
+            }
+          }
+        });
+      weight_type result(0);
+      for (std::size_t t = 0; t < num_threads; ++t) {
+        if (negative[t]) boost::throw_exception(negative_edge());
+        if (result < max_weight[t]) result = max_weight[t];
+      }
+      return result;
+    }
+
+    // The usual choice of delta: the largest weight over the average degree,
+    // so that a vertex has about one light edge per unit of bucket width
+    template <typename Weight, typename Graph>
+    Weight default_delta(Weight max_weight, const Graph& g)
+    {
+      std::size_t n = num_vertices(g), m = 0;
+      typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        m += out_degree(*vi, g);
+      Weight delta = m == 0 ? max_weight : Weight(max_weight * double(n) / m);
+      return delta > Weight(0) ? delta : Weight(1);
+    }
+
+  } // namespace detail
+
+  // The distance type must be arithmetic; delta == 0 picks the largest
+  // weight over the average out-degree, and num_threads == 0 one thread per
+  // hardware thread.  The distances are exactly those computed by
+  // dijkstra_shortest_paths; the predecessor of each reached vertex u != s
+  // is a vertex v with an edge (v, u) such that d[v] + w(v, u) == d[u].
+  // Unreached vertices get distance inf and are their own predecessors, as
+  // with Dijkstra.  The distance and predecessor maps must allow distinct
+  // vertices to be written concurrently.
+  template <typename Graph, typename PredecessorMap, typename DistanceMap,
+            typename WeightMap, typename VertexIndexMap>
+  void
+  delta_stepping_shortest_paths
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+     VertexIndexMap index,
+     typename property_traits<DistanceMap>::value_type delta,
+     typename property_traits<DistanceMap>::value_type inf,
+     std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef graph_traits<Graph> Traits;
+    typedef typename Traits::vertex_descriptor Vertex;
+    typedef typename property_traits<DistanceMap>::value_type D;
+    typedef typename property_traits<WeightMap>::value_type W;
+
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    std::vector<Vertex> verts(vertices(g).first, vertices(g).second);
+    std::size_t n = verts.size();
+
+    W max_weight = detail::delta_stepping_max_weight(g, weight, verts,
+                                                     num_threads);
+    if (!(delta > D(0))) delta = detail::default_delta(D(max_weight), g);
+
+    // Buckets form a ring: pending vertices are never more than
+    // max_weight / delta + 1 buckets past the current one (one more bucket
+    // absorbs rounding in the bucket computation), unless the ring is
+    // capped, in which case those beyond it overflow
+    std::size_t ring = detail::delta_stepping_max_ring();
+    if (D(max_weight) / delta < D(ring - 3))
+      ring = std::size_t(D(max_weight) / delta) + 3;
+    std::vector<std::vector<std::vector<Vertex> > >
+      bins(num_threads, std::vector<std::vector<Vertex> >(ring));
+    std::vector<std::vector<Vertex> > settled(num_threads);
+    // The vertices at least ring buckets past the current one, and the
+    // lowest bucket each thread filed there (their distances may have gone
+    // down since, so it is a lower bound)
+    std::vector<std::vector<Vertex> > overflow(num_threads);
+    const std::size_t no_bucket = (std::numeric_limits<std::size_t>::max)();
+    std::vector<std::size_t> overflow_min(num_threads, no_bucket);
+
+    std::vector<std::atomic<D> > dist(n);
+    graph::detail::parallel_for_blocks(num_threads, n,
+      [&](std::size_t, std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i)
+          dist[i].store(inf, std::memory_order_relaxed);
+      });
+    dist[get(index, s)].store(D(0), std::memory_order_relaxed);
+
+    atomic_bit_map<VertexIndexMap> in_settled(n, index);
+    std::vector<Vertex> frontier(1, s), next;
+    std::vector<std::size_t> offsets(num_threads + 1);
+    graph::detail::chunk_dispenser<std::size_t> chunks(0, 1, 64);
+    graph::detail::thread_barrier barrier(num_threads);
+    std::size_t current = 0, lowest_overflow = no_bucket;
+    bool done = false;
+
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      // Lower the distance of v to d; the winner files v in its bucket
+      auto relax = [&](Vertex v, D d) {
+        std::atomic<D>& dv = dist[get(index, v)];
+        D old = dv.load(std::memory_order_relaxed);
+        while (d < old) {
+          if (dv.compare_exchange_weak(old, d, std::memory_order_relaxed)) {
+            std::size_t b = std::size_t(d / delta);
+            if (b - current < ring) {
+              bins[t][b % ring].push_back(v);
+            } else {
+              overflow[t].push_back(v);
+              if (b < overflow_min[t]) overflow_min[t] = b;
+            }
+            return;
+          }
+        }
+      };
+
+      // Move the overflowing vertices that the ring now covers into it
+      auto pour = [&]() {
+        std::vector<Vertex>& mine = overflow[t];
+        std::size_t kept = 0;
+        overflow_min[t] = no_bucket;
+        for (std::size_t i = 0; i < mine.size(); ++i) {
+          Vertex v = mine[i];
+          std::size_t b = std::size_t(dist[get(index, v)]
+                                        .load(std::memory_order_relaxed)
+                                      / delta);
+          // Below current: v went down to a bucket already settled
+          if (b < current) continue;
+          if (b - current < ring) {
+            bins[t][b % ring].push_back(v);
+          } else {
+            mine[kept++] = v;
+            if (b < overflow_min[t]) overflow_min[t] = b;
+          }
+        }
+        mine.resize(kept);
+      };
+
+      // Replace the frontier by the contents of the current bucket
+      auto gather = [&]() {
+        std::vector<Vertex>& mine = bins[t][current % ring];
+        offsets[t + 1] = mine.size();
+        barrier.wait();
+        if (t == 0) {
+          for (std::size_t i = 0; i < num_threads; ++i)
+            offsets[i + 1] += offsets[i];
+          next.resize(offsets[num_threads]);
+        }
+        barrier.wait();
+        std::copy(mine.begin(), mine.end(), next.begin() + offsets[t]);
+        mine.clear();
+        barrier.wait();
+        if (t == 0) {
+          frontier.swap(next);
+          chunks.reset(0, frontier.size());
+        }
+        barrier.wait();
+      };
+
+      for (;;) {
+        // Light edges, until the current bucket stays empty
+        while (!frontier.empty()) {
+          std::size_t b, e;
+          while (chunks.next(b, e)) {
+            for (std::size_t i = b; i < e; ++i) {
+              Vertex u = frontier[i];
+              D du = dist[get(index, u)].load(std::memory_order_relaxed);
+              // Skip entries left behind when u moved to a lower bucket
+              if (std::size_t(du / delta) != current) continue;
+              if (test_and_set(in_settled, u)) settled[t].push_back(u);
+              typename Traits::out_edge_iterator ei, ei_end;
+              for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end;
+                   ++ei) {
+                W w = get(weight, *ei);
+                if (D(w) <= delta) relax(target(*ei, g), du + D(w));
+              }
+            }
+          }
+          barrier.wait();
+          gather();
+        }
+
+        // Heavy edges of the vertices settled in the bucket
+        for (std::size_t i = 0; i < settled[t].size(); ++i) {
+          Vertex u = settled[t][i];
+          D du = dist[get(index, u)].load(std::memory_order_relaxed);
+          put(in_settled, u, false);
+          typename Traits::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei) {
+            W w = get(weight, *ei);
+            if (D(w) > delta) relax(target(*ei, g), du + D(w));
+          }
+        }
+        settled[t].clear();
+        barrier.wait();
+
+        // Move on to the next non-empty bucket, in the ring or overflowing
+        if (t == 0) {
+          std::size_t next_bucket = no_bucket;
+          for (std::size_t k = 1; k < ring && next_bucket == no_bucket; ++k)
+            for (std::size_t i = 0; i < num_threads; ++i)
+              if (!bins[i][(current + k) % ring].empty()) {
+                next_bucket = current + k;
+                break;
+              }
+          lowest_overflow = no_bucket;
+          for (std::size_t i = 0; i < num_threads; ++i)
+            if (overflow_min[i] < lowest_overflow)
+              lowest_overflow = overflow_min[i];
+          if (lowest_overflow < next_bucket) next_bucket = lowest_overflow;
+          done = next_bucket == no_bucket;
+          if (!done) current = next_bucket;
+        }
+        barrier.wait();
+        if (done) break;
+        if (lowest_overflow - current < ring) pour();
+        gather();
+      }
+    });
+
+    // Store the distances, then choose for each reached vertex a tight
+    // in-edge from a strictly closer vertex
+    atomic_bit_map<VertexIndexMap> has_pred(n, index);
+    put(has_pred, s, true);
+    graph::detail::parallel_for(num_threads, std::size_t(0), n,
+                                std::size_t(256),
+      [&](std::size_t, std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+          Vertex u = verts[i];
+          D du = dist[get(index, u)].load(std::memory_order_relaxed);
+          put(distance, u, du);
+          put(predecessor, u, u);
+        }
+      });
+    graph::detail::parallel_for(num_threads, std::size_t(0), n,
+                                std::size_t(256),
+      [&](std::size_t, std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+          Vertex u = verts[i];
+          D du = dist[get(index, u)].load(std::memory_order_relaxed);
+          if (du == inf) continue;
+          typename Traits::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei) {
+            Vertex v = target(*ei, g);
+            D dv = dist[get(index, v)].load(std::memory_order_relaxed);
+            if (du < dv && du + D(get(weight, *ei)) == dv
+                && test_and_set(has_pred, v))
+              put(predecessor, v, u);
+          }
+        }
+      });
+    std::size_t unassigned = 0;
+    std::vector<Vertex> assigned;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (get(has_pred, verts[i])) assigned.push_back(verts[i]);
+      else if (dist[get(index, verts[i])].load() != inf) ++unassigned;
+    }
+
+    // Vertices reached only through zero-weight edges from vertices at the
+    // same distance: extend the tree along those edges
+    for (std::size_t i = 0; unassigned != 0 && i < assigned.size(); ++i) {
+      Vertex u = assigned[i];
+      D du = dist[get(index, u)].load(std::memory_order_relaxed);
+      typename Traits::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei) {
+        Vertex v = target(*ei, g);
+        if (!get(has_pred, v)
+            && du + D(get(weight, *ei))
+               == dist[get(index, v)].load(std::memory_order_relaxed)) {
+          put(has_pred, v, true);
+          put(predecessor, v, u);
+          assigned.push_back(v);
+          --unassigned;
+        }
+      }
+    }
+  }
+
+  namespace detail {
+
+    template <typename Graph, typename DistanceMap, typename WeightMap,
+              typename VertexIndexMap, typename Params>
+    inline void
+    delta_stepping_dispatch2
+      (const Graph& g,
+       typename graph_traits<Graph>::vertex_descriptor s,
+       DistanceMap distance, WeightMap weight, VertexIndexMap index,
+       const Params& params)
+    {
+      typedef typename property_traits<DistanceMap>::value_type D;
+      dummy_property_map predecessor_map;
+      D inf = choose_param(get_param(params, distance_inf_t()),
+                           (std::numeric_limits<D>::max)());
+      std::size_t num_threads =
+        choose_param(get_param(params, num_threads_t()), std::size_t(0));
+      delta_stepping_shortest_paths
+        (g, s,
+         choose_param(get_param(params, vertex_predecessor), predecessor_map),
+         distance, weight, index,
+         choose_param(get_param(params, delta_t()), D(0)), inf, num_threads);
+    }
+
+    template <typename Graph, typename DistanceMap, typename WeightMap,
+              typename VertexIndexMap, typename Params>
+    inline void
+    delta_stepping_dispatch1
+      (const Graph& g,
+       typename graph_traits<Graph>::vertex_descriptor s,
+       DistanceMap distance, WeightMap weight, VertexIndexMap index,
+       const Params& params)
+    {
+      // Default for distance map
+      typedef typename property_traits<WeightMap>::value_type D;
+      typename std::vector<D>::size_type
+        n = is_default_param(distance) ? num_vertices(g) : 1;
+      std::vector<D> default_distance_map(n);
+
+      detail::delta_stepping_dispatch2
+        (g, s, choose_param(distance,
+           make_iterator_property_map(default_distance_map.begin(), index,
+                                      default_distance_map[0])),
+         weight, index, params);
+    }
+
+  } // namespace detail
+
+  // Named parameter version: weight_map, distance_map, predecessor_map,
+  // vertex_index_map, distance_inf, delta and num_threads
+  template <typename Graph, typename Param, typename Tag, typename Rest>
+  inline void
+  delta_stepping_shortest_paths
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     const bgl_named_params<Param, Tag, Rest>& params)
+  {
+    detail::delta_stepping_dispatch1
+      (g, s,
+       get_param(params, vertex_distance),
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       params);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
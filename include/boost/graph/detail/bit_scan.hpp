@@ -0,0 +1,48 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DETAIL_BIT_SCAN_HPP
+#define BOOST_GRAPH_DETAIL_BIT_SCAN_HPP
+
+// Operations on the 64-bit words of the vertex bitsets used by
+// multi_source_bfs and degeneracy_all_cliques.
+
+#include <boost/cstdint.hpp>
+
+namespace boost {
+  namespace graph {
+    namespace detail {
+
+      // Index of the lowest set bit of x != 0
+      inline unsigned int lowest_bit(boost::uint64_t x)
+      {
+#if defined(__GNUC__)
+        return __builtin_ctzll((unsigned long long)x);
+#else
+        unsigned int i = 0;
+        for (; (x & 1) == 0; x >>= 1) ++i;
+        return i;
+#endif
+      }
+
+      // Number of set bits of x
+      inline unsigned int popcount(boost::uint64_t x)
+      {
+#if defined(__GNUC__)
+        return __builtin_popcountll((unsigned long long)x);
+#else
+        x -= (x >> 1) & 0x5555555555555555ULL;
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return (unsigned int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+      }
+
+    } // namespace detail
+  } // namespace graph
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_BIT_SCAN_HPP
@@ -31,6 +31,10 @@
 #include <boost/graph/filtered_graph.hpp> // For keep_all
 #include <boost/graph/detail/indexed_properties.hpp>
 #include <boost/graph/detail/histogram_sort.hpp>
+#include <boost/graph/detail/threading.hpp>
+#ifndef BOOST_GRAPH_NO_THREADS
+#include <boost/graph/detail/parallel_histogram_sort.hpp>
+#endif
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
@@ -172,6 +176,122 @@ namespace detail {
          source_pred, boost::make_property_map_function(global_to_local));
     }
 
+#ifndef BOOST_GRAPH_NO_THREADS
+    //  Rebuild graph from number of vertices and random-access unsorted list of
+    //  edges (filtered using source_pred and mapped using global_to_local),
+    //  using num_threads threads; the result is the same as that of
+    //  assign_unsorted_multi_pass_edges
+    template <typename RandomAccessIterator, typename GlobalToLocal, typename SourcePred>
+    void
+    assign_unsorted_edges_parallel(RandomAccessIterator edge_begin,
+                                   RandomAccessIterator edge_end,
+                                   vertices_size_type numlocalverts,
+                                   const GlobalToLocal& global_to_local,
+                                   const SourcePred& source_pred,
+                                   std::size_t num_threads) {
+      m_rowstart.clear();
+      m_rowstart.resize(numlocalverts + 1, 0);
+      typedef std::pair<vertices_size_type, vertices_size_type> edge_type;
+      typedef boost::transform_iterator<boost::graph::detail::project1st<edge_type>, RandomAccessIterator> source_iterator;
+      typedef boost::transform_iterator<boost::graph::detail::project2nd<edge_type>, RandomAccessIterator> target_iterator;
+      source_iterator sources_begin(edge_begin, boost::graph::detail::project1st<edge_type>());
+      source_iterator sources_end(edge_end, boost::graph::detail::project1st<edge_type>());
+      target_iterator targets_begin(edge_begin, boost::graph::detail::project2nd<edge_type>());
+
+      std::vector<std::vector<EdgeIndex> > insert_positions;
+      boost::graph::detail::parallel_count_starts
+        (sources_begin, sources_end, m_rowstart.begin(), numlocalverts,
+         source_pred, boost::make_property_map_function(global_to_local),
+         insert_positions, num_threads);
+
+      m_column.resize(m_rowstart.back());
+      inherited_edge_properties::resize(m_rowstart.back());
+
+      boost::graph::detail::parallel_histogram_sort
+        (sources_begin, sources_end, insert_positions, numlocalverts,
+         targets_begin, m_column.begin(),
+         source_pred, boost::make_property_map_function(global_to_local),
+         num_threads);
+    }
+
+    //  Rebuild graph from number of vertices and random-access unsorted list of
+    //  edges and their properties (filtered using source_pred and mapped using
+    //  global_to_local), using num_threads threads
+    template <typename RandomAccessIterator, typename EdgePropertyIterator, typename GlobalToLocal, typename SourcePred>
+    void
+    assign_unsorted_edges_parallel(RandomAccessIterator edge_begin,
+                                   RandomAccessIterator edge_end,
+                                   EdgePropertyIterator ep_iter,
+                                   vertices_size_type numlocalverts,
+                                   const GlobalToLocal& global_to_local,
+                                   const SourcePred& source_pred,
+                                   std::size_t num_threads) {
+      m_rowstart.clear();
+      m_rowstart.resize(numlocalverts + 1, 0);
+      typedef std::pair<vertices_size_type, vertices_size_type> edge_type;
+      typedef boost::transform_iterator<boost::graph::detail::project1st<edge_type>, RandomAccessIterator> source_iterator;
+      typedef boost::transform_iterator<boost::graph::detail::project2nd<edge_type>, RandomAccessIterator> target_iterator;
+      source_iterator sources_begin(edge_begin, boost::graph::detail::project1st<edge_type>());
+      source_iterator sources_end(edge_end, boost::graph::detail::project1st<edge_type>());
+      target_iterator targets_begin(edge_begin, boost::graph::detail::project2nd<edge_type>());
+
+      std::vector<std::vector<EdgeIndex> > insert_positions;
+      boost::graph::detail::parallel_count_starts
+        (sources_begin, sources_end, m_rowstart.begin(), numlocalverts,
+         source_pred, boost::make_property_map_function(global_to_local),
+         insert_positions, num_threads);
+
+      m_column.resize(m_rowstart.back());
+      inherited_edge_properties::resize(m_rowstart.back());
+
+      boost::graph::detail::parallel_histogram_sort
+        (sources_begin, sources_end, insert_positions, numlocalverts,
+         targets_begin, m_column.begin(),
+         ep_iter, inherited_edge_properties::begin(),
+         source_pred, boost::make_property_map_function(global_to_local),
+         num_threads);
+    }
+
+    //  Rebuild graph as the transpose of the CSR structure forward, storing
+    //  the index of each edge in forward as the edge property, using
+    //  num_threads threads.  The result is the same as building from the
+    //  transposed edges of forward in edge index order.
+    template <typename ForwardStructure>
+    void
+    assign_transpose_parallel(const ForwardStructure& forward,
+                              std::size_t num_threads) {
+      vertices_size_type numverts = forward.m_rowstart.size() - 1;
+      std::vector<Vertex> sources(forward.m_column.size());
+      boost::graph::detail::parallel_for_blocks(num_threads, numverts,
+        [&](std::size_t, vertices_size_type first, vertices_size_type last) {
+          for (vertices_size_type v = first; v < last; ++v)
+            std::fill(sources.begin() + forward.m_rowstart[v],
+                      sources.begin() + forward.m_rowstart[v + 1], v);
+        });
+
+      m_rowstart.clear();
+      m_rowstart.resize(numverts + 1, 0);
+      std::vector<std::vector<EdgeIndex> > insert_positions;
+      boost::graph::detail::parallel_count_starts
+        (forward.m_column.begin(), forward.m_column.end(), m_rowstart.begin(),
+         numverts, keep_all(),
+         boost::make_property_map_function(typed_identity_property_map<Vertex>()),
+         insert_positions, num_threads);
+
+      m_column.resize(m_rowstart.back());
+      inherited_edge_properties::resize(m_rowstart.back());
+
+      boost::graph::detail::parallel_histogram_sort
+        (forward.m_column.begin(), forward.m_column.end(), insert_positions,
+         numverts, sources.begin(), m_column.begin(),
+         boost::counting_iterator<EdgeIndex>(0),
+         inherited_edge_properties::begin(),
+         keep_all(),
+         boost::make_property_map_function(typed_identity_property_map<Vertex>()),
+         num_threads);
+    }
+#endif // BOOST_GRAPH_NO_THREADS
+
     //  Assign from number of vertices and sorted list of edges
     template<typename InputIterator, typename GlobalToLocal, typename SourcePred>
     void assign_from_sorted_edges(
@@ -0,0 +1,185 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Multithreaded counterparts of count_starts and histogram_sort from
+// histogram_sort.hpp.  The keys are split into one contiguous block per thread
+// and every thread keeps its own histogram, so the sort is stable: the output
+// is identical to that of the serial functions, whatever the thread count.
+// The price is num_threads * numkeys counters of temporary storage.
+
+#ifndef BOOST_GRAPH_DETAIL_PARALLEL_HISTOGRAM_SORT_HPP
+#define BOOST_GRAPH_DETAIL_PARALLEL_HISTOGRAM_SORT_HPP
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <iterator>
+#include <boost/assert.hpp>
+
+namespace boost {
+  namespace graph {
+    namespace detail {
+
+// Compute the row starts of a histogram sort of [key_begin, key_end), like
+// count_starts, using num_threads threads.  On return, insert_positions[t][k]
+// holds the position where the first key k of thread t's block of input goes;
+// pass it unchanged to parallel_histogram_sort with the same thread count.
+template <typename KeyIterator, typename RowstartIterator,
+          typename VerticesSize, typename KeyFilter, typename KeyTransform,
+          typename EdgeIndex>
+void
+parallel_count_starts
+  (KeyIterator begin, KeyIterator end,
+   RowstartIterator starts, // Must support numkeys + 1 elements
+   VerticesSize numkeys,
+   KeyFilter key_filter,
+   KeyTransform key_transform,
+   std::vector<std::vector<EdgeIndex> >& insert_positions,
+   std::size_t num_threads) {
+
+  typedef typename std::iterator_traits<KeyIterator>::difference_type
+    difference_type;
+  difference_type numentries = end - begin;
+
+  // Per-thread degree histograms over contiguous blocks of the input
+  insert_positions.clear();
+  insert_positions.resize(num_threads);
+  std::vector<std::vector<EdgeIndex> >& counts = insert_positions;
+  parallel_for_blocks(num_threads, numentries,
+    [&](std::size_t t, difference_type first, difference_type last) {
+      std::vector<EdgeIndex>& count = counts[t];
+      count.assign(numkeys, EdgeIndex(0));
+      for (KeyIterator i = begin + first; i != begin + last; ++i) {
+        if (key_filter(*i)) {
+          BOOST_ASSERT (key_transform(*i) < numkeys);
+          ++count[key_transform(*i)];
+        }
+      }
+    });
+
+  // Parallel prefix sum over the keys.  Each thread first sums the degrees of
+  // its block of keys, storing the degree of key k in starts[k + 1], and then
+  // turns its block into running totals once the sums of the preceding blocks
+  // are known.  The counters of each key are replaced by the position of the
+  // first entry of each thread along the way.
+  std::vector<EdgeIndex> block_totals(num_threads + 1, EdgeIndex(0));
+  parallel_for_blocks(num_threads, numkeys,
+    [&](std::size_t b, VerticesSize first, VerticesSize last) {
+      EdgeIndex block_total = 0;
+      for (VerticesSize k = first; k < last; ++k) {
+        EdgeIndex degree = 0;
+        for (std::size_t t = 0; t < num_threads; ++t) {
+          EdgeIndex c = counts[t][k];
+          counts[t][k] = degree;
+          degree += c;
+        }
+        starts[k + 1] = degree;
+        block_total += degree;
+      }
+      block_totals[b + 1] = block_total;
+    });
+  for (std::size_t b = 0; b < num_threads; ++b)
+    block_totals[b + 1] += block_totals[b];
+  starts[0] = EdgeIndex(0);
+  parallel_for_blocks(num_threads, numkeys,
+    [&](std::size_t b, VerticesSize first, VerticesSize last) {
+      EdgeIndex start_of_this_row = block_totals[b];
+      for (VerticesSize k = first; k < last; ++k) {
+        for (std::size_t t = 0; t < num_threads; ++t)
+          counts[t][k] += start_of_this_row;
+        start_of_this_row += starts[k + 1];
+        starts[k + 1] = start_of_this_row;
+      }
+    });
+}
+
+// Scatter values1_begin[i] to values1_out at the place of key i, like
+// histogram_sort; insert_positions comes from parallel_count_starts and is
+// consumed.
+template <typename KeyIterator, typename NumKeys,
+          typename Value1InputIter,
+          typename Value1OutputIter, typename KeyFilter, typename KeyTransform,
+          typename EdgeIndex>
+void
+parallel_histogram_sort(KeyIterator key_begin, KeyIterator key_end,
+                        std::vector<std::vector<EdgeIndex> >& insert_positions,
+                        NumKeys numkeys,
+                        Value1InputIter values1_begin,
+                        Value1OutputIter values1_out,
+                        KeyFilter key_filter,
+                        KeyTransform key_transform,
+                        std::size_t num_threads) {
+
+  typedef typename std::iterator_traits<KeyIterator>::difference_type
+    difference_type;
+  BOOST_ASSERT (insert_positions.size() == num_threads);
+  parallel_for_blocks(num_threads, difference_type(key_end - key_begin),
+    [&](std::size_t t, difference_type first, difference_type last) {
+      std::vector<EdgeIndex>& current_insert_positions = insert_positions[t];
+      Value1InputIter v1i = values1_begin + first;
+      for (KeyIterator i = key_begin + first; i != key_begin + last;
+           ++i, ++v1i) {
+        if (key_filter(*i)) {
+          NumKeys source = key_transform(*i);
+          BOOST_ASSERT (source < numkeys);
+          EdgeIndex insert_pos = current_insert_positions[source];
+          ++current_insert_positions[source];
+          values1_out[insert_pos] = *v1i;
+        }
+      }
+    });
+}
+
+template <typename KeyIterator, typename NumKeys,
+          typename Value1InputIter,
+          typename Value1OutputIter,
+          typename Value2InputIter,
+          typename Value2OutputIter,
+          typename KeyFilter, typename KeyTransform,
+          typename EdgeIndex>
+void
+parallel_histogram_sort(KeyIterator key_begin, KeyIterator key_end,
+                        std::vector<std::vector<EdgeIndex> >& insert_positions,
+                        NumKeys numkeys,
+                        Value1InputIter values1_begin,
+                        Value1OutputIter values1_out,
+                        Value2InputIter values2_begin,
+                        Value2OutputIter values2_out,
+                        KeyFilter key_filter,
+                        KeyTransform key_transform,
+                        std::size_t num_threads) {
+
+  typedef typename std::iterator_traits<KeyIterator>::difference_type
+    difference_type;
+  BOOST_ASSERT (insert_positions.size() == num_threads);
+  parallel_for_blocks(num_threads, difference_type(key_end - key_begin),
+    [&](std::size_t t, difference_type first, difference_type last) {
+      std::vector<EdgeIndex>& current_insert_positions = insert_positions[t];
+      Value1InputIter v1i = values1_begin + first;
+      Value2InputIter v2i = values2_begin + first;
+      for (KeyIterator i = key_begin + first; i != key_begin + last;
+           ++i, ++v1i, ++v2i) {
+        if (key_filter(*i)) {
+          NumKeys source = key_transform(*i);
+          BOOST_ASSERT (source < numkeys);
+          EdgeIndex insert_pos = current_insert_positions[source];
+          ++current_insert_positions[source];
+          values1_out[insert_pos] = *v1i;
+          values2_out[insert_pos] = *v2i;
+        }
+      }
+    });
+}
+
+    }
+  }
+}
+
+#endif // BOOST_GRAPH_DETAIL_PARALLEL_HISTOGRAM_SORT_HPP
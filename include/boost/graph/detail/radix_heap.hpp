@@ -0,0 +1,379 @@
+//
+//=======================================================================
+// Copyright 2026 Trustees of Indiana University
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+//
+#ifndef BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
+#define BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <boost/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // Number of significant bits of x (0 for x == 0)
+    template <typename Unsigned>
+    inline int radix_heap_bit_width(Unsigned x)
+    {
+#if defined(__GNUC__)
+      if (x == 0) return 0;
+      if (sizeof(Unsigned) <= sizeof(unsigned int))
+        return std::numeric_limits<unsigned int>::digits
+               - __builtin_clz((unsigned int)x);
+      return std::numeric_limits<unsigned long long>::digits
+             - __builtin_clzll((unsigned long long)x);
+#else
+      int width = 0;
+      for (; x != 0; x >>= 1) ++width;
+      return width;
+#endif
+    }
+
+  } // namespace detail
+
+  // Monotone radix heap (R. K. Ahuja, K. Mehlhorn, J. B. Orlin and
+  // R. E. Tarjan, "Faster algorithms for the shortest path problem", JACM
+  // 37(2), 1990) with the interface of d_ary_heap_indirect, for
+  // nonnegative integer keys.
+  //
+  // Bucket 0 holds the values whose key equals the last minimum removed,
+  // and bucket i > 0 those whose key first differs from it in bit i - 1.
+  // Inserting and decreasing a key are O(1); removing the minimum
+  // redistributes the lowest non-empty bucket into lower ones, and since a
+  // value only ever moves down, each one is moved at most once per bit of
+  // the key type.  Unlike a comparison heap this does not depend on the
+  // number of values in the heap, which is why it is faster than the 4-ary
+  // heap for Dijkstra's algorithm on integer weights.
+  //
+  // - The keys removed must come out in nondecreasing order, as they do in
+  //   Dijkstra's algorithm with nonnegative weights: a value pushed or
+  //   updated with a key lower than the last minimum removed is still
+  //   handled correctly, but costs a rebuild of the whole heap.
+  // - Value, IndexInHeapPropertyMap and DistanceMap have the same
+  //   requirements as for d_ary_heap_indirect; the key type must be an
+  //   integer type and all keys must be nonnegative.
+  // - Compare is only accepted for compatibility with d_ary_heap_indirect:
+  //   keys are always ordered by <.
+  //
+  template <typename Value,
+            typename IndexInHeapPropertyMap,
+            typename DistanceMap,
+            typename Compare = std::less<
+              typename property_traits<DistanceMap>::value_type> >
+  class radix_heap_indirect {
+    public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits<DistanceMap>::value_type key_type;
+    typedef DistanceMap key_map;
+
+    BOOST_STATIC_ASSERT (is_integral<key_type>::value);
+
+    private:
+    typedef typename make_unsigned<key_type>::type bits_type;
+    BOOST_STATIC_CONSTANT(size_type, num_buckets =
+                          std::numeric_limits<bits_type>::digits + 1);
+
+    public:
+    radix_heap_indirect(DistanceMap distance,
+                        IndexInHeapPropertyMap index_in_heap,
+                        const Compare& = Compare())
+      : m_size(0), m_last(0), distance(distance),
+        index_in_heap(index_in_heap) {}
+
+    size_type size() const {
+      return m_size;
+    }
+
+    bool empty() const {
+      return m_size == 0;
+    }
+
+    void push(const Value& v) {
+      bits_type k = key(v);
+      if (m_size == 0) m_last = k;
+      else if (k < m_last) rebuild(k);
+      insert(v, k);
+      ++m_size;
+    }
+
+    Value& top() {
+      BOOST_ASSERT (!this->empty());
+      if (buckets[0].empty()) refill();
+      return buckets[0].back();
+    }
+
+    const Value& top() const {
+      BOOST_ASSERT (!this->empty());
+      if (buckets[0].empty()) refill();
+      return buckets[0].back();
+    }
+
+    void pop() {
+      BOOST_ASSERT (!this->empty());
+      if (buckets[0].empty()) refill();
+      put(index_in_heap, buckets[0].back(), (size_type)(-1));
+      buckets[0].pop_back();
+      --m_size;
+    }
+
+    // This function assumes the key has been updated (using an external write
+    // to the distance map or such)
+    void update(const Value& v) { /* decrease-key */
+      erase(v);
+      --m_size;
+      push(v);
+    }
+
+    bool contains(const Value& v) const {
+      size_type index = get(index_in_heap, v);
+      return (index != (size_type)(-1));
+    }
+
+    void push_or_update(const Value& v) { /* insert if not present, else update */
+      if (contains(v)) update(v);
+      else push(v);
+    }
+
+    void clear() {
+      for (size_type b = 0; b < num_buckets; ++b) {
+        for (size_type i = 0; i < buckets[b].size(); ++i)
+          put(index_in_heap, buckets[b][i], (size_type)(-1));
+        buckets[b].clear();
+      }
+      m_size = 0;
+    }
+
+    DistanceMap keys() const {
+      return distance;
+    }
+
+    private:
+    // top() moves the values of the lowest non-empty bucket down when bucket
+    // 0 is empty, which changes neither the contents nor the order
+    mutable std::vector<Value> buckets[num_buckets];
+    size_type m_size;
+    mutable bits_type m_last;
+    DistanceMap distance;
+    IndexInHeapPropertyMap index_in_heap;
+
+    bits_type key(const Value& v) const {
+      BOOST_ASSERT (!(get(distance, v) < key_type(0)));
+      return bits_type(get(distance, v));
+    }
+
+    // The position of a value is stored as bucket + num_buckets * index
+    void insert(const Value& v, bits_type k) const {
+      size_type b = detail::radix_heap_bit_width(bits_type(k ^ m_last));
+      put(index_in_heap, v, b + num_buckets * buckets[b].size());
+      buckets[b].push_back(v);
+    }
+
+    void erase(const Value& v) {
+      size_type position = get(index_in_heap, v);
+      std::vector<Value>& bucket = buckets[position % num_buckets];
+      size_type i = position / num_buckets;
+      if (i + 1 != bucket.size()) {
+        bucket[i] = bucket.back();
+        put(index_in_heap, bucket[i], position);
+      }
+      bucket.pop_back();
+    }
+
+    // Make the smallest key the new reference and move the lowest non-empty
+    // bucket to lower ones, so that bucket 0 is not empty.  This is only done
+    // when the minimum is needed: the reference must stay at the last
+    // minimum removed until then, or the keys pushed meanwhile, which may be
+    // lower than the smallest key in the heap, would each cost a rebuild.
+    void refill() const {
+      size_type b = 1;
+      while (buckets[b].empty()) ++b;
+      std::vector<Value> moved;
+      moved.swap(buckets[b]);
+      m_last = key(moved[0]);
+      for (size_type i = 1; i < moved.size(); ++i)
+        if (key(moved[i]) < m_last) m_last = key(moved[i]);
+      for (size_type i = 0; i < moved.size(); ++i)
+        insert(moved[i], key(moved[i]));
+      // Every value moved to a lower bucket; keep the storage
+      moved.clear();
+      moved.swap(buckets[b]);
+    }
+
+    // Make k, which is below every key in the heap, the new reference
+    void rebuild(bits_type k) {
+      std::vector<Value> moved;
+      for (size_type b = 0; b < num_buckets; ++b) {
+        moved.insert(moved.end(), buckets[b].begin(), buckets[b].end());
+        buckets[b].clear();
+      }
+      m_last = k;
+      for (size_type i = 0; i < moved.size(); ++i)
+        insert(moved[i], key(moved[i]));
+    }
+  };
+
+  // Dial's bucket queue (R. B. Dial, "Algorithm 360: shortest-path forest
+  // with topological ordering", CACM 12(11), 1969) with the interface of
+  // d_ary_heap_indirect, for integer keys that all lie within max_span of
+  // the smallest one.
+  //
+  // Keys index a ring of max_span + 1 buckets, so every operation is O(1)
+  // apart from the search for the next non-empty bucket after removing the
+  // minimum, which visits at most max_span buckets.  With Dijkstra's
+  // algorithm, max_span is the largest edge weight and the search moves
+  // forward only; with Prim's algorithm it is also the largest edge weight,
+  // and the keys may decrease below the last minimum removed.
+  //
+  // - The requirements on the template parameters are those of
+  //   radix_heap_indirect.
+  // - All keys in the queue must lie in [m, m + max_span], where m is the
+  //   smallest one; this holds with Dijkstra's and Prim's algorithms when
+  //   max_span is at least the largest edge weight.
+  //
+  template <typename Value,
+            typename IndexInHeapPropertyMap,
+            typename DistanceMap,
+            typename Compare = std::less<
+              typename property_traits<DistanceMap>::value_type> >
+  class dial_queue_indirect {
+    public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits<DistanceMap>::value_type key_type;
+    typedef DistanceMap key_map;
+
+    BOOST_STATIC_ASSERT (is_integral<key_type>::value);
+
+    private:
+    typedef typename make_unsigned<key_type>::type bits_type;
+
+    public:
+    dial_queue_indirect(DistanceMap distance,
+                        IndexInHeapPropertyMap index_in_heap,
+                        key_type max_span,
+                        const Compare& = Compare())
+      : buckets(size_type(max_span) + 1), m_size(0), m_current(0),
+        distance(distance), index_in_heap(index_in_heap) {}
+
+    size_type size() const {
+      return m_size;
+    }
+
+    bool empty() const {
+      return m_size == 0;
+    }
+
+    void push(const Value& v) {
+      bits_type k = key(v);
+      if (m_size == 0 || k < m_current) m_current = k;
+      insert(v, k);
+      ++m_size;
+    }
+
+    Value& top() {
+      BOOST_ASSERT (!this->empty());
+      return current_bucket().back();
+    }
+
+    const Value& top() const {
+      BOOST_ASSERT (!this->empty());
+      return buckets[size_type(m_current % buckets.size())].back();
+    }
+
+    void pop() {
+      BOOST_ASSERT (!this->empty());
+      put(index_in_heap, current_bucket().back(), (size_type)(-1));
+      current_bucket().pop_back();
+      if (--m_size != 0) advance();
+    }
+
+    // This function assumes the key has been updated (using an external write
+    // to the distance map or such)
+    void update(const Value& v) { /* decrease-key */
+      erase(v);
+      --m_size;
+      push(v);
+      advance();
+    }
+
+    bool contains(const Value& v) const {
+      size_type index = get(index_in_heap, v);
+      return (index != (size_type)(-1));
+    }
+
+    void push_or_update(const Value& v) { /* insert if not present, else update */
+      if (contains(v)) update(v);
+      else push(v);
+    }
+
+    void clear() {
+      for (size_type b = 0; b < buckets.size(); ++b) {
+        for (size_type i = 0; i < buckets[b].size(); ++i)
+          put(index_in_heap, buckets[b][i], (size_type)(-1));
+        buckets[b].clear();
+      }
+      m_size = 0;
+    }
+
+    DistanceMap keys() const {
+      return distance;
+    }
+
+    private:
+    std::vector<std::vector<Value> > buckets;
+    size_type m_size;
+    bits_type m_current;
+    DistanceMap distance;
+    IndexInHeapPropertyMap index_in_heap;
+
+    bits_type key(const Value& v) const {
+      BOOST_ASSERT (!(get(distance, v) < key_type(0)));
+      return bits_type(get(distance, v));
+    }
+
+    std::vector<Value>& current_bucket() {
+      return buckets[size_type(m_current % buckets.size())];
+    }
+
+    // The position of a value is stored as bucket + buckets.size() * index
+    void insert(const Value& v, bits_type k) {
+      size_type b = size_type(k % buckets.size());
+      BOOST_ASSERT (size_type(bits_type(k - m_current)) < buckets.size());
+      put(index_in_heap, v, b + buckets.size() * buckets[b].size());
+      buckets[b].push_back(v);
+    }
+
+    void erase(const Value& v) {
+      size_type position = get(index_in_heap, v);
+      std::vector<Value>& bucket = buckets[position % buckets.size()];
+      size_type i = position / buckets.size();
+      if (i + 1 != bucket.size()) {
+        bucket[i] = bucket.back();
+        put(index_in_heap, bucket[i], position);
+      }
+      bucket.pop_back();
+    }
+
+    // Move to the bucket of the smallest key
+    void advance() {
+      while (current_bucket().empty()) ++m_current;
+    }
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
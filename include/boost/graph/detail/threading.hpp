@@ -0,0 +1,217 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Minimal shared-memory threading support used by the multithreaded
+// algorithms of the BGL.  This is an internal detail: it requires the C++11
+// <thread>, <atomic>, <mutex> and <condition_variable> headers.  When those
+// are missing, BOOST_GRAPH_NO_THREADS is defined instead and the
+// multithreaded algorithms are unavailable.
+
+#ifndef BOOST_GRAPH_DETAIL_THREADING_HPP
+#define BOOST_GRAPH_DETAIL_THREADING_HPP
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_HDR_ATOMIC) \
+ || defined(BOOST_NO_CXX11_HDR_MUTEX) \
+ || defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) \
+ || defined(BOOST_NO_CXX11_HDR_EXCEPTION)
+#define BOOST_GRAPH_NO_THREADS
+#else
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
+#include <boost/assert.hpp>
+
+namespace boost {
+  namespace graph {
+    namespace detail {
+
+// Number of threads to use when the caller asks for "as many as possible"
+// (num_threads == 0).
+inline std::size_t default_num_threads()
+{
+  unsigned int n = std::thread::hardware_concurrency();
+  return n == 0 ? 1 : n;
+}
+
+inline std::size_t resolve_num_threads(std::size_t num_threads)
+{
+  return num_threads == 0 ? default_num_threads() : num_threads;
+}
+
+// Split [0, n) into num_parts contiguous blocks whose sizes differ by at most
+// one, and return the beginning of block i (block_begin(n, p, p) == n).
+template <typename Size>
+inline Size block_begin(Size n, std::size_t num_parts, std::size_t i)
+{
+  Size q = n / Size(num_parts), r = n % Size(num_parts);
+  return q * Size(i) + (std::min)(Size(i), r);
+}
+
+// Reusable barrier for a fixed set of threads.
+class thread_barrier
+{
+ public:
+  explicit thread_barrier(std::size_t count)
+    : m_count(count), m_waiting(0), m_generation(0) {}
+
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::size_t generation = m_generation;
+    if (++m_waiting == m_count) {
+      m_waiting = 0;
+      ++m_generation;
+      m_cond.notify_all();
+    } else {
+      while (generation == m_generation)
+        m_cond.wait(lock);
+    }
+  }
+
+ private:
+  thread_barrier(const thread_barrier&);
+  thread_barrier& operator=(const thread_barrier&);
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::size_t m_count;
+  std::size_t m_waiting;
+  std::size_t m_generation;
+};
+
+// Run f(thread_id) for thread_id in [0, num_threads), using the calling thread
+// as thread 0, and wait for all of them.  If any invocation throws, the first
+// exception caught is rethrown in the calling thread once every thread has
+// finished.  Functions that synchronize through a thread_barrier must not
+// throw between barriers, or the other threads will wait forever.
+template <typename Function>
+void run_in_parallel(std::size_t num_threads, Function f)
+{
+  BOOST_ASSERT (num_threads > 0);
+  if (num_threads == 1) {
+    f(std::size_t(0));
+    return;
+  }
+
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  struct worker {
+    Function* f;
+    std::exception_ptr* error;
+    std::mutex* error_mutex;
+    std::size_t id;
+    void operator()() const {
+      try {
+        (*f)(id);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(*error_mutex);
+        if (!*error) *error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (std::size_t t = 1; t < num_threads; ++t) {
+    worker w = {&f, &error, &error_mutex, t};
+    threads.push_back(std::thread(w));
+  }
+  worker self = {&f, &error, &error_mutex, 0};
+  self();
+  for (std::size_t t = 0; t < threads.size(); ++t)
+    threads[t].join();
+  if (error) std::rethrow_exception(error);
+}
+
+// Hands out chunks of [first, last) to the threads that ask for them.  Each
+// call to next() claims the next unprocessed chunk, so threads that finish
+// early keep taking work from the shared range instead of idling (dynamic
+// self-scheduling).
+template <typename Index>
+class chunk_dispenser
+{
+ public:
+  chunk_dispenser(Index first, Index last, Index grain)
+    : m_next(first), m_last(last), m_grain(grain == 0 ? 1 : grain) {}
+
+  // Claim the next chunk; returns false when the range is exhausted.
+  bool next(Index& chunk_begin, Index& chunk_end)
+  {
+    Index b = m_next.fetch_add(m_grain, std::memory_order_relaxed);
+    if (b >= m_last) return false;
+    chunk_begin = b;
+    chunk_end = (m_last - b < m_grain) ? m_last : b + m_grain;
+    return true;
+  }
+
+  // Start handing out [first, last); must not race with next().
+  void reset(Index first, Index last)
+  {
+    m_next.store(first, std::memory_order_relaxed);
+    m_last = last;
+  }
+
+ private:
+  std::atomic<Index> m_next;
+  Index m_last;
+  Index m_grain;
+};
+
+// Call f(thread_id, chunk_begin, chunk_end) on dynamically scheduled chunks of
+// [first, last), using num_threads threads.
+template <typename Index, typename Function>
+void parallel_for(std::size_t num_threads, Index first, Index last,
+                  Index grain, Function f)
+{
+  if (first >= last) return;
+  chunk_dispenser<Index> chunks(first, last, grain);
+  struct body {
+    chunk_dispenser<Index>* chunks;
+    Function* f;
+    void operator()(std::size_t thread_id) const {
+      Index b, e;
+      while (chunks->next(b, e)) (*f)(thread_id, b, e);
+    }
+  };
+  body b = {&chunks, &f};
+  run_in_parallel(num_threads, b);
+}
+
+// Call f(thread_id, block_begin, block_end) once per thread on a static,
+// contiguous partition of [0, n).  Use this instead of parallel_for when the
+// assignment of indices to threads must be deterministic.
+template <typename Size, typename Function>
+void parallel_for_blocks(std::size_t num_threads, Size n, Function f)
+{
+  struct body {
+    Size n;
+    std::size_t num_threads;
+    Function* f;
+    void operator()(std::size_t thread_id) const {
+      (*f)(thread_id,
+           block_begin(n, num_threads, thread_id),
+           block_begin(n, num_threads, thread_id + 1));
+    }
+  };
+  body b = {n, num_threads, &f};
+  run_in_parallel(num_threads, b);
+}
+
+    } // namespace detail
+  } // namespace graph
+} // namespace boost
+
+#endif // thread support
+
+#endif // BOOST_GRAPH_DETAIL_THREADING_HPP
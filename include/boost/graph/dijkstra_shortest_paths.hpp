@@ -25,11 +25,13 @@
 #include <boost/graph/overloading.hpp>
 #include <boost/smart_ptr.hpp>
 #include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/radix_heap.hpp>
 #include <boost/graph/two_bit_color_map.hpp>
 #include <boost/graph/detail/mpi_include.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/property_map/vector_property_map.hpp>
 #include <boost/type_traits.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
 
 #ifdef BOOST_GRAPH_DIJKSTRA_TESTING
@@ -242,6 +244,103 @@ namespace boost {
     };
   }
 
+  namespace detail {
+    struct d_ary_heap_queue_tag {};
+    struct radix_heap_queue_tag {};
+    struct dial_queue_tag {};
+
+    // Kind of priority queue used by the Dijkstra variants and A*, from the
+    // distance type and the compare and combine functions: the 4-ary heap
+    // in general, and a radix heap when the distances are unsigned integers
+    // added and compared as usual, since their minima then come out in
+    // nondecreasing order.  Prim's algorithm selects the Dial queue for
+    // small unsigned weights.
+    template <class Distance, class Compare, class Combine,
+              bool IsUnsigned = is_integral<Distance>::value
+                                && !is_signed<Distance>::value
+                                && !is_same<Distance, bool>::value>
+    struct dijkstra_queue_kind {
+      typedef d_ary_heap_queue_tag type;
+    };
+
+    template <class Distance>
+    struct dijkstra_queue_kind<Distance, std::less<Distance>,
+                               closed_plus<Distance>, true> {
+      typedef radix_heap_queue_tag type;
+    };
+
+    template <class Distance>
+    struct dijkstra_queue_kind<Distance, std::less<Distance>,
+                               std::plus<Distance>, true> {
+      typedef radix_heap_queue_tag type;
+    };
+
+    template <class Graph, class IndexMap, class DistanceMap, class Compare,
+              class Kind>
+    struct dijkstra_queue_generator {};
+
+    template <class Graph, class IndexMap, class DistanceMap, class Compare>
+    struct dijkstra_queue_generator<Graph, IndexMap, DistanceMap, Compare,
+                                    d_ary_heap_queue_tag> {
+      typedef vertex_property_map_generator<Graph, IndexMap, std::size_t>
+        IndexInHeapMapHelper;
+      typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+      typedef d_ary_heap_indirect<typename graph_traits<Graph>::vertex_descriptor,
+                                  4, IndexInHeapMap, DistanceMap, Compare> type;
+      template <class WeightMap>
+      static type build(const Graph& g, const IndexMap& index,
+                        DistanceMap distance, const Compare& compare,
+                        WeightMap, boost::scoped_array<std::size_t>& holder) {
+        return type(distance, IndexInHeapMapHelper::build(g, index, holder),
+                    compare);
+      }
+    };
+
+    template <class Graph, class IndexMap, class DistanceMap, class Compare>
+    struct dijkstra_queue_generator<Graph, IndexMap, DistanceMap, Compare,
+                                    radix_heap_queue_tag> {
+      typedef vertex_property_map_generator<Graph, IndexMap, std::size_t>
+        IndexInHeapMapHelper;
+      typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+      typedef radix_heap_indirect<typename graph_traits<Graph>::vertex_descriptor,
+                                  IndexInHeapMap, DistanceMap, Compare> type;
+      template <class WeightMap>
+      static type build(const Graph& g, const IndexMap& index,
+                        DistanceMap distance, const Compare& compare,
+                        WeightMap, boost::scoped_array<std::size_t>& holder) {
+        return type(distance, IndexInHeapMapHelper::build(g, index, holder),
+                    compare);
+      }
+    };
+
+    // The keys span at most the largest edge weight
+    template <class Graph, class IndexMap, class DistanceMap, class Compare>
+    struct dijkstra_queue_generator<Graph, IndexMap, DistanceMap, Compare,
+                                    dial_queue_tag> {
+      typedef vertex_property_map_generator<Graph, IndexMap, std::size_t>
+        IndexInHeapMapHelper;
+      typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+      typedef dial_queue_indirect<typename graph_traits<Graph>::vertex_descriptor,
+                                  IndexInHeapMap, DistanceMap, Compare> type;
+      template <class WeightMap>
+      static type build(const Graph& g, const IndexMap& index,
+                        DistanceMap distance, const Compare& compare,
+                        WeightMap weight,
+                        boost::scoped_array<std::size_t>& holder) {
+        typedef typename property_traits<DistanceMap>::value_type D;
+        D max_weight = D();
+        typename graph_traits<Graph>::vertex_iterator ui, ui_end;
+        for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui) {
+          typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(*ui, g); ei != ei_end; ++ei)
+            if (max_weight < D(get(weight, *ei))) max_weight = get(weight, *ei);
+        }
+        return type(distance, IndexInHeapMapHelper::build(g, index, holder),
+                    max_weight, compare);
+      }
+    };
+  }
+
   namespace detail {
     template <class Graph, class IndexMap, bool KnownNumVertices>
     struct default_color_map_generator_helper {};
@@ -321,6 +420,29 @@ namespace boost {
                                     vis);
   }
 
+  // Call breadth first search with the given queue, such as a
+  // d_ary_heap_indirect, radix_heap_indirect or dial_queue_indirect keyed on
+  // the distance map
+  template <class Graph, class SourceInputIter, class DijkstraVisitor,
+            class PredecessorMap, class DistanceMap,
+            class WeightMap, class IndexMap, class Compare, class Combine,
+            class DistZero, class ColorMap, class UpdatableQueue>
+  inline void
+  dijkstra_shortest_paths_no_init
+    (const Graph& g,
+     SourceInputIter s_begin, SourceInputIter s_end,
+     PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+     IndexMap /*index_map*/,
+     Compare compare, Combine combine, DistZero zero,
+     DijkstraVisitor vis, ColorMap color, UpdatableQueue& Q)
+  {
+    detail::dijkstra_bfs_visitor<DijkstraVisitor, UpdatableQueue, WeightMap,
+      PredecessorMap, DistanceMap, Combine, Compare>
+        bfs_vis(vis, Q, weight, predecessor, distance, combine, compare, zero);
+
+    breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, color);
+  }
+
   // Call breadth first search
   template <class Graph, class SourceInputIter, class DijkstraVisitor,
             class PredecessorMap, class DistanceMap,
@@ -335,28 +457,20 @@ namespace boost {
      Compare compare, Combine combine, DistZero zero,
      DijkstraVisitor vis, ColorMap color)
   {
-    typedef indirect_cmp<DistanceMap, Compare> IndirectCmp;
-    IndirectCmp icmp(distance, compare);
-
-    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
-
-    // Now the default: use a d-ary heap
-      boost::scoped_array<std::size_t> index_in_heap_map_holder;
-      typedef
-        detail::vertex_property_map_generator<Graph, IndexMap, std::size_t>
-        IndexInHeapMapHelper;
-      typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
-      IndexInHeapMap index_in_heap =
-        IndexInHeapMapHelper::build(g, index_map, index_in_heap_map_holder);
-      typedef d_ary_heap_indirect<Vertex, 4, IndexInHeapMap, DistanceMap, Compare>
-        MutableQueue;
-      MutableQueue Q(distance, index_in_heap, compare);
+    // Default: a radix heap for unsigned integer distances, a d-ary heap
+    // otherwise
+    typedef typename property_traits<DistanceMap>::value_type D;
+    typedef detail::dijkstra_queue_generator<Graph, IndexMap, DistanceMap,
+      Compare, typename detail::dijkstra_queue_kind<D, Compare, Combine>::type>
+      QueueGenerator;
+    boost::scoped_array<std::size_t> index_in_heap_map_holder;
+    typename QueueGenerator::type Q =
+      QueueGenerator::build(g, index_map, distance, compare, weight,
+                            index_in_heap_map_holder);
 
-    detail::dijkstra_bfs_visitor<DijkstraVisitor, MutableQueue, WeightMap,
-      PredecessorMap, DistanceMap, Combine, Compare>
-        bfs_vis(vis, Q, weight, predecessor, distance, combine, compare, zero);
-
-    breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, color);
+    dijkstra_shortest_paths_no_init(g, s_begin, s_end, predecessor, distance,
+                                    weight, index_map, compare, combine, zero,
+                                    vis, color, Q);
   }
 
   // Call breadth first search
@@ -570,6 +684,110 @@ namespace boost {
                              distance_map[0])),
          weight, index_map, params);
     }
+
+    // Queue over the index-in-heap map of a search_workspace.  The Dial
+    // queue would have to scan the edges for the largest weight on every
+    // call, so the d-ary heap replaces it.
+    template <class Vertex, class IndexInHeapMap, class DistanceMap,
+              class Compare, class Kind>
+    struct dijkstra_workspace_queue {
+      typedef d_ary_heap_indirect<Vertex, 4, IndexInHeapMap, DistanceMap,
+                                  Compare> type;
+    };
+
+    template <class Vertex, class IndexInHeapMap, class DistanceMap,
+              class Compare>
+    struct dijkstra_workspace_queue<Vertex, IndexInHeapMap, DistanceMap,
+                                    Compare, radix_heap_queue_tag> {
+      typedef radix_heap_indirect<Vertex, IndexInHeapMap, DistanceMap,
+                                  Compare> type;
+    };
+
+    template <class Graph, class Workspace, class WeightMap, class Compare,
+              class Combine, class DistZero, class DijkstraVisitor>
+    inline void
+    dijkstra_with_workspace
+      (const Graph& g,
+       typename graph_traits<Graph>::vertex_descriptor s,
+       Workspace& workspace, WeightMap weight, Compare compare,
+       Combine combine, DistZero zero, DijkstraVisitor vis)
+    {
+      typedef typename Workspace::distance_type D;
+      typedef typename Workspace::distance_map_type DistanceMap;
+      typedef typename dijkstra_workspace_queue<
+        typename graph_traits<Graph>::vertex_descriptor,
+        typename Workspace::index_in_heap_map_type, DistanceMap, Compare,
+        typename dijkstra_queue_kind<D, Compare, Combine>::type>::type Queue;
+      // The distances are sums of weights: a workspace of another type
+      // would convert them, and truncate fractional weights
+      BOOST_STATIC_ASSERT((is_same<typename property_traits<WeightMap>
+                                     ::value_type, D>::value));
+
+      DistanceMap distance = workspace.distance_map();
+      Queue Q(distance, workspace.index_in_heap_map(), compare);
+      vis.initialize_vertex(s, g);
+      put(distance, s, zero);
+      dijkstra_shortest_paths_no_init
+        (g, &s, &s + 1, workspace.predecessor_map(), distance, weight,
+         workspace.vertex_index_map(), compare, combine, zero,
+         make_search_workspace_visitor(vis, workspace),
+         workspace.color_map(), Q);
+    }
+
+    template <class VertexListGraph, class Params>
+    inline void
+    dijkstra_dispatch0
+      (const VertexListGraph& g,
+       typename graph_traits<VertexListGraph>::vertex_descriptor s,
+       const Params& params, param_not_found)
+    {
+      // Default for edge weight and vertex index map is to ask for them
+      // from the graph.  Default for the visitor is null_visitor.
+      detail::dijkstra_dispatch1
+        (g, s,
+         get_param(params, vertex_distance),
+         choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+         choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+         params);
+    }
+
+    // The distances, predecessors, colors and queue positions live in the
+    // workspace, which starts a new generation instead of initializing
+    // every vertex, and the visitor sees initialize_vertex for a vertex
+    // only when the search first gets to it.  The workspace has its own
+    // maps, index map and infinity, so those parameters cannot be given.
+    template <class VertexListGraph, class Params, class Workspace>
+    inline void
+    dijkstra_dispatch0
+      (const VertexListGraph& g,
+       typename graph_traits<VertexListGraph>::vertex_descriptor s,
+       const Params& params, boost::reference_wrapper<Workspace> workspace)
+    {
+      BOOST_STATIC_ASSERT((is_same<typename get_param_type<vertex_distance_t,
+                             Params>::type, param_not_found>::value));
+      BOOST_STATIC_ASSERT((is_same<typename get_param_type<vertex_color_t,
+                             Params>::type, param_not_found>::value));
+      BOOST_STATIC_ASSERT((is_same<typename get_param_type<
+                             vertex_predecessor_t, Params>::type,
+                             param_not_found>::value));
+      BOOST_STATIC_ASSERT((is_same<typename get_param_type<vertex_index_t,
+                             Params>::type, param_not_found>::value));
+      BOOST_STATIC_ASSERT((is_same<typename get_param_type<distance_inf_t,
+                             Params>::type, param_not_found>::value));
+      typedef typename Workspace::distance_type D;
+      Workspace& w = workspace.get();
+      w.reset();
+      dijkstra_with_workspace
+        (g, s, w,
+         choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+         choose_param(get_param(params, distance_compare_t()),
+                      std::less<D>()),
+         choose_param(get_param(params, distance_combine_t()),
+                      closed_plus<D>(w.distance_inf())),
+         choose_param(get_param(params, distance_zero_t()), D()),
+         choose_param(get_param(params, graph_visitor),
+                      make_dijkstra_visitor(null_visitor())));
+    }
   } // namespace detail
 
   // Named Parameter Variant
@@ -580,14 +798,8 @@ namespace boost {
      typename graph_traits<VertexListGraph>::vertex_descriptor s,
      const bgl_named_params<Param,Tag,Rest>& params)
   {
-    // Default for edge weight and vertex index map is to ask for them
-    // from the graph.  Default for the visitor is null_visitor.
-    detail::dijkstra_dispatch1
-      (g, s,
-       get_param(params, vertex_distance),
-       choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
-       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
-       params);
+    detail::dijkstra_dispatch0(g, s, params,
+                               get_param(params, search_workspace_t()));
   }
 
 } // namespace boost
@@ -14,53 +14,37 @@
 #include <boost/pending/indirect_cmp.hpp>
 #include <boost/graph/relax.hpp>
 #include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/radix_heap.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/iteration_macros.hpp>
 
 namespace boost {
 
-  // No init version
+  // No init version with the given queue, such as a d_ary_heap_indirect,
+  // radix_heap_indirect or dial_queue_indirect keyed on the distance map
   template <typename Graph, typename DijkstraVisitor,
             typename PredecessorMap, typename DistanceMap,
             typename WeightMap, typename VertexIndexMap,
             typename DistanceCompare, typename DistanceWeightCombine,
-            typename DistanceInfinity, typename DistanceZero>
+            typename DistanceInfinity, typename DistanceZero,
+            typename VertexQueue>
   void dijkstra_shortest_paths_no_color_map_no_init
     (const Graph& graph,
      typename graph_traits<Graph>::vertex_descriptor start_vertex,
      PredecessorMap predecessor_map,
      DistanceMap distance_map,
      WeightMap weight_map,
-     VertexIndexMap index_map,
+     VertexIndexMap /*index_map*/,
      DistanceCompare distance_compare,
      DistanceWeightCombine distance_weight_combine,
      DistanceInfinity distance_infinity,
      DistanceZero distance_zero,
-     DijkstraVisitor visitor)
+     DijkstraVisitor visitor,
+     VertexQueue& vertex_queue)
   {
     typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
     typedef typename property_traits<DistanceMap>::value_type Distance;
 
-    typedef indirect_cmp<DistanceMap, DistanceCompare> DistanceIndirectCompare;
-    DistanceIndirectCompare
-      distance_indirect_compare(distance_map, distance_compare);
-
-
-    // Default - use d-ary heap (d = 4)
-    typedef
-      detail::vertex_property_map_generator<Graph, VertexIndexMap, std::size_t>
-      IndexInHeapMapHelper;
-    typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
-    typedef
-      d_ary_heap_indirect<Vertex, 4, IndexInHeapMap, DistanceMap, DistanceCompare>
-      VertexQueue;
-
-    boost::scoped_array<std::size_t> index_in_heap_map_holder;
-    IndexInHeapMap index_in_heap =
-      IndexInHeapMapHelper::build(graph, index_map,
-                                  index_in_heap_map_holder);
-    VertexQueue vertex_queue(distance_map, index_in_heap, distance_compare);
-
     // Add vertex to the queue
     vertex_queue.push(start_vertex);
 
@@ -119,6 +103,44 @@ namespace boost {
     } // end while queue not empty
   }
 
+  // No init version
+  template <typename Graph, typename DijkstraVisitor,
+            typename PredecessorMap, typename DistanceMap,
+            typename WeightMap, typename VertexIndexMap,
+            typename DistanceCompare, typename DistanceWeightCombine,
+            typename DistanceInfinity, typename DistanceZero>
+  void dijkstra_shortest_paths_no_color_map_no_init
+    (const Graph& graph,
+     typename graph_traits<Graph>::vertex_descriptor start_vertex,
+     PredecessorMap predecessor_map,
+     DistanceMap distance_map,
+     WeightMap weight_map,
+     VertexIndexMap index_map,
+     DistanceCompare distance_compare,
+     DistanceWeightCombine distance_weight_combine,
+     DistanceInfinity distance_infinity,
+     DistanceZero distance_zero,
+     DijkstraVisitor visitor)
+  {
+    // Default: a radix heap for unsigned integer distances, a d-ary heap
+    // (d = 4) otherwise
+    typedef typename property_traits<DistanceMap>::value_type Distance;
+    typedef detail::dijkstra_queue_generator<Graph, VertexIndexMap,
+      DistanceMap, DistanceCompare,
+      typename detail::dijkstra_queue_kind<Distance, DistanceCompare,
+                                           DistanceWeightCombine>::type>
+      QueueGenerator;
+    boost::scoped_array<std::size_t> index_in_heap_map_holder;
+    typename QueueGenerator::type vertex_queue =
+      QueueGenerator::build(graph, index_map, distance_map, distance_compare,
+                            weight_map, index_in_heap_map_holder);
+
+    dijkstra_shortest_paths_no_color_map_no_init
+      (graph, start_vertex, predecessor_map, distance_map, weight_map,
+       index_map, distance_compare, distance_weight_combine,
+       distance_infinity, distance_zero, visitor, vertex_queue);
+  }
+
   // Full init version
   template <typename Graph, typename DijkstraVisitor,
             typename PredecessorMap, typename DistanceMap,
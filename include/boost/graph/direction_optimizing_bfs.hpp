@@ -0,0 +1,171 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DIRECTION_OPTIMIZING_BFS_HPP
+#define BOOST_GRAPH_DIRECTION_OPTIMIZING_BFS_HPP
+
+/*
+ * Direction-optimizing breadth-first search (Beamer, Asanovic and
+ * Patterson, "Direction-Optimizing Breadth-First Search", SC 2012).
+ *
+ * Each level of the search is expanded either top-down, by scanning the
+ * out-edges of the vertices of the frontier (a queue), or bottom-up, by
+ * scanning the in-edges of the unvisited vertices until one of them comes
+ * from the frontier (a bitmap).  Bottom-up steps stop at the first parent
+ * found, so they examine far fewer edges when the frontier holds a large
+ * part of the graph, as happens in the middle levels of a search on a
+ * low-diameter graph.
+ */
+
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // Sum of the out-degrees of the vertices of a top-down frontier
+    template <typename Graph, typename Vertex>
+    typename graph_traits<Graph>::edges_size_type
+    frontier_out_degree(const Graph& g, const std::vector<Vertex>& frontier)
+    {
+      typename graph_traits<Graph>::edges_size_type m = 0;
+      for (std::size_t i = 0; i < frontier.size(); ++i)
+        m += out_degree(frontier[i], g);
+      return m;
+    }
+
+  } // namespace detail
+
+  // alpha and beta are the switching thresholds of the paper: the search
+  // goes bottom-up when the frontier has more than 1/alpha of the edges left
+  // to check, and back top-down when the frontier is shrinking and has less
+  // than 1/beta of the vertices.
+  template <typename Graph, typename DistanceMap, typename PredecessorMap,
+            typename VertexIndexMap>
+  void
+  direction_optimizing_bfs
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     DistanceMap distance, PredecessorMap predecessor,
+     VertexIndexMap index, double alpha = 14, double beta = 24)
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef graph_traits<Graph> Traits;
+    typedef typename Traits::vertex_descriptor Vertex;
+    typedef typename Traits::edges_size_type edges_size_type;
+    typedef typename property_traits<DistanceMap>::value_type distance_type;
+
+    std::size_t n = num_vertices(g);
+    std::vector<bool> visited(n, false);
+    std::vector<bool> in_frontier, in_next;
+    std::vector<Vertex> frontier, next;
+
+    put(distance, s, distance_type(0));
+    put(predecessor, s, s);
+    visited[get(index, s)] = true;
+    frontier.push_back(s);
+
+    // Out-edges of the frontier and of the unvisited vertices, and number
+    // of vertices in the frontier and in the one before.  Out-degrees are
+    // summed rather than taken from num_edges(g) so that undirected edges
+    // count twice.
+    edges_size_type frontier_edges = out_degree(s, g);
+    edges_size_type edges_to_check = 0;
+    typename Traits::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      edges_to_check += out_degree(*vi, g);
+    edges_to_check -= frontier_edges;
+    std::size_t frontier_size = 1, last_frontier_size = 0;
+    bool bottom_up = false;
+    distance_type level = 0;
+
+    while (frontier_size != 0) {
+      ++level;
+      if (!bottom_up) {
+        if (double(frontier_edges) > double(edges_to_check) / alpha) {
+          // Switch to a bitmap frontier
+          bottom_up = true;
+          in_frontier.assign(n, false);
+          for (std::size_t i = 0; i < frontier.size(); ++i)
+            in_frontier[get(index, frontier[i])] = true;
+          frontier.clear();
+        }
+      } else if (frontier_size < last_frontier_size
+                 && double(frontier_size) < double(n) / beta) {
+        // Switch back to a queue once the search is past its widest levels;
+        // a small frontier that is still growing stays bottom-up
+        bottom_up = false;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+          if (in_frontier[get(index, *vi)]) frontier.push_back(*vi);
+      }
+
+      last_frontier_size = frontier_size;
+      frontier_edges = 0;
+      frontier_size = 0;
+      if (!bottom_up) {
+        next.clear();
+        for (std::size_t i = 0; i < frontier.size(); ++i) {
+          Vertex u = frontier[i];
+          typename Traits::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei) {
+            Vertex v = target(*ei, g);
+            if (!visited[get(index, v)]) {
+              visited[get(index, v)] = true;
+              put(distance, v, level);
+              put(predecessor, v, u);
+              next.push_back(v);
+            }
+          }
+        }
+        frontier.swap(next);
+        frontier_edges = detail::frontier_out_degree(g, frontier);
+        frontier_size = frontier.size();
+      } else {
+        in_next.assign(n, false);
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+          Vertex v = *vi;
+          if (visited[get(index, v)]) continue;
+          typename Traits::in_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = in_edges(v, g); ei != ei_end; ++ei) {
+            Vertex u = source(*ei, g);
+            if (in_frontier[get(index, u)]) {
+              visited[get(index, v)] = true;
+              in_next[get(index, v)] = true;
+              put(distance, v, level);
+              put(predecessor, v, u);
+              frontier_edges += out_degree(v, g);
+              ++frontier_size;
+              break;
+            }
+          }
+        }
+        in_frontier.swap(in_next);
+      }
+      edges_to_check -= frontier_edges;
+    }
+  }
+
+  template <typename Graph, typename DistanceMap, typename PredecessorMap>
+  void
+  direction_optimizing_bfs
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     DistanceMap distance, PredecessorMap predecessor)
+  {
+    direction_optimizing_bfs(g, s, distance, predecessor,
+                             get(vertex_index, g));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DIRECTION_OPTIMIZING_BFS_HPP
@@ -10,7 +10,15 @@
 #include <boost/next_prior.hpp>
 #include <boost/config.hpp>
 #include <boost/graph/detail/geodesic.hpp>
+#include <boost/graph/multi_source_bfs.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/visitors.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
+#include <vector>
 
 namespace boost
 {
@@ -72,6 +80,39 @@ all_eccentricities(const Graph& g, const DistanceMatrix& dist, EccentricityMap e
     return std::make_pair(r, d);
 }
 
+// The eccentricities of the vertices of an unweighted graph, with the
+// distances found by breadth-first searches run 256 at a time instead of
+// taken from a distance matrix. Returns the radius and the diameter.
+template <typename Graph, typename EccentricityMap>
+inline std::pair<typename property_traits<EccentricityMap>::value_type,
+                    typename property_traits<EccentricityMap>::value_type>
+all_eccentricities_bfs(const Graph& g, EccentricityMap ecc)
+{
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typedef typename graph_traits<Graph>::vertex_iterator VertexIterator;
+    BOOST_CONCEPT_ASSERT(( WritablePropertyMapConcept<EccentricityMap,Vertex> ));
+    typedef typename property_traits<EccentricityMap>::value_type Eccentricity;
+    BOOST_USING_STD_MIN();
+    BOOST_USING_STD_MAX();
+
+    std::vector<detail::bfs_distance_summary> summaries;
+    detail::all_bfs_distance_summaries<4>(g, get(vertex_index, g), summaries);
+    Eccentricity
+            r = numeric_values<Eccentricity>::infinity(),
+            d = numeric_values<Eccentricity>::zero();
+    VertexIterator i, end;
+    for(boost::tie(i, end) = vertices(g); i != end; ++i) {
+        Eccentricity e = summaries[get(vertex_index, g, *i)]
+            .template farthest<Eccentricity>(num_vertices(g));
+        put(ecc, *i, e);
+
+        r = min BOOST_PREVENT_MACRO_SUBSTITUTION (r, e);
+        d = max BOOST_PREVENT_MACRO_SUBSTITUTION (d, e);
+    }
+    return std::make_pair(r, d);
+}
+
 template <typename Graph, typename EccentricityMap>
 inline std::pair<typename property_traits<EccentricityMap>::value_type,
                     typename property_traits<EccentricityMap>::value_type>
@@ -109,6 +150,209 @@ inline typename property_traits<EccentricityMap>::value_type
 diameter(const Graph& g, EccentricityMap ecc)
 { return radius_and_diameter(g, ecc).second; }
 
+namespace detail {
+    // The distances of the bounding searches: the weights of a weighted
+    // graph, vertices_size_type for an unweighted one.
+    template <typename Graph, typename WeightMap>
+    struct bounding_eccentricity_distance
+    { typedef typename property_traits<WeightMap>::value_type type; };
+
+    template <typename Graph>
+    struct bounding_eccentricity_distance<Graph, param_not_found>
+    { typedef typename graph_traits<Graph>::vertices_size_type type; };
+
+    template <typename Graph, typename Distance, typename WeightMap,
+                typename IndexMap>
+    inline void
+    bounding_eccentricity_search(const Graph& g,
+                                    typename graph_traits<Graph>::vertex_descriptor s,
+                                    std::vector<Distance>& dist,
+                                    WeightMap weight,
+                                    IndexMap index)
+    {
+        dijkstra_shortest_paths(g, s,
+            weight_map(weight).
+            vertex_index_map(index).
+            distance_map(make_iterator_property_map(dist.begin(), index)).
+            distance_inf(numeric_values<Distance>::infinity()));
+    }
+
+    template <typename Graph, typename Distance, typename IndexMap>
+    inline void
+    bounding_eccentricity_search(const Graph& g,
+                                    typename graph_traits<Graph>::vertex_descriptor s,
+                                    std::vector<Distance>& dist,
+                                    param_not_found,
+                                    IndexMap index)
+    {
+        std::fill(dist.begin(), dist.end(), numeric_values<Distance>::infinity());
+        dist[get(index, s)] = 0;
+        breadth_first_search(g, s,
+            visitor(make_bfs_visitor(record_distances(
+                make_iterator_property_map(dist.begin(), index),
+                on_tree_edge()))).
+            vertex_index_map(index));
+    }
+
+    // Computes the diameter or the radius of a connected undirected graph
+    // by the bounding algorithm of Takes and Kosters: every search from a
+    // vertex v with eccentricity e bounds the eccentricity of every vertex
+    // w by max(d(v, w), e - d(v, w)) from below and e + d(v, w) from above.
+    // Vertices whose bounds show that they cannot change the result are
+    // dropped, and the next search starts alternately from the remaining
+    // vertex with the largest upper bound and the one with the smallest
+    // lower bound, so only a few searches are needed on most graphs.
+    template <typename Graph, typename WeightMap, typename IndexMap>
+    typename bounding_eccentricity_distance<Graph, WeightMap>::type
+    bounding_eccentricities(const Graph& g,
+                            bool want_diameter,
+                            std::size_t& searches,
+                            WeightMap weight,
+                            IndexMap index)
+    {
+        BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+        BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+        BOOST_STATIC_ASSERT(( is_undirected_graph<Graph>::value ));
+        typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+        typedef typename bounding_eccentricity_distance<Graph, WeightMap>::type
+            Distance;
+        BOOST_USING_STD_MIN();
+        BOOST_USING_STD_MAX();
+
+        Distance inf = numeric_values<Distance>::infinity();
+        searches = 0;
+        std::size_t n = num_vertices(g);
+        if(n == 0) {
+            return Distance(0);
+        }
+
+        std::vector<Distance> dist(n), lower(n, Distance(0)), upper(n, inf);
+        std::vector<Vertex> candidates(vertices(g).first, vertices(g).second);
+        Distance diam = Distance(0), rad = inf;
+        bool from_upper = true;
+        while(!candidates.empty()) {
+            // Pick the next source; ties go to the vertex of highest degree
+            std::size_t best = 0;
+            for(std::size_t j = 1; j < candidates.size(); ++j) {
+                std::size_t i = get(index, candidates[j]);
+                std::size_t b = get(index, candidates[best]);
+                bool better = from_upper ? upper[i] > upper[b] : lower[i] < lower[b];
+                bool tie = from_upper ? upper[i] == upper[b] : lower[i] == lower[b];
+                if(better || (tie && out_degree(candidates[j], g) >
+                                    out_degree(candidates[best], g))) {
+                    best = j;
+                }
+            }
+            from_upper = !from_upper;
+
+            Vertex v = candidates[best];
+            bounding_eccentricity_search(g, v, dist, weight, index);
+            ++searches;
+            Distance e = Distance(0);
+            for(std::size_t i = 0; i < n; ++i) {
+                if(dist[i] == inf) {
+                    // Disconnected, so every eccentricity is infinite
+                    return inf;
+                }
+                e = max BOOST_PREVENT_MACRO_SUBSTITUTION (e, dist[i]);
+            }
+
+            // Tighten the bounds of the candidates and drop those that can
+            // no longer change the result
+            std::size_t kept = 0;
+            for(std::size_t j = 0; j < candidates.size(); ++j) {
+                std::size_t i = get(index, candidates[j]);
+                Distance d = dist[i];
+                lower[i] = max BOOST_PREVENT_MACRO_SUBSTITUTION
+                    (lower[i], max BOOST_PREVENT_MACRO_SUBSTITUTION (d, Distance(e - d)));
+                upper[i] = min BOOST_PREVENT_MACRO_SUBSTITUTION
+                    (upper[i], Distance(e + d));
+                diam = max BOOST_PREVENT_MACRO_SUBSTITUTION (diam, lower[i]);
+                rad = min BOOST_PREVENT_MACRO_SUBSTITUTION (rad, upper[i]);
+            }
+            for(std::size_t j = 0; j < candidates.size(); ++j) {
+                std::size_t i = get(index, candidates[j]);
+                bool done = want_diameter ? upper[i] <= diam : lower[i] >= rad;
+                if(!done && lower[i] != upper[i]) {
+                    candidates[kept++] = candidates[j];
+                }
+            }
+            candidates.resize(kept);
+        }
+        return want_diameter ? diam : rad;
+    }
+
+    template <typename Graph, typename P, typename T, typename R>
+    inline typename bounding_eccentricity_distance<
+        Graph, typename get_param_type<edge_weight_t, bgl_named_params<P, T, R> >::type
+    >::type
+    bounding_eccentricities(const Graph& g,
+                            bool want_diameter,
+                            std::size_t& searches,
+                            const bgl_named_params<P, T, R>& params)
+    {
+        return bounding_eccentricities(g, want_diameter, searches,
+            get_param(params, edge_weight),
+            choose_const_pmap(get_param(params, vertex_index), g, vertex_index));
+    }
+}
+
+// The diameter of a connected undirected graph, computed from a few
+// single-source searches instead of all of them. Without a weight map the
+// searches are breadth-first; with one they use Dijkstra's algorithm.
+// searches is set to the number of searches. The diameter of a
+// disconnected graph is infinite.
+template <typename Graph, typename P, typename T, typename R>
+inline typename detail::bounding_eccentricity_distance<
+    Graph, typename get_param_type<edge_weight_t, bgl_named_params<P, T, R> >::type
+>::type
+exact_diameter(const Graph& g,
+                std::size_t& searches,
+                const bgl_named_params<P, T, R>& params)
+{ return detail::bounding_eccentricities(g, true, searches, params); }
+
+template <typename Graph>
+inline typename graph_traits<Graph>::vertices_size_type
+exact_diameter(const Graph& g, std::size_t& searches)
+{
+    return detail::bounding_eccentricities(g, true, searches,
+        param_not_found(), get(vertex_index, g));
+}
+
+template <typename Graph>
+inline typename graph_traits<Graph>::vertices_size_type
+exact_diameter(const Graph& g)
+{
+    std::size_t searches;
+    return exact_diameter(g, searches);
+}
+
+// The radius of a connected undirected graph, computed like exact_diameter.
+template <typename Graph, typename P, typename T, typename R>
+inline typename detail::bounding_eccentricity_distance<
+    Graph, typename get_param_type<edge_weight_t, bgl_named_params<P, T, R> >::type
+>::type
+exact_radius(const Graph& g,
+                std::size_t& searches,
+                const bgl_named_params<P, T, R>& params)
+{ return detail::bounding_eccentricities(g, false, searches, params); }
+
+template <typename Graph>
+inline typename graph_traits<Graph>::vertices_size_type
+exact_radius(const Graph& g, std::size_t& searches)
+{
+    return detail::bounding_eccentricities(g, false, searches,
+        param_not_found(), get(vertex_index, g));
+}
+
+template <typename Graph>
+inline typename graph_traits<Graph>::vertices_size_type
+exact_radius(const Graph& g)
+{
+    std::size_t searches;
+    return exact_radius(g, searches);
+}
+
 } /* namespace boost */
 
 #endif
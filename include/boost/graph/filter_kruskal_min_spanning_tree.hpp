@@ -0,0 +1,256 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_MST_FILTER_KRUSKAL_HPP
+#define BOOST_GRAPH_MST_FILTER_KRUSKAL_HPP
+
+/*
+ * Minimum spanning tree by filter-Kruskal (V. Osipov, P. Sanders and
+ * J. Singler, "The filter-Kruskal minimum spanning tree algorithm",
+ * ALENEX 2009).
+ *
+ * Like quicksort, the edges are partitioned around the median weight of a
+ * small random sample.  The light part is handled first, recursively, and
+ * the edges of the heavy part whose ends the light edges already joined
+ * are then dropped before it is handled in turn, so that only a small
+ * part of the heavy edges of a dense graph ever gets sorted.  Small parts
+ * are sorted and scanned as by Kruskal's algorithm.
+ *
+ * Requirement:
+ *      undirected graph
+ */
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include <boost/property_map/property_map.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/pending/disjoint_sets.hpp>
+#include <boost/pending/indirect_cmp.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/concept/assert.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // Whether an edge weighs less than the pivot, or at most the pivot
+    template <class Edge, class Weight>
+    struct filter_kruskal_lighter
+    {
+      typedef typename property_traits<Weight>::value_type W_value;
+      filter_kruskal_lighter(Weight w, const W_value& p, bool eq)
+        : weight(w), pivot(p), or_equal(eq) {}
+      bool operator()(const Edge& e) const
+      {
+        W_value w = get(weight, e);
+        return or_equal ? !(pivot < w) : w < pivot;
+      }
+      Weight weight;
+      W_value pivot;
+      bool or_equal;
+    };
+
+    // Whether the ends of an edge are already in the same set
+    template <class Graph, class DisjointSets>
+    struct filter_kruskal_joined
+    {
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+      filter_kruskal_joined(const Graph& g, DisjointSets& d)
+        : G(&g), dset(&d) {}
+      bool operator()(const Edge& e) const
+      {
+        return dset->find_set(source(e, *G)) == dset->find_set(target(e, *G));
+      }
+      const Graph* G;
+      DisjointSets* dset;
+    };
+
+    // Kruskal's scan of [first, last), joining the sets of the ends of
+    // each edge that is not yet inside one
+    template <class Graph, class EdgeIterator, class OutputIterator,
+              class DisjointSets, class Weight, class Size>
+    void filter_kruskal_base(const Graph& G, EdgeIterator first,
+                             EdgeIterator last,
+                             OutputIterator& spanning_tree_edges,
+                             DisjointSets& dset, Weight weight,
+                             Size& tree_edges_left)
+    {
+      typedef typename property_traits<Weight>::value_type W_value;
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      std::sort(first, last,
+                indirect_cmp<Weight, std::less<W_value> >(weight));
+      for (; first != last && tree_edges_left > 0; ++first) {
+        Vertex u = dset.find_set(source(*first, G));
+        Vertex v = dset.find_set(target(*first, G));
+        if (u != v) {
+          *spanning_tree_edges++ = *first;
+          dset.link(u, v);
+          --tree_edges_left;
+        }
+      }
+    }
+
+    template <class Graph, class EdgeIterator, class OutputIterator,
+              class DisjointSets, class Weight, class Size>
+    void filter_kruskal_rec(const Graph& G, EdgeIterator first,
+                            EdgeIterator last,
+                            OutputIterator& spanning_tree_edges,
+                            DisjointSets& dset, Weight weight,
+                            Size& tree_edges_left, minstd_rand& gen)
+    {
+      typedef typename property_traits<Weight>::value_type W_value;
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+      const std::size_t base_size = 1024, num_samples = 31;
+
+      // The heavy part is handled by the loop rather than by recursion,
+      // which keeps the stack depth logarithmic
+      while (tree_edges_left > 0) {
+        std::size_t m = std::size_t(last - first);
+        if (m <= base_size) {
+          filter_kruskal_base(G, first, last, spanning_tree_edges, dset,
+                              weight, tree_edges_left);
+          return;
+        }
+
+        std::vector<W_value> sample;
+        sample.reserve(num_samples);
+        for (std::size_t i = 0; i < num_samples; ++i)
+          sample.push_back(get(weight, first[gen() % m]));
+        std::nth_element(sample.begin(), sample.begin() + num_samples / 2,
+                         sample.end());
+        W_value pivot = sample[num_samples / 2];
+
+        EdgeIterator middle = std::partition
+          (first, last, filter_kruskal_lighter<Edge, Weight>(weight, pivot,
+                                                             false));
+        // Without edges lighter than the pivot, which is then the lightest
+        // weight, the light part takes the edges of that weight
+        if (middle == first)
+          middle = std::partition
+            (first, last, filter_kruskal_lighter<Edge, Weight>(weight, pivot,
+                                                               true));
+        // All the edges weigh the same
+        if (middle == last) {
+          filter_kruskal_base(G, first, last, spanning_tree_edges, dset,
+                              weight, tree_edges_left);
+          return;
+        }
+
+        filter_kruskal_rec(G, first, middle, spanning_tree_edges, dset,
+                           weight, tree_edges_left, gen);
+        first = middle;
+        last = std::remove_if
+          (first, last, filter_kruskal_joined<Graph, DisjointSets>(G, dset));
+      }
+    }
+
+    template <class Graph, class OutputIterator,
+              class Rank, class Parent, class Weight>
+    void
+    filter_kruskal_mst_impl(const Graph& G,
+                            OutputIterator spanning_tree_edges,
+                            Rank rank, Parent parent, Weight weight)
+    {
+      if (num_vertices(G) == 0) return; // Nothing to do in this case
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+      BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( EdgeListGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( OutputIteratorConcept<OutputIterator, Edge> ));
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<Rank, Vertex> ));
+      BOOST_CONCEPT_ASSERT(( ReadWritePropertyMapConcept<Parent, Vertex> ));
+      BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<Weight, Edge> ));
+      typedef typename property_traits<Weight>::value_type W_value;
+      typedef typename property_traits<Rank>::value_type R_value;
+      typedef typename property_traits<Parent>::value_type P_value;
+      BOOST_CONCEPT_ASSERT(( ComparableConcept<W_value> ));
+      BOOST_CONCEPT_ASSERT(( ConvertibleConcept<P_value, Vertex> ));
+      BOOST_CONCEPT_ASSERT(( IntegerConcept<R_value> ));
+
+      typedef disjoint_sets<Rank, Parent> DisjointSets;
+      DisjointSets dset(rank, parent);
+
+      typename graph_traits<Graph>::vertex_iterator ui, uiend;
+      for (boost::tie(ui, uiend) = vertices(G); ui != uiend; ++ui)
+        dset.make_set(*ui);
+
+      typename graph_traits<Graph>::edge_iterator ei, eiend;
+      boost::tie(ei, eiend) = edges(G);
+      std::vector<Edge> edge_list(ei, eiend);
+
+      // The scan stops once the tree is complete
+      typename graph_traits<Graph>::vertices_size_type tree_edges_left
+        = num_vertices(G) - 1;
+      minstd_rand gen(1);
+      filter_kruskal_rec(G, edge_list.begin(), edge_list.end(),
+                         spanning_tree_edges, dset, weight, tree_edges_left,
+                         gen);
+    }
+
+  } // namespace detail
+
+  // Named Parameters Variants
+
+  template <class Graph, class OutputIterator>
+  inline void
+  filter_kruskal_minimum_spanning_tree(const Graph& g,
+                                       OutputIterator spanning_tree_edges)
+  {
+    typedef typename graph_traits<Graph>::vertices_size_type size_type;
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_t;
+    if (num_vertices(g) == 0) return; // Nothing to do in this case
+    typename graph_traits<Graph>::vertices_size_type
+      n = num_vertices(g);
+    std::vector<size_type> rank_map(n);
+    std::vector<vertex_t> pred_map(n);
+
+    detail::filter_kruskal_mst_impl
+      (g, spanning_tree_edges,
+       make_iterator_property_map(rank_map.begin(), get(vertex_index, g), rank_map[0]),
+       make_iterator_property_map(pred_map.begin(), get(vertex_index, g), pred_map[0]),
+       get(edge_weight, g));
+  }
+
+  template <class Graph, class OutputIterator, class P, class T, class R>
+  inline void
+  filter_kruskal_minimum_spanning_tree(const Graph& g,
+                                       OutputIterator spanning_tree_edges,
+                                       const bgl_named_params<P, T, R>& params)
+  {
+    typedef typename graph_traits<Graph>::vertices_size_type size_type;
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_t;
+    if (num_vertices(g) == 0) return; // Nothing to do in this case
+    typename graph_traits<Graph>::vertices_size_type n;
+    n = is_default_param(get_param(params, vertex_rank))
+                                   ? num_vertices(g) : 1;
+    std::vector<size_type> rank_map(n);
+    n = is_default_param(get_param(params, vertex_predecessor))
+                                   ? num_vertices(g) : 1;
+    std::vector<vertex_t> pred_map(n);
+
+    detail::filter_kruskal_mst_impl
+      (g, spanning_tree_edges,
+       choose_param
+       (get_param(params, vertex_rank),
+        make_iterator_property_map
+        (rank_map.begin(),
+         choose_pmap(get_param(params, vertex_index), g, vertex_index), rank_map[0])),
+       choose_param
+       (get_param(params, vertex_predecessor),
+        make_iterator_property_map
+        (pred_map.begin(),
+         choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+         pred_map[0])),
+       choose_const_pmap(get_param(params, edge_weight), g, edge_weight));
+  }
+
+} // namespace boost
+
+
+#endif // BOOST_GRAPH_MST_FILTER_KRUSKAL_HPP
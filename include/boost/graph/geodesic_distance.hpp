@@ -9,6 +9,7 @@
 
 #include <boost/graph/detail/geodesic.hpp>
 #include <boost/graph/exterior_property.hpp>
+#include <boost/graph/multi_source_bfs.hpp>
 #include <boost/concept/assert.hpp>
 
 namespace boost
@@ -189,6 +190,58 @@ all_mean_geodesics(const Graph& g, DistanceMatrixMap dist, GeodesicMap geo)
     return all_mean_geodesics(g, dist, geo, measure_mean_geodesic<Result>(g, DistanceMap()));
 }
 
+// The mean geodesic distances of the vertices of an unweighted graph, with
+// the distances found by breadth-first searches run 256 at a time instead
+// of taken from a distance matrix. Returns their average.
+template <typename Graph,
+            typename GeodesicMap,
+            typename Measure>
+inline typename property_traits<GeodesicMap>::value_type
+all_mean_geodesics_bfs(const Graph& g,
+                        GeodesicMap geo,
+                        Measure measure)
+{
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typedef typename graph_traits<Graph>::vertex_iterator VertexIterator;
+    BOOST_CONCEPT_ASSERT(( DistanceMeasureConcept<Measure,Graph> ));
+    typedef typename Measure::distance_type Distance;
+    typedef typename Measure::result_type Result;
+    BOOST_CONCEPT_ASSERT(( WritablePropertyMapConcept<GeodesicMap,Vertex> ));
+    BOOST_CONCEPT_ASSERT(( NumericValueConcept<Result> ));
+
+    std::vector<detail::bfs_distance_summary> summaries;
+    detail::all_bfs_distance_summaries<4>(g, get(vertex_index, g), summaries);
+    Result inf = numeric_values<Result>::infinity();
+    Result sum = numeric_values<Result>::zero();
+    VertexIterator i, end;
+    for(boost::tie(i, end) = vertices(g); i != end; ++i) {
+        Distance d = summaries[get(vertex_index, g, *i)]
+            .template total<Distance>(num_vertices(g));
+        Result r = measure(d, g);
+        put(geo, *i, r);
+
+        if(r == inf) {
+            sum = inf;
+        }
+        else if(sum != inf) {
+            sum += r;
+        }
+    }
+    return sum / Result(num_vertices(g));
+}
+
+template <typename Graph, typename GeodesicMap>
+inline typename property_traits<GeodesicMap>::value_type
+all_mean_geodesics_bfs(const Graph& g, GeodesicMap geo)
+{
+    typedef typename graph_traits<Graph>::vertices_size_type Distance;
+    typedef typename property_traits<GeodesicMap>::value_type Result;
+
+    return all_mean_geodesics_bfs(g, geo,
+                                  mean_geodesic_measure<Graph, Distance, Result>());
+}
+
 
 template <typename Graph, typename GeodesicMap, typename Measure>
 inline typename Measure::result_type
@@ -18,6 +18,12 @@
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/pending/disjoint_sets.hpp>
+#include <boost/graph/detail/threading.hpp>
+#ifndef BOOST_GRAPH_NO_THREADS
+#include <boost/graph/concurrent_disjoint_sets.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#endif
 #include <iterator>
 
 namespace boost {
@@ -59,6 +65,42 @@ namespace boost {
       ds.union_set(source(*e,g),target(*e,g));
   }
   
+#ifndef BOOST_GRAPH_NO_THREADS
+  // The same with num_threads threads (0 means one per hardware thread),
+  // which take the out-edges of the vertices in chunks, each edge of an
+  // undirected graph from one end only.  The elements of the sets are the
+  // vertex indices.  Other threads may call union_set,
+  // find_set and same_set on ds meanwhile.
+  template <class Graph, class Index>
+  void incremental_components(const Graph& g,
+                              concurrent_disjoint_sets<Index>& ds,
+                              std::size_t num_threads)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typename property_map<Graph, vertex_index_t>::const_type
+      index = get(vertex_index, g);
+    const bool undirected = is_undirected(g);
+    std::size_t n = num_vertices(g);
+    std::vector<Vertex> verts(n);
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      verts[get(index, *vi)] = *vi;
+
+    graph::detail::parallel_for
+      (graph::detail::resolve_num_threads(num_threads), std::size_t(0), n,
+       std::size_t(256), [&](std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+          typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(verts[i], g); ei != ei_end;
+               ++ei) {
+            std::size_t j = get(index, target(*ei, g));
+            if (j > i || !undirected) ds.union_set(Index(i), Index(j));
+          }
+        }
+      });
+  }
+#endif // BOOST_GRAPH_NO_THREADS
+
   template <class ParentIterator>
   void compress_components(ParentIterator first, ParentIterator last)
   {
@@ -101,6 +143,17 @@ namespace boost {
     return ds.find_set(u) == ds.find_set(v);
   }
 
+#ifndef BOOST_GRAPH_NO_THREADS
+  // Comparing two calls to find_set could give a wrong answer while other
+  // threads join sets
+  template <class Vertex, class Index>
+  inline bool same_component(Vertex u, Vertex v,
+                             concurrent_disjoint_sets<Index>& ds)
+  {
+    return ds.same_set(Index(u), Index(v));
+  }
+#endif // BOOST_GRAPH_NO_THREADS
+
   // Class that builds a quick-access indexed linked list that allows
   // for fast iterating through a parent component's children.
   template <typename IndexType>
@@ -143,6 +196,24 @@ namespace boost {
 
     } // component_index
 
+#ifndef BOOST_GRAPH_NO_THREADS
+    // Builds the index of the sets of ds with num_threads threads (0 means
+    // one per hardware thread).  The components are numbered as from the
+    // parents, but the order of the elements of each one is unspecified.
+    // No thread may join sets of ds meanwhile.
+    template <typename Index>
+    component_index(concurrent_disjoint_sets<Index>& ds,
+                    std::size_t num_threads) :
+      m_num_elements(ds.size()),
+      m_components(make_shared<IndexContainer>()),
+      m_index_list(make_shared<IndexContainer>(m_num_elements)) {
+
+      build_index_lists_parallel
+        (ds, graph::detail::resolve_num_threads(num_threads));
+
+    } // component_index
+#endif // BOOST_GRAPH_NO_THREADS
+
     // Returns the number of components
     inline std::size_t size() const {
       return (m_components->size());
@@ -220,6 +291,64 @@ namespace boost {
 
     } // build_index_lists
 
+#ifndef BOOST_GRAPH_NO_THREADS
+    template <typename Index>
+    void build_index_lists_parallel(concurrent_disjoint_sets<Index>& ds,
+                                    std::size_t num_threads) {
+
+      IndexType n = m_num_elements;
+      IndexContainer& components = *m_components;
+      IndexContainer& index_list = *m_index_list;
+      std::vector<IndexType> root(n);
+      std::vector<std::atomic<IndexType> > head(n);
+      std::vector<std::size_t> block_roots(num_threads + 1);
+      graph::detail::thread_barrier barrier(num_threads);
+
+      graph::detail::parallel_for_blocks
+        (num_threads, n, [&](std::size_t t, IndexType first, IndexType last) {
+
+          // Find the root of each element and count the roots of the block
+          std::size_t count = 0;
+          for (IndexType element_index = first; element_index < last;
+               ++element_index) {
+            root[element_index] = IndexType(ds.find_set(Index(element_index)));
+            head[element_index].store(n, std::memory_order_relaxed);
+            if (root[element_index] == element_index) ++count;
+          }
+          block_roots[t + 1] = count;
+          barrier.wait();
+          if (t == 0) {
+            for (std::size_t q = 0; q < num_threads; ++q)
+              block_roots[q + 1] += block_roots[q];
+            components.resize(block_roots[num_threads]);
+          }
+          barrier.wait();
+
+          // Number the roots in order, and push each other element to the
+          // front of the list of its root
+          std::size_t next = block_roots[t];
+          for (IndexType element_index = first; element_index < last;
+               ++element_index) {
+            IndexType parent_index = root[element_index];
+            if (parent_index == element_index)
+              components[next++] = element_index;
+            else
+              index_list[element_index] =
+                head[parent_index].exchange(element_index,
+                                            std::memory_order_relaxed);
+          }
+          barrier.wait();
+
+          for (IndexType element_index = first; element_index < last;
+               ++element_index)
+            if (root[element_index] == element_index)
+              index_list[element_index] =
+                head[element_index].load(std::memory_order_relaxed);
+        });
+
+    } // build_index_lists_parallel
+#endif // BOOST_GRAPH_NO_THREADS
+
   protected:
     IndexType m_num_elements;
     shared_ptr<IndexContainer> m_components, m_index_list;
@@ -0,0 +1,202 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_INCREMENTAL_CORE_NUMBERS_HPP
+#define BOOST_GRAPH_INCREMENTAL_CORE_NUMBERS_HPP
+
+/*
+ * Maintenance of the core numbers of an undirected graph under edge
+ * insertions and removals, by the traversal algorithm of A. E. Sariyuce,
+ * B. Gedik, G. Jacques-Silva, K.-L. Wu and U. V. Catalyurek, "Streaming
+ * algorithms for k-core decomposition", PVLDB 6(6), 2013.
+ *
+ * Adding or removing an edge (u, v) only changes, by one, the core numbers
+ * of some vertices whose core number is K = min(core(u), core(v)) and which
+ * are connected to u or v through such vertices.  After an insertion, the
+ * candidates are found by a search from the endpoints of core number K
+ * that only goes on from a vertex with more than K neighbors of core number
+ * at least K; the candidates left with at most K such neighbors among the
+ * candidates and the vertices of higher core number are evicted one by one,
+ * and the others move up to K + 1.  After a removal, the endpoints of core
+ * number K with fewer than K such neighbors move down to K - 1, which may
+ * make their neighbors of core number K move down in turn.
+ */
+
+#include <vector>
+#include <boost/static_assert.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/core_numbers.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  // Keeps the core numbers of an undirected graph without self-loops,
+  // where parallel edges each count towards the degree, in the
+  // read/write property map c up to date as edges are added to the
+  // graph and removed from it.  The graph is modified by its owner, who
+  // calls edge_added or edge_removed after each change.  Vertices may be
+  // added, with a core number of zero, but not removed.
+  template <typename Graph, typename CoreMap,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class incremental_core_numbers
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_STATIC_ASSERT(( is_undirected_graph<Graph>::value ));
+
+  public:
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename property_traits<CoreMap>::value_type core_type;
+
+    // Computes the core numbers of g with core_numbers
+    incremental_core_numbers(const Graph& g, CoreMap c)
+      : g(g), c(c), index(get(vertex_index, g))
+    {
+      core_numbers(g, c);
+    }
+
+    // Takes the core numbers already in c
+    incremental_core_numbers(const Graph& g, CoreMap c, VertexIndexMap index)
+      : g(g), c(c), index(index) {}
+
+    // Updates the core numbers after the edge (u, v) has been added to the
+    // graph; returns the number of vertices whose core number changed
+    std::size_t edge_added(vertex_descriptor u, vertex_descriptor v)
+    {
+      if (u == v) return 0;
+      grow();
+      core_type k = (std::min)(get(c, u), get(c, v));
+      if (get(c, u) == k) visit(u, k);
+      if (get(c, v) == k) visit(v, k);
+
+      // The candidates
+      for (std::size_t i = 0; i < touched.size(); ++i) {
+        vertex_descriptor w = touched[i];
+        if (count[get(index, w)] <= std::size_t(k)) continue;
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(w, g); ei != ei_end; ++ei) {
+          vertex_descriptor x = target(*ei, g);
+          if (get(c, x) == k && !flags[get(index, x)]) visit(x, k);
+        }
+      }
+
+      // The evictions
+      std::size_t candidates = touched.size();
+      for (std::size_t i = 0; i < candidates; ++i)
+        if (count[get(index, touched[i])] <= std::size_t(k)) evict(touched[i]);
+      for (std::size_t i = 0; i < evicted.size(); ++i) {
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(evicted[i], g); ei != ei_end;
+             ++ei) {
+          vertex_descriptor x = target(*ei, g);
+          std::size_t xi = get(index, x);
+          if (flags[xi] == visited && --count[xi] <= std::size_t(k)) evict(x);
+        }
+      }
+
+      std::size_t changed = 0;
+      for (std::size_t i = 0; i < candidates; ++i) {
+        vertex_descriptor w = touched[i];
+        if (flags[get(index, w)] == visited) {
+          put(c, w, core_type(k + 1));
+          ++changed;
+        }
+      }
+      clear();
+      return changed;
+    }
+
+    // Updates the core numbers after the edge (u, v) has been removed from
+    // the graph; returns the number of vertices whose core number changed
+    std::size_t edge_removed(vertex_descriptor u, vertex_descriptor v)
+    {
+      core_type k = (std::min)(get(c, u), get(c, v));
+      if (u == v || k == core_type(0)) return 0;
+      grow();
+      if (get(c, u) == k) visit(u, k);
+      if (get(c, v) == k && !flags[get(index, v)]) visit(v, k);
+      std::size_t roots = touched.size();
+      for (std::size_t i = 0; i < roots; ++i)
+        if (count[get(index, touched[i])] < std::size_t(k)) evict(touched[i]);
+
+      // A vertex moves down when it is taken from the queue.  Its neighbors
+      // not counted yet are counted first, while it still has core number
+      // k, so that each edge to it is then taken off exactly once, however
+      // many parallel edges there are.
+      for (std::size_t i = 0; i < evicted.size(); ++i) {
+        vertex_descriptor w = evicted[i];
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(w, g); ei != ei_end; ++ei) {
+          vertex_descriptor x = target(*ei, g);
+          if (get(c, x) == k && !flags[get(index, x)]) visit(x, k);
+        }
+        put(c, w, core_type(k - 1));
+        for (boost::tie(ei, ei_end) = out_edges(w, g); ei != ei_end; ++ei) {
+          vertex_descriptor x = target(*ei, g);
+          std::size_t xi = get(index, x);
+          if (get(c, x) != k || flags[xi] != visited) continue;
+          if (--count[xi] < std::size_t(k)) evict(x);
+        }
+      }
+
+      std::size_t changed = evicted.size();
+      clear();
+      return changed;
+    }
+
+  private:
+    enum { unvisited = 0, visited = 1, dropped = 2 };
+
+    // Counts the neighbors of w whose core number is at least k
+    void visit(vertex_descriptor w, core_type k)
+    {
+      std::size_t wi = get(index, w), at_least = 0;
+      typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(w, g); ei != ei_end; ++ei)
+        if (!(get(c, target(*ei, g)) < k)) ++at_least;
+      count[wi] = at_least;
+      flags[wi] = visited;
+      touched.push_back(w);
+    }
+
+    void evict(vertex_descriptor w)
+    {
+      flags[get(index, w)] = dropped;
+      evicted.push_back(w);
+    }
+
+    void grow()
+    {
+      if (flags.size() < num_vertices(g)) {
+        flags.resize(num_vertices(g));
+        count.resize(num_vertices(g));
+      }
+    }
+
+    void clear()
+    {
+      for (std::size_t i = 0; i < touched.size(); ++i)
+        flags[get(index, touched[i])] = unvisited;
+      for (std::size_t i = 0; i < evicted.size(); ++i)
+        flags[get(index, evicted[i])] = unvisited;
+      touched.clear();
+      evicted.clear();
+    }
+
+    const Graph& g;
+    CoreMap c;
+    VertexIndexMap index;
+    std::vector<char> flags;
+    std::vector<std::size_t> count;
+    std::vector<vertex_descriptor> touched, evicted;
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_INCREMENTAL_CORE_NUMBERS_HPP
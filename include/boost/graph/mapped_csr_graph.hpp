@@ -0,0 +1,658 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Binary file format for compressed_sparse_row_graph, and a read-only graph
+// type that serves the graph directly out of a memory mapping of such a file.
+
+#ifndef BOOST_GRAPH_MAPPED_CSR_GRAPH_HPP
+#define BOOST_GRAPH_MAPPED_CSR_GRAPH_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <ostream>
+#include <fstream>
+#include <utility>
+#include <boost/cstdint.hpp>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_pod.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+
+namespace boost {
+
+// Thrown when a file is not a CSR graph file, has a different format version,
+// or was written for a different vertex, edge index or property type.
+struct BOOST_SYMBOL_VISIBLE bad_csr_graph_file : public bad_graph {
+  bad_csr_graph_file(const std::string& what_arg)
+    : bad_graph("Invalid CSR graph file: " + what_arg) { }
+};
+
+namespace detail {
+
+  /* On-disk layout of a CSR graph file (version 1).
+   *
+   * The file starts with the header below, followed by four arrays, each
+   * starting at a multiple of csr_file_alignment bytes from the beginning of
+   * the file:
+   *
+   *   rowstart:          (num_vertices + 1) values of type EdgeIndex
+   *   column:            num_edges values of type Vertex
+   *   vertex properties: num_vertices values of the vertex bundle type
+   *   edge properties:   num_edges values of the edge bundle type
+   *
+   * Everything is stored in the byte order of the machine that wrote the
+   * file; byte_order lets a reader on another machine reject the file.
+   * Property arrays are raw copies of plain old data and are empty (size 0)
+   * for no_property.
+   */
+  struct csr_file_header {
+    char magic[8];
+    boost::uint32_t version;
+    boost::uint32_t byte_order;
+    boost::uint32_t vertex_size;
+    boost::uint32_t edge_index_size;
+    boost::uint32_t vertex_property_size;
+    boost::uint32_t edge_property_size;
+    boost::uint64_t num_vertices;
+    boost::uint64_t num_edges;
+    boost::uint64_t rowstart_offset;
+    boost::uint64_t column_offset;
+    boost::uint64_t vertex_property_offset;
+    boost::uint64_t edge_property_offset;
+    boost::uint64_t file_size;
+  };
+
+  static const char csr_file_magic[8] = {'B', 'G', 'L', 'C', 'S', 'R', '\0', '\0'};
+  static const boost::uint32_t csr_file_version = 1;
+  static const boost::uint32_t csr_file_byte_order = 0x01020304u;
+  static const boost::uint64_t csr_file_alignment = 64;
+
+  // Stored size of a property bundle; no_property takes no room.
+  template <typename Property>
+  struct csr_file_property_size {
+    BOOST_STATIC_ASSERT_MSG((is_pod<Property>::value),
+                            "CSR graph files can only hold POD properties");
+    static const boost::uint32_t value = sizeof(Property);
+  };
+
+  template <>
+  struct csr_file_property_size<no_property> {
+    static const boost::uint32_t value = 0;
+  };
+
+  inline boost::uint64_t csr_file_align(boost::uint64_t offset) {
+    return (offset + csr_file_alignment - 1) / csr_file_alignment
+             * csr_file_alignment;
+  }
+
+  // Fill in the sizes and offsets of a header for the given graph shape.
+  template <typename Vertex, typename EdgeIndex,
+            typename VertexProperty, typename EdgeProperty>
+  csr_file_header make_csr_file_header(boost::uint64_t numverts,
+                                       boost::uint64_t numedges) {
+    csr_file_header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, csr_file_magic, sizeof(h.magic));
+    h.version = csr_file_version;
+    h.byte_order = csr_file_byte_order;
+    h.vertex_size = sizeof(Vertex);
+    h.edge_index_size = sizeof(EdgeIndex);
+    h.vertex_property_size = csr_file_property_size<VertexProperty>::value;
+    h.edge_property_size = csr_file_property_size<EdgeProperty>::value;
+    h.num_vertices = numverts;
+    h.num_edges = numedges;
+    h.rowstart_offset = csr_file_align(sizeof(csr_file_header));
+    h.column_offset =
+      csr_file_align(h.rowstart_offset + (numverts + 1) * h.edge_index_size);
+    h.vertex_property_offset =
+      csr_file_align(h.column_offset + numedges * h.vertex_size);
+    h.edge_property_offset =
+      csr_file_align(h.vertex_property_offset
+                     + numverts * h.vertex_property_size);
+    h.file_size = h.edge_property_offset + numedges * h.edge_property_size;
+    return h;
+  }
+
+  inline void write_csr_file_section(std::ostream& out,
+                                     boost::uint64_t& position,
+                                     boost::uint64_t offset,
+                                     const void* data,
+                                     boost::uint64_t size) {
+    static const char padding[csr_file_alignment] = {0};
+    BOOST_ASSERT (offset >= position && offset - position < csr_file_alignment);
+    out.write(padding, std::streamsize(offset - position));
+    if (size != 0)
+      out.write(static_cast<const char*>(data), std::streamsize(size));
+    position = offset + size;
+  }
+
+  // Minimal stand-in for the CSR structure of compressed_sparse_row_graph
+  // (see compressed_sparse_row_struct.hpp), pointing into the mapped file.
+  template <typename Vertex, typename EdgeIndex>
+  struct mapped_csr_structure {
+    const EdgeIndex* m_rowstart;
+    const Vertex* m_column;
+  };
+
+  // Read-only property map over the members of the property bundles stored
+  // in a mapped CSR graph.
+  template <typename Bundle, typename T, typename IndexMap>
+  class mapped_csr_member_map
+    : public put_get_helper<const T&,
+                            mapped_csr_member_map<Bundle, T, IndexMap> > {
+   public:
+    typedef typename property_traits<IndexMap>::key_type key_type;
+    typedef T value_type;
+    typedef const T& reference;
+    typedef readable_property_map_tag category;
+
+    mapped_csr_member_map() : m_bundles(0), m_member(0) {}
+    mapped_csr_member_map(const Bundle* bundles, T Bundle::* member,
+                          const IndexMap& index = IndexMap())
+      : m_bundles(bundles), m_member(member), m_index(index) {}
+
+    reference operator[](const key_type& k) const
+    { return m_bundles[get(m_index, k)].*m_member; }
+
+   private:
+    const Bundle* m_bundles;
+    T Bundle::* m_member;
+    IndexMap m_index;
+  };
+
+  template <typename Graph>
+  inline const typename Graph::vertex_bundled*
+  mapped_csr_bundles(const Graph& g, mpl::true_)
+  {
+    return g.m_vertex_properties;
+  }
+
+  template <typename Graph>
+  inline const typename Graph::edge_bundled*
+  mapped_csr_bundles(const Graph& g, mpl::false_)
+  {
+    return g.m_edge_properties;
+  }
+
+} // namespace detail
+
+/** Write a compressed sparse row graph to out in the binary CSR graph file
+ * format, which mapped_csr_graph can map back into memory.  Only the
+ * out-edge structure and the vertex and edge bundles are written; the bundles
+ * must be plain old data (or no_property).  The stream should be opened in
+ * binary mode.
+ */
+template <typename Directed, typename VertexProperty, typename EdgeProperty,
+          typename GraphProperty, typename Vertex, typename EdgeIndex>
+void
+write_csr_graph_binary(std::ostream& out,
+                       const compressed_sparse_row_graph<Directed,
+                         VertexProperty, EdgeProperty, GraphProperty,
+                         Vertex, EdgeIndex>& g)
+{
+  boost::uint64_t numverts = num_vertices(g), numedges = num_edges(g);
+  detail::csr_file_header h =
+    detail::make_csr_file_header<Vertex, EdgeIndex,
+                                 VertexProperty, EdgeProperty>
+      (numverts, numedges);
+
+  out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  boost::uint64_t position = sizeof(h);
+  detail::write_csr_file_section
+    (out, position, h.rowstart_offset, &g.m_forward.m_rowstart[0],
+     (numverts + 1) * h.edge_index_size);
+  detail::write_csr_file_section
+    (out, position, h.column_offset,
+     numedges ? &g.m_forward.m_column[0] : 0, numedges * h.vertex_size);
+  detail::write_csr_file_section
+    (out, position, h.vertex_property_offset,
+     numverts ? &g.m_vertex_properties[0] : 0,
+     numverts * h.vertex_property_size);
+  detail::write_csr_file_section
+    (out, position, h.edge_property_offset,
+     numedges ? &g.m_forward.m_edge_properties[0] : 0,
+     numedges * h.edge_property_size);
+  BOOST_ASSERT (position == h.file_size);
+}
+
+// Write g to the file called filename; throws std::ios_base::failure on
+// I/O errors.
+template <typename Directed, typename VertexProperty, typename EdgeProperty,
+          typename GraphProperty, typename Vertex, typename EdgeIndex>
+void
+write_csr_graph_binary(const std::string& filename,
+                       const compressed_sparse_row_graph<Directed,
+                         VertexProperty, EdgeProperty, GraphProperty,
+                         Vertex, EdgeIndex>& g)
+{
+  std::ofstream out;
+  out.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+  out.open(filename.c_str(), std::ios_base::out | std::ios_base::binary
+                             | std::ios_base::trunc);
+  write_csr_graph_binary(out, g);
+  out.close();
+}
+
+/** Read-only directed CSR graph backed by a file written by
+ * write_csr_graph_binary.
+ *
+ * The file is mapped into memory and never copied: out_edges, vertices,
+ * edges and the property maps read straight from the mapping, so opening a
+ * graph costs only the validation of its header, and processes that map the
+ * same file share one copy of it in the page cache.  Copies of a
+ * mapped_csr_graph share the same mapping, which stays alive as long as any
+ * of them does.
+ *
+ * The template parameters must match those of the compressed_sparse_row_graph
+ * that was written (graph properties are not stored); otherwise the
+ * constructor throws bad_csr_graph_file.
+ */
+template <typename VertexProperty = no_property,
+          typename EdgeProperty = no_property,
+          typename Vertex = std::size_t,
+          typename EdgeIndex = Vertex>
+class mapped_csr_graph
+{
+ public:
+  // For Graph
+  typedef Vertex vertex_descriptor;
+  typedef detail::csr_edge_descriptor<Vertex, EdgeIndex> edge_descriptor;
+  typedef directed_tag directed_category;
+  typedef allow_parallel_edge_tag edge_parallel_category;
+
+  class traversal_category: public incidence_graph_tag,
+                            public adjacency_graph_tag,
+                            public vertex_list_graph_tag,
+                            public edge_list_graph_tag {};
+
+  static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
+
+  // For VertexListGraph
+  typedef counting_iterator<Vertex> vertex_iterator;
+  typedef Vertex vertices_size_type;
+
+  // For EdgeListGraph
+  typedef EdgeIndex edges_size_type;
+  typedef detail::csr_edge_iterator<mapped_csr_graph> edge_iterator;
+
+  // For IncidenceGraph
+  typedef detail::csr_out_edge_iterator<mapped_csr_graph> out_edge_iterator;
+  typedef EdgeIndex degree_size_type;
+
+  // For AdjacencyGraph
+  typedef const Vertex* adjacency_iterator;
+
+  // For BidirectionalGraph (not implemented)
+  typedef void in_edge_iterator;
+
+  typedef VertexProperty vertex_bundled;
+  typedef EdgeProperty edge_bundled;
+  typedef no_property graph_bundled;
+  typedef no_property vertex_property_type;
+  typedef no_property edge_property_type;
+  typedef no_property graph_property_type;
+
+  // An empty graph with no mapping
+  mapped_csr_graph()
+    : m_vertex_properties(0), m_edge_properties(0), m_num_vertices(0),
+      m_num_edges(0) {
+    static const EdgeIndex empty_rowstart = 0;
+    m_forward.m_rowstart = &empty_rowstart;
+    m_forward.m_column = 0;
+  }
+
+  // Map the graph file called filename
+  explicit mapped_csr_graph(const std::string& filename) {
+    interprocess::file_mapping file(filename.c_str(), interprocess::read_only);
+    m_region.reset(new interprocess::mapped_region(file,
+                                                   interprocess::read_only));
+    attach(m_region->get_address(), m_region->get_size());
+  }
+
+  // Use a graph file that is already in memory at [data, data + size), for
+  // example in shared memory.  The memory must stay valid, and must be
+  // aligned to csr_file_alignment bytes, for the lifetime of the graph.
+  mapped_csr_graph(const void* data, std::size_t size) {
+    attach(data, size);
+  }
+
+  // The constructors only check the header and the first and last row
+  // starts, so that mapping a graph does not read it all.  For a file that
+  // may be corrupt, this also checks that the row starts never decrease and
+  // that every target is a vertex, and throws bad_csr_graph_file otherwise;
+  // the graph functions would read out of bounds.
+  void validate() const {
+    const EdgeIndex* rowstart = m_forward.m_rowstart;
+    for (Vertex v = 0; v < m_num_vertices; ++v)
+      if (rowstart[v + 1] < rowstart[v])
+        throw bad_csr_graph_file("row starts are not sorted");
+    for (EdgeIndex e = 0; e < m_num_edges; ++e)
+      if (!(m_forward.m_column[e] < m_num_vertices))
+        throw bad_csr_graph_file("edge target is not a vertex");
+  }
+
+  // Direct access to vertex and edge bundles
+  const VertexProperty& operator[](vertex_descriptor v) const
+  { return m_vertex_properties[v]; }
+
+  const EdgeProperty& operator[](const edge_descriptor& e) const
+  { return m_edge_properties[e.idx]; }
+
+  // private: non-portable, requires friend templates
+  detail::mapped_csr_structure<Vertex, EdgeIndex> m_forward;
+  const VertexProperty* m_vertex_properties;
+  const EdgeProperty* m_edge_properties;
+  Vertex m_num_vertices;
+  EdgeIndex m_num_edges;
+
+ private:
+  template <typename T>
+  const T* section(const char* base, boost::uint64_t offset) const {
+    return reinterpret_cast<const T*>(base + offset);
+  }
+
+  void attach(const void* data, std::size_t size) {
+    const char* base = static_cast<const char*>(data);
+    detail::csr_file_header h;
+    if (size < sizeof(h)) throw bad_csr_graph_file("file is too short");
+    std::memcpy(&h, base, sizeof(h));
+    if (std::memcmp(h.magic, detail::csr_file_magic, sizeof(h.magic)) != 0)
+      throw bad_csr_graph_file("bad magic number");
+    if (h.version != detail::csr_file_version)
+      throw bad_csr_graph_file("unsupported format version");
+    if (h.byte_order != detail::csr_file_byte_order)
+      throw bad_csr_graph_file("file was written with another byte order");
+    if (reinterpret_cast<std::size_t>(base) % detail::csr_file_alignment != 0)
+      throw bad_csr_graph_file("data is not suitably aligned");
+
+    // Every section is at most size bytes long in a file that fits, which
+    // keeps the offset arithmetic of make_csr_file_header from wrapping.
+    const boost::uint64_t vps =
+      detail::csr_file_property_size<VertexProperty>::value;
+    const boost::uint64_t eps =
+      detail::csr_file_property_size<EdgeProperty>::value;
+    if (h.num_vertices >= size / sizeof(EdgeIndex)
+        || h.num_edges > size / sizeof(Vertex)
+        || (vps != 0 && h.num_vertices > size / vps)
+        || (eps != 0 && h.num_edges > size / eps))
+      throw bad_csr_graph_file("file is truncated or corrupt");
+
+    detail::csr_file_header expected =
+      detail::make_csr_file_header<Vertex, EdgeIndex,
+                                   VertexProperty, EdgeProperty>
+        (h.num_vertices, h.num_edges);
+    if (h.vertex_size != expected.vertex_size
+        || h.edge_index_size != expected.edge_index_size)
+      throw bad_csr_graph_file("vertex or edge index type does not match");
+    if (h.vertex_property_size != expected.vertex_property_size
+        || h.edge_property_size != expected.edge_property_size)
+      throw bad_csr_graph_file("property type does not match");
+    if (h.num_vertices != boost::uint64_t(Vertex(h.num_vertices))
+        || h.num_edges != boost::uint64_t(EdgeIndex(h.num_edges)))
+      throw bad_csr_graph_file("graph is too large for the index types");
+    if (std::memcmp(&h, &expected, sizeof(h)) != 0 || size < h.file_size)
+      throw bad_csr_graph_file("file is truncated or corrupt");
+
+    m_num_vertices = Vertex(h.num_vertices);
+    m_num_edges = EdgeIndex(h.num_edges);
+    m_forward.m_rowstart = section<EdgeIndex>(base, h.rowstart_offset);
+    m_forward.m_column = section<Vertex>(base, h.column_offset);
+    m_vertex_properties =
+      section<VertexProperty>(base, h.vertex_property_offset);
+    m_edge_properties = section<EdgeProperty>(base, h.edge_property_offset);
+    if (m_forward.m_rowstart[0] != 0
+        || m_forward.m_rowstart[m_num_vertices] != m_num_edges)
+      throw bad_csr_graph_file("row starts do not match the edge count");
+  }
+
+  boost::shared_ptr<interprocess::mapped_region> m_region;
+};
+
+#define BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS                           \
+  typename VertexProperty, typename EdgeProperty,                       \
+  typename Vertex, typename EdgeIndex
+#define BOOST_MAPPED_CSR_GRAPH_TYPE                                     \
+  mapped_csr_graph<VertexProperty, EdgeProperty, Vertex, EdgeIndex>
+
+// From VertexListGraph
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+num_vertices(const BOOST_MAPPED_CSR_GRAPH_TYPE& g) {
+  return g.m_num_vertices;
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<counting_iterator<Vertex>, counting_iterator<Vertex> >
+vertices(const BOOST_MAPPED_CSR_GRAPH_TYPE& g) {
+  return std::make_pair(counting_iterator<Vertex>(0),
+                        counting_iterator<Vertex>(num_vertices(g)));
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+vertex(Vertex i, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+  return i;
+}
+
+// From IncidenceGraph
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+source(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e,
+       const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+  return e.src;
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+target(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e,
+       const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  return g.m_forward.m_column[e.idx];
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator,
+                 typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator>
+out_edges(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor ed;
+  typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator it;
+  return std::make_pair(it(ed(v, g.m_forward.m_rowstart[v])),
+                        it(ed(v, g.m_forward.m_rowstart[v + 1])));
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline EdgeIndex
+out_degree(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  return g.m_forward.m_rowstart[v + 1] - g.m_forward.m_rowstart[v];
+}
+
+// From AdjacencyGraph
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<const Vertex*, const Vertex*>
+adjacent_vertices(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  return std::make_pair(g.m_forward.m_column + g.m_forward.m_rowstart[v],
+                        g.m_forward.m_column + g.m_forward.m_rowstart[v + 1]);
+}
+
+// From EdgeListGraph
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline EdgeIndex
+num_edges(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  return g.m_num_edges;
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+std::pair<typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator,
+          typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator>
+edges(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator ei;
+  typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor edgedesc;
+  if (num_vertices(g) == 0 || num_edges(g) == 0) {
+    return std::make_pair(ei(), ei());
+  } else {
+    // Find the first vertex that has outgoing edges
+    Vertex src = 0;
+    while (g.m_forward.m_rowstart[src + 1] == 0) ++src;
+    return std::make_pair(ei(g, edgedesc(src, 0), g.m_forward.m_rowstart[src + 1]),
+                          ei(g, edgedesc(num_vertices(g), num_edges(g)), 0));
+  }
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor, bool>
+edge(Vertex i, Vertex j, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator out_edge_iter;
+  std::pair<out_edge_iter, out_edge_iter> range = out_edges(i, g);
+  for (; range.first != range.second; ++range.first) {
+    if (target(*range.first, g) == j)
+      return std::make_pair(*range.first, true);
+  }
+  return std::make_pair(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor(),
+                        false);
+}
+
+// Property maps
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+struct property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, vertex_index_t>
+{
+  typedef typed_identity_property_map<Vertex> type;
+  typedef type const_type;
+};
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+struct property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, edge_index_t>
+{
+  typedef detail::csr_edge_index_map<Vertex, EdgeIndex> type;
+  typedef type const_type;
+};
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+struct property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, vertex_bundle_t>
+{
+  typedef iterator_property_map<const VertexProperty*,
+                                typed_identity_property_map<Vertex>,
+                                VertexProperty, const VertexProperty&> type;
+  typedef type const_type;
+};
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+struct property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, edge_bundle_t>
+{
+  typedef iterator_property_map<const EdgeProperty*,
+                                detail::csr_edge_index_map<Vertex, EdgeIndex>,
+                                EdgeProperty, const EdgeProperty&> type;
+  typedef type const_type;
+};
+
+// Maps of the members of the vertex or edge bundle, as in get(&Edge::weight, g)
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS, typename T, typename Bundle>
+struct property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, T Bundle::*>
+{
+  typedef typename mpl::if_<
+            mpl::or_<is_same<VertexProperty, Bundle>,
+                     is_base_of<Bundle, VertexProperty> >,
+            detail::mapped_csr_member_map<VertexProperty, T,
+                                          typed_identity_property_map<Vertex> >,
+            detail::mapped_csr_member_map<EdgeProperty, T,
+                                          detail::csr_edge_index_map<Vertex, EdgeIndex> >
+          >::type type;
+  typedef type const_type;
+};
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline typed_identity_property_map<Vertex>
+get(vertex_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+  return typed_identity_property_map<Vertex>();
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+get(vertex_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&, Vertex v)
+{
+  return v;
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline detail::csr_edge_index_map<Vertex, EdgeIndex>
+get(edge_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+  return detail::csr_edge_index_map<Vertex, EdgeIndex>();
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline EdgeIndex
+get(edge_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+  return e.idx;
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline typename property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, vertex_bundle_t>::const_type
+get(vertex_bundle_t, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  return typename property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, vertex_bundle_t>
+           ::const_type(g.m_vertex_properties);
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS>
+inline typename property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, edge_bundle_t>::const_type
+get(edge_bundle_t, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  return typename property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, edge_bundle_t>
+           ::const_type(g.m_edge_properties);
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS, typename T, typename Bundle>
+inline typename property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, T Bundle::*>::const_type
+get(T Bundle::* member, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+  typedef typename property_map<BOOST_MAPPED_CSR_GRAPH_TYPE, T Bundle::*>
+            ::const_type result_type;
+  typedef typename mpl::or_<is_same<VertexProperty, Bundle>,
+                            is_base_of<Bundle, VertexProperty> >::type
+    is_vertex_bundle;
+  return result_type(detail::mapped_csr_bundles(g, is_vertex_bundle()),
+                     member);
+}
+
+template<BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS, typename T, typename Bundle, typename Key>
+inline const T&
+get(T Bundle::* member, const BOOST_MAPPED_CSR_GRAPH_TYPE& g, const Key& k)
+{
+  return get(get(member, g), k);
+}
+
+#undef BOOST_MAPPED_CSR_GRAPH_TYPE
+#undef BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_MAPPED_CSR_GRAPH_HPP
@@ -0,0 +1,265 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_MULTI_SOURCE_BFS_HPP
+#define BOOST_GRAPH_MULTI_SOURCE_BFS_HPP
+
+/*
+ * Bit-parallel multi-source breadth-first search (M. Then, M. Kaufmann,
+ * F. Chirigati, T.-A. Hoang-Vu, K. Pham, A. Kemper, T. Neumann and
+ * H. T. Vo, "The more the merrier: efficient multi-source graph traversal",
+ * PVLDB 8(4), 2014).
+ *
+ * Up to 64 * Words breadth-first searches run together, one per bit of a
+ * source_set.  Every vertex has three sets: the searches that have seen
+ * it, those for which it is in the current frontier and those for which
+ * it is in the next one.  Each level scans the out-edges of a frontier
+ * vertex once for all the searches that have it in their frontier, and
+ * advances all of them with a few word operations per edge, so the
+ * searches share both the edge scans and the memory traffic.
+ */
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/assert.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/numeric_values.hpp>
+#include <boost/graph/detail/bit_scan.hpp>
+
+namespace boost {
+
+  // Set of the sources of a batch, one bit per source
+  template <std::size_t Words>
+  class source_set
+  {
+  public:
+    BOOST_STATIC_CONSTANT(std::size_t, capacity = 64 * Words);
+
+    source_set() { clear(); }
+
+    void clear()
+    { for (std::size_t i = 0; i < Words; ++i) m_words[i] = 0; }
+
+    void set(std::size_t slot)
+    { m_words[slot / 64] |= boost::uint64_t(1) << (slot % 64); }
+
+    bool test(std::size_t slot) const
+    { return (m_words[slot / 64] >> (slot % 64)) & 1; }
+
+    bool none() const
+    {
+      boost::uint64_t any = 0;
+      for (std::size_t i = 0; i < Words; ++i) any |= m_words[i];
+      return any == 0;
+    }
+
+    // Call f(slot) for every source in the set, in increasing order
+    template <typename Function>
+    void for_each(Function f) const
+    {
+      for (std::size_t i = 0; i < Words; ++i)
+        for (boost::uint64_t x = m_words[i]; x != 0; x &= x - 1)
+          f(64 * i + graph::detail::lowest_bit(x));
+    }
+
+    // Add the sources of a that are not in *this to *this and to next;
+    // returns whether there were any
+    bool advance(const source_set& a, source_set& next)
+    {
+      boost::uint64_t any = 0;
+      for (std::size_t i = 0; i < Words; ++i) {
+        boost::uint64_t fresh = a.m_words[i] & ~m_words[i];
+        m_words[i] |= fresh;
+        next.m_words[i] |= fresh;
+        any |= fresh;
+      }
+      return any != 0;
+    }
+
+  private:
+    boost::uint64_t m_words[Words];
+  };
+
+  // Runs batches of up to 64 * Words breadth-first searches from given
+  // sources; the working sets are kept between batches.  The visitor's
+  //   vis.reached(v, sources, d)
+  // is called once for every vertex v and distance d with the sources of the
+  // batch (a source_set of their positions in the batch) that reach v at
+  // distance d, starting with the sources themselves at distance 0.
+  // Distances grow from one call to the next.
+  template <typename Graph, std::size_t Words = 1,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class multi_source_bfs
+  {
+  public:
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef source_set<Words> source_set_type;
+    BOOST_STATIC_CONSTANT(std::size_t, max_sources = 64 * Words);
+
+    explicit multi_source_bfs(const Graph& g)
+      : m_g(g), m_index(get(vertex_index, g)), m_seen(num_vertices(g)),
+        m_visit(num_vertices(g)), m_next(num_vertices(g)) {}
+
+    multi_source_bfs(const Graph& g, VertexIndexMap index)
+      : m_g(g), m_index(index), m_seen(num_vertices(g)),
+        m_visit(num_vertices(g)), m_next(num_vertices(g)) {}
+
+    // Search from the vertices in [first, last), at most max_sources of
+    // them; the i-th source is slot i of the source sets
+    template <typename InputIterator, typename Visitor>
+    void run(InputIterator first, InputIterator last, Visitor& vis)
+    {
+      BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+      m_frontier.clear();
+      for (std::size_t slot = 0; first != last; ++first, ++slot) {
+        BOOST_ASSERT(slot < max_sources);
+        std::size_t i = get(m_index, *first);
+        if (m_visit[i].none()) {
+          m_frontier.push_back(*first);
+          m_touched.push_back(i);
+        }
+        m_visit[i].set(slot);
+        m_seen[i].set(slot);
+      }
+      for (std::size_t j = 0; j < m_frontier.size(); ++j)
+        vis.reached(m_frontier[j],
+                    const_cast<const source_set_type&>
+                      (m_visit[get(m_index, m_frontier[j])]),
+                    std::size_t(0));
+
+      for (std::size_t d = 1; !m_frontier.empty(); ++d) {
+        m_next_frontier.clear();
+        for (std::size_t j = 0; j < m_frontier.size(); ++j) {
+          std::size_t u = get(m_index, m_frontier[j]);
+          const source_set_type& visit = m_visit[u];
+          typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(m_frontier[j], m_g);
+               ei != ei_end; ++ei) {
+            vertex_descriptor w = target(*ei, m_g);
+            std::size_t v = get(m_index, w);
+            bool fresh_vertex = m_next[v].none();
+            bool unseen = m_seen[v].none();
+            if (m_seen[v].advance(visit, m_next[v])) {
+              if (fresh_vertex) m_next_frontier.push_back(w);
+              if (unseen) m_touched.push_back(v);
+            }
+          }
+        }
+        for (std::size_t j = 0; j < m_frontier.size(); ++j)
+          m_visit[get(m_index, m_frontier[j])].clear();
+        for (std::size_t j = 0; j < m_next_frontier.size(); ++j) {
+          std::size_t v = get(m_index, m_next_frontier[j]);
+          vis.reached(m_next_frontier[j],
+                      const_cast<const source_set_type&>(m_next[v]), d);
+          m_visit[v] = m_next[v];
+          m_next[v].clear();
+        }
+        m_frontier.swap(m_next_frontier);
+      }
+
+      for (std::size_t j = 0; j < m_touched.size(); ++j)
+        m_seen[m_touched[j]].clear();
+      m_touched.clear();
+    }
+
+  private:
+    const Graph& m_g;
+    VertexIndexMap m_index;
+    std::vector<source_set_type> m_seen, m_visit, m_next;
+    std::vector<vertex_descriptor> m_frontier, m_next_frontier;
+    std::vector<std::size_t> m_touched;
+  };
+
+  namespace detail {
+
+    // Distances from one source, as all_bfs_distance_summaries reports them
+    struct bfs_distance_summary
+    {
+      std::size_t sum;           // of the distances to the reached vertices
+      std::size_t eccentricity;  // largest of them
+      std::size_t reached;       // number of reached vertices, the source too
+
+      // The sum and the eccentricity as detail::combine_distances gives
+      // them for a graph of n vertices: infinite unless every vertex is
+      // reached
+      template <typename Distance>
+      Distance total(std::size_t n) const
+      {
+        return reached == n ? Distance(sum)
+                            : numeric_values<Distance>::infinity();
+      }
+
+      template <typename Distance>
+      Distance farthest(std::size_t n) const
+      {
+        return reached == n ? Distance(eccentricity)
+                            : numeric_values<Distance>::infinity();
+      }
+    };
+
+    template <typename Vertex>
+    struct bfs_summary_visitor
+    {
+      struct add_distance
+      {
+        bfs_distance_summary* batch;
+        std::size_t d;
+        void operator()(std::size_t slot) const
+        {
+          batch[slot].sum += d;
+          batch[slot].eccentricity = d;
+          ++batch[slot].reached;
+        }
+      };
+
+      template <typename SourceSet>
+      void reached(Vertex, const SourceSet& sources, std::size_t d)
+      {
+        add_distance f = {batch, d};
+        sources.for_each(f);
+      }
+
+      bfs_distance_summary* batch;
+    };
+
+    // Summaries of the breadth-first searches from every vertex, indexed by
+    // vertex index
+    template <std::size_t Words, typename Graph, typename VertexIndexMap>
+    void
+    all_bfs_distance_summaries(const Graph& g, VertexIndexMap index,
+                               std::vector<bfs_distance_summary>& summaries)
+    {
+      BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      std::vector<Vertex> verts(vertices(g).first, vertices(g).second);
+      std::vector<bfs_distance_summary> batch(64 * Words);
+      summaries.resize(verts.size());
+
+      multi_source_bfs<Graph, Words, VertexIndexMap> bfs(g, index);
+      bfs_summary_visitor<Vertex> vis;
+      vis.batch = &batch[0];
+      for (std::size_t b = 0; b < verts.size(); b += 64 * Words) {
+        std::size_t e = (std::min)(verts.size(), b + 64 * Words);
+        for (std::size_t i = 0; i < e - b; ++i) {
+          batch[i].sum = batch[i].eccentricity = batch[i].reached = 0;
+        }
+        bfs.run(verts.begin() + b, verts.begin() + e, vis);
+        for (std::size_t i = b; i < e; ++i)
+          summaries[get(index, verts[i])] = batch[i - b];
+      }
+    }
+
+  } // namespace detail
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_MULTI_SOURCE_BFS_HPP
@@ -59,6 +59,9 @@ namespace boost {
   struct edges_equivalent_t { };
   struct index_in_heap_map_t { };
   struct max_priority_queue_t { };
+  struct delta_t { };
+  struct num_threads_t { };
+  struct search_workspace_t { };
 
 #define BOOST_BGL_DECLARE_NAMED_PARAMS \
     BOOST_BGL_ONE_PARAM_CREF(weight_map, edge_weight) \
@@ -82,6 +85,7 @@ namespace boost {
     BOOST_BGL_ONE_PARAM_CREF(vertex_index_map, vertex_index) \
     BOOST_BGL_ONE_PARAM_CREF(vertex_index1_map, vertex_index1) \
     BOOST_BGL_ONE_PARAM_CREF(vertex_index2_map, vertex_index2) \
+    BOOST_BGL_ONE_PARAM_CREF(edge_index_map, edge_index) \
     BOOST_BGL_ONE_PARAM_CREF(vertex_assignment_map, vertex_assignment_map) \
     BOOST_BGL_ONE_PARAM_CREF(visitor, graph_visitor) \
     BOOST_BGL_ONE_PARAM_CREF(distance_compare, distance_compare) \
@@ -111,7 +115,10 @@ namespace boost {
     BOOST_BGL_ONE_PARAM_CREF(vertices_equivalent, vertices_equivalent) \
     BOOST_BGL_ONE_PARAM_CREF(edges_equivalent, edges_equivalent) \
     BOOST_BGL_ONE_PARAM_CREF(index_in_heap_map, index_in_heap_map) \
-    BOOST_BGL_ONE_PARAM_REF(max_priority_queue, max_priority_queue)
+    BOOST_BGL_ONE_PARAM_REF(max_priority_queue, max_priority_queue) \
+    BOOST_BGL_ONE_PARAM_CREF(delta, delta) \
+    BOOST_BGL_ONE_PARAM_CREF(num_threads, num_threads) \
+    BOOST_BGL_ONE_PARAM_REF(workspace, search_workspace)
 
   template <typename T, typename Tag, typename Base = no_property>
   struct bgl_named_params
@@ -0,0 +1,334 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_BETWEENNESS_CENTRALITY_HPP
+#define BOOST_GRAPH_PARALLEL_BETWEENNESS_CENTRALITY_HPP
+
+/*
+ * Multithreaded Brandes betweenness centrality.
+ *
+ * The single-source problems of Brandes' algorithm are independent, so the
+ * sources are handed out to a fixed set of threads.  Each thread owns the
+ * incoming edge lists, distances, path counts and dependencies of its
+ * current source, and adds the dependencies to its own centrality vectors;
+ * no state is shared while the sources are processed.  The per-thread
+ * centralities are summed once all the sources are done, and only then
+ * written to the centrality maps.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <stack>
+#include <vector>
+#include <atomic>
+#include <exception>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/mpl/if.hpp>
+
+namespace boost {
+
+namespace detail { namespace graph {
+
+  // Per-thread edge centralities, indexed by edge index.  Without an edge
+  // centrality map, nothing is stored and the edge index map is unused.
+  template<typename EdgeCentralityMap, typename EdgeIndexMap, typename T>
+  struct parallel_brandes_edge_accumulator
+  {
+    typedef iterator_property_map<typename std::vector<T>::iterator,
+                                  EdgeIndexMap> type;
+
+    template<typename Graph>
+    static std::size_t size(const Graph& g) { return num_edges(g); }
+
+    static type make(std::vector<T>& partial, EdgeIndexMap edge_index)
+    { return type(partial.begin(), edge_index); }
+
+    template<typename Graph>
+    static void
+    store(const Graph& g, EdgeCentralityMap edge_centrality_map,
+          EdgeIndexMap edge_index, const std::vector<T>& sum)
+    {
+      typename graph_traits<Graph>::edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+        put(edge_centrality_map, *ei, sum[get(edge_index, *ei)]);
+    }
+  };
+
+  template<typename EdgeIndexMap, typename T>
+  struct parallel_brandes_edge_accumulator<dummy_property_map, EdgeIndexMap,
+                                           T>
+  {
+    typedef dummy_property_map type;
+
+    template<typename Graph>
+    static std::size_t size(const Graph&) { return 0; }
+
+    static type make(std::vector<T>&, EdgeIndexMap) { return type(); }
+
+    template<typename Graph>
+    static void
+    store(const Graph&, dummy_property_map, EdgeIndexMap,
+          const std::vector<T>&) { }
+  };
+
+  // Sum the per-thread vectors into the first one, dividing by divisor
+  template<typename T>
+  void
+  parallel_brandes_reduce(std::vector<std::vector<T> >& partial, T divisor,
+                          std::size_t num_threads)
+  {
+    std::vector<T>& sum = partial[0];
+    boost::graph::detail::parallel_for_blocks
+      (num_threads, sum.size(),
+       [&](std::size_t, std::size_t b, std::size_t e) {
+         for (std::size_t t = 1; t < partial.size(); ++t)
+           for (std::size_t i = b; i < e; ++i) sum[i] += partial[t][i];
+         for (std::size_t i = b; i < e; ++i) sum[i] /= divisor;
+       });
+  }
+
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap,
+           typename ShortestPaths>
+  void
+  parallel_brandes_betweenness_centrality_impl
+    (const Graph& g,
+     CentralityMap centrality,
+     EdgeCentralityMap edge_centrality_map,
+     VertexIndexMap vertex_index,
+     EdgeIndexMap edge_index,
+     ShortestPaths shortest_paths,
+     std::size_t num_threads)
+  {
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef typename graph_traits<Graph>::edge_descriptor edge_descriptor;
+    typedef typename graph_traits<Graph>::degree_size_type degree_size_type;
+    typedef typename mpl::if_c<(is_same<CentralityMap,
+                                        dummy_property_map>::value),
+                               EdgeCentralityMap,
+                               CentralityMap>::type a_centrality_map;
+    typedef typename property_traits<a_centrality_map>::value_type
+      centrality_type;
+    typedef parallel_brandes_edge_accumulator<EdgeCentralityMap, EdgeIndexMap,
+                                              centrality_type> accumulator;
+
+    num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+    std::vector<vertex_descriptor> verts(vertices(g).first,
+                                         vertices(g).second);
+    std::size_t n = verts.size();
+
+    std::vector<std::vector<centrality_type> > partial(num_threads);
+    std::vector<std::vector<centrality_type> > edge_partial(num_threads);
+    boost::graph::detail::chunk_dispenser<std::size_t> sources(0, n, 1);
+    std::atomic<bool> failed(false);
+
+    boost::graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      try {
+        // Workspaces of this thread; every vertex that a search touches is
+        // reached, so it is cleared again as it leaves ordered_vertices
+        std::vector<std::vector<edge_descriptor> > incoming_vec(n);
+        std::vector<centrality_type> distance_vec(n), dependency_vec(n);
+        std::vector<degree_size_type> path_count_vec(n, 0);
+        iterator_property_map<typename std::vector<std::vector<edge_descriptor> >::iterator,
+                              VertexIndexMap>
+          incoming(incoming_vec.begin(), vertex_index);
+        iterator_property_map<typename std::vector<centrality_type>::iterator,
+                              VertexIndexMap>
+          distance(distance_vec.begin(), vertex_index),
+          dependency(dependency_vec.begin(), vertex_index);
+        iterator_property_map<typename std::vector<degree_size_type>::iterator,
+                              VertexIndexMap>
+          path_count(path_count_vec.begin(), vertex_index);
+
+        std::vector<centrality_type>& my_centrality = partial[t];
+        my_centrality.assign(n, centrality_type(0));
+        edge_partial[t].assign(accumulator::size(g), centrality_type(0));
+        typename accumulator::type my_edge_centrality
+          = accumulator::make(edge_partial[t], edge_index);
+        ShortestPaths my_shortest_paths(shortest_paths);
+
+        std::stack<vertex_descriptor> ordered_vertices;
+        std::size_t b, e;
+        while (!failed.load(std::memory_order_relaxed) && sources.next(b, e)) {
+          for (std::size_t i = b; i < e; ++i) {
+            vertex_descriptor s = verts[i];
+            put(path_count, s, 1);
+            my_shortest_paths(g, s, ordered_vertices, incoming, distance,
+                              path_count, vertex_index);
+
+            while (!ordered_vertices.empty()) {
+              vertex_descriptor w = ordered_vertices.top();
+              ordered_vertices.pop();
+
+              typedef typename std::vector<edge_descriptor>::iterator
+                incoming_iterator;
+              for (incoming_iterator vw = incoming[w].begin();
+                   vw != incoming[w].end(); ++vw) {
+                vertex_descriptor v = source(*vw, g);
+                centrality_type factor
+                  = centrality_type(get(path_count, v))
+                    / centrality_type(get(path_count, w));
+                factor *= (centrality_type(1) + get(dependency, w));
+                put(dependency, v, get(dependency, v) + factor);
+                update_centrality(my_edge_centrality, *vw, factor);
+              }
+
+              if (w != s)
+                my_centrality[get(vertex_index, w)] += get(dependency, w);
+              incoming[w].clear();
+              put(path_count, w, 0);
+              put(dependency, w, centrality_type(0));
+            }
+          }
+        }
+      } catch (...) {
+        failed.store(true, std::memory_order_relaxed);
+        throw;
+      }
+    });
+
+    typedef typename graph_traits<Graph>::directed_category directed_category;
+    const bool is_undirected =
+      is_convertible<directed_category*, undirected_tag*>::value;
+    centrality_type divisor(is_undirected ? 2 : 1);
+
+    parallel_brandes_reduce(partial, divisor, num_threads);
+    for (std::size_t i = 0; i < n; ++i)
+      put(centrality, verts[i], partial[0][get(vertex_index, verts[i])]);
+    parallel_brandes_reduce(edge_partial, divisor, num_threads);
+    accumulator::store(g, edge_centrality_map, edge_index, edge_partial[0]);
+  }
+
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap, typename WeightMap>
+  void
+  parallel_brandes_betweenness_centrality_dispatch2
+    (const Graph& g, CentralityMap centrality,
+     EdgeCentralityMap edge_centrality_map, VertexIndexMap vertex_index,
+     EdgeIndexMap edge_index, WeightMap weight_map, std::size_t num_threads)
+  {
+    parallel_brandes_betweenness_centrality_impl
+      (g, centrality, edge_centrality_map, vertex_index, edge_index,
+       brandes_dijkstra_shortest_paths<WeightMap>(weight_map), num_threads);
+  }
+
+  template<typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+           typename VertexIndexMap, typename EdgeIndexMap>
+  void
+  parallel_brandes_betweenness_centrality_dispatch2
+    (const Graph& g, CentralityMap centrality,
+     EdgeCentralityMap edge_centrality_map, VertexIndexMap vertex_index,
+     EdgeIndexMap edge_index, param_not_found, std::size_t num_threads)
+  {
+    parallel_brandes_betweenness_centrality_impl
+      (g, centrality, edge_centrality_map, vertex_index, edge_index,
+       brandes_unweighted_shortest_paths(), num_threads);
+  }
+
+  // The edge index map is looked up only when there is an edge centrality
+  // map, so that graphs without edge indices can compute vertex centrality
+  template<typename EdgeCentralityMap>
+  struct parallel_brandes_betweenness_centrality_dispatch1
+  {
+    template<typename Graph, typename CentralityMap, typename VertexIndexMap,
+             typename Params>
+    static void
+    run(const Graph& g, CentralityMap centrality,
+        EdgeCentralityMap edge_centrality_map, VertexIndexMap vertex_index,
+        const Params& params)
+    {
+      parallel_brandes_betweenness_centrality_dispatch2
+        (g, centrality, edge_centrality_map, vertex_index,
+         choose_const_pmap(get_param(params, edge_index), g, edge_index),
+         get_param(params, edge_weight),
+         choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+    }
+  };
+
+  template<>
+  struct parallel_brandes_betweenness_centrality_dispatch1<param_not_found>
+  {
+    template<typename Graph, typename CentralityMap, typename VertexIndexMap,
+             typename Params>
+    static void
+    run(const Graph& g, CentralityMap centrality, param_not_found,
+        VertexIndexMap vertex_index, const Params& params)
+    {
+      parallel_brandes_betweenness_centrality_dispatch2
+        (g, centrality, dummy_property_map(), vertex_index,
+         dummy_property_map(), get_param(params, edge_weight),
+         choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+    }
+  };
+
+} } // end namespace detail::graph
+
+// Computes the same centralities as brandes_betweenness_centrality, up to
+// the rounding of the sums, which are formed in a different order.  Each
+// thread keeps its own workspace and centrality vectors, O(V) space per
+// thread (and O(E) more with an edge centrality map).  The edge index map
+// must map the edges to [0, num_edges(g)).  Named parameters:
+// centrality_map, edge_centrality_map, weight_map, vertex_index_map,
+// edge_index_map and num_threads (0, the default, uses one thread per
+// hardware thread).
+template<typename Graph, typename Param, typename Tag, typename Rest>
+void
+parallel_brandes_betweenness_centrality
+  (const Graph& g, const bgl_named_params<Param,Tag,Rest>& params
+   BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph,vertex_list_graph_tag))
+{
+  typedef bgl_named_params<Param,Tag,Rest> named_params;
+
+  typedef typename get_param_type<edge_centrality_t, named_params>::type ec;
+  detail::graph::parallel_brandes_betweenness_centrality_dispatch1<ec>::run(
+    g,
+    choose_param(get_param(params, vertex_centrality),
+                 dummy_property_map()),
+    get_param(params, edge_centrality),
+    choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+    params);
+}
+
+template<typename Graph, typename CentralityMap>
+typename disable_if<detail::graph::is_bgl_named_params<CentralityMap>,
+                    void>::type
+parallel_brandes_betweenness_centrality
+  (const Graph& g, CentralityMap centrality
+   BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph,vertex_list_graph_tag))
+{
+  detail::graph::parallel_brandes_betweenness_centrality_impl
+    (g, centrality, dummy_property_map(), get(vertex_index, g),
+     dummy_property_map(),
+     detail::graph::brandes_unweighted_shortest_paths(), 0);
+}
+
+template<typename Graph, typename CentralityMap, typename EdgeCentralityMap>
+void
+parallel_brandes_betweenness_centrality
+  (const Graph& g, CentralityMap centrality,
+   EdgeCentralityMap edge_centrality_map
+   BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph,vertex_list_graph_tag))
+{
+  detail::graph::parallel_brandes_betweenness_centrality_impl
+    (g, centrality, edge_centrality_map, get(vertex_index, g),
+     get(edge_index, g),
+     detail::graph::brandes_unweighted_shortest_paths(), 0);
+}
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BETWEENNESS_CENTRALITY_HPP
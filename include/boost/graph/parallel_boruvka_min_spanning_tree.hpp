@@ -0,0 +1,278 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_BORUVKA_MST_HPP
+#define BOOST_GRAPH_PARALLEL_BORUVKA_MST_HPP
+
+/*
+ * Multithreaded minimum spanning forest by Boruvka's algorithm.
+ *
+ * The edges between different vertices are first copied into an array,
+ * with their weights and the indices of their ends.  Each round then has
+ * three steps, separated by barriers:
+ *
+ * 1. Every edge offers itself to the components of both its ends, each
+ *    of which keeps the lightest edge offered by an atomic minimum on its
+ *    position in the array.  Ties are broken by position, which makes the
+ *    chosen edges a forest.
+ * 2. Each component takes its edge into the tree, unless it is the edge
+ *    of the other component too and that one comes first, and the two
+ *    components are joined by the lock-free union-find of
+ *    parallel_connected_components.
+ * 3. The paths from the ends of the chosen edges are compressed, the ends
+ *    of the edges are replaced by their roots, and the edges inside a
+ *    component are dropped while the others are compacted into a new
+ *    array, by a prefix sum over the blocks of the threads.
+ *
+ * The number of components at least halves in each round, and the rounds
+ * stop once no edge is left.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <atomic>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/parallel_connected_components.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    template <typename Edge, typename WeightValue>
+    struct boruvka_edge
+    {
+      Edge e;
+      WeightValue w;
+      // The roots of the ends at the start of the round
+      std::size_t u, v;
+    };
+
+    inline std::size_t union_find_root(union_find_parents& parent,
+                                       std::size_t v)
+    {
+      std::size_t p = parent[v].load(std::memory_order_relaxed);
+      while (p != v) {
+        v = p;
+        p = parent[v].load(std::memory_order_relaxed);
+      }
+      return v;
+    }
+
+  } // namespace detail
+
+  // The edges of a minimum spanning forest of g, as by
+  // kruskal_minimum_spanning_tree(g, spanning_tree_edges), with num_threads
+  // threads; zero stands for the number of hardware threads.  The edges of
+  // a directed graph are taken without their direction, so that a
+  // compressed_sparse_row_graph storing each edge of an undirected graph
+  // once or both ways can be used as it is.  The edges are written by the
+  // calling thread, in no particular order.
+  template <typename Graph, typename OutputIterator, typename WeightMap,
+            typename VertexIndexMap>
+  void
+  parallel_boruvka_minimum_spanning_tree(const Graph& g,
+                                         OutputIterator spanning_tree_edges,
+                                         WeightMap weight,
+                                         VertexIndexMap index,
+                                         std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typedef typename graph_traits<Graph>::edge_descriptor Edge;
+    BOOST_CONCEPT_ASSERT(( OutputIteratorConcept<OutputIterator, Edge> ));
+    BOOST_CONCEPT_ASSERT(( ReadablePropertyMapConcept<WeightMap, Edge> ));
+    typedef typename property_traits<WeightMap>::value_type W_value;
+    BOOST_CONCEPT_ASSERT(( ComparableConcept<W_value> ));
+    typedef detail::boruvka_edge<Edge, W_value> Record;
+    typedef typename graph_traits<Graph>::directed_category directed;
+    // Each edge of an undirected graph is seen from both ends, and only
+    // kept from the one with the smaller index
+    const bool undirected = is_convertible<directed, undirected_tag>::value;
+    const std::size_t none = std::size_t(-1), grain = 1024;
+
+    std::size_t n = num_vertices(g);
+    if (n == 0) return;
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    if (num_threads > n) num_threads = n;
+
+    std::vector<Vertex> verts(n);
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      verts[get(index, *vi)] = *vi;
+
+    detail::union_find_parents parent(n);
+    std::vector<std::atomic<std::size_t> > best(n);
+    std::vector<Record> records, next;
+    std::vector<std::size_t> offsets(num_threads + 1);
+    std::vector<std::vector<Edge> > tree(num_threads);
+    graph::detail::thread_barrier barrier(num_threads);
+    graph::detail::chunk_dispenser<std::size_t> chunks(0, 0, grain);
+
+    // Whether edge i is lighter than edge j, none being the heaviest
+    auto lighter = [&](std::size_t i, std::size_t j) {
+      return j == none || records[i].w < records[j].w
+        || (!(records[j].w < records[i].w) && i < j);
+    };
+    auto offer = [&](std::size_t c, std::size_t i) {
+      std::size_t current = best[c].load(std::memory_order_relaxed);
+      while (lighter(i, current)
+             && !best[c].compare_exchange_weak(current, i,
+                                               std::memory_order_relaxed))
+        ;
+    };
+
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      std::size_t first = graph::detail::block_begin(n, num_threads, t);
+      std::size_t last = graph::detail::block_begin(n, num_threads, t + 1);
+      for (std::size_t v = first; v < last; ++v) {
+        parent[v].store(v, std::memory_order_relaxed);
+        best[v].store(none, std::memory_order_relaxed);
+      }
+
+      // Copy the edges of the block of vertices of the thread, counting
+      // them first to find where they go
+      std::size_t count = 0;
+      for (std::size_t u = first; u < last; ++u) {
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(verts[u], g); ei != ei_end;
+             ++ei) {
+          std::size_t v = get(index, target(*ei, g));
+          if (v != u && (!undirected || u < v)) ++count;
+        }
+      }
+      offsets[t + 1] = count;
+      barrier.wait();
+      if (t == 0) {
+        for (std::size_t q = 0; q < num_threads; ++q)
+          offsets[q + 1] += offsets[q];
+        records.resize(offsets[num_threads]);
+        chunks.reset(0, records.size());
+      }
+      barrier.wait();
+      std::size_t pos = offsets[t];
+      for (std::size_t u = first; u < last; ++u) {
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(verts[u], g); ei != ei_end;
+             ++ei) {
+          std::size_t v = get(index, target(*ei, g));
+          if (v != u && (!undirected || u < v)) {
+            Record r = {*ei, get(weight, *ei), u, v};
+            records[pos++] = r;
+          }
+        }
+      }
+      barrier.wait();
+
+      std::vector<std::size_t> chosen;
+      while (!records.empty()) {
+        std::size_t b, e;
+        while (chunks.next(b, e))
+          for (std::size_t i = b; i < e; ++i) {
+            offer(records[i].u, i);
+            offer(records[i].v, i);
+          }
+        barrier.wait();
+
+        if (t == 0) chunks.reset(0, n);
+        barrier.wait();
+        chosen.clear();
+        while (chunks.next(b, e))
+          for (std::size_t c = b; c < e; ++c) {
+            std::size_t i = best[c].load(std::memory_order_relaxed);
+            if (i == none) continue;
+            std::size_t other = records[i].u == c ? records[i].v
+                                                  : records[i].u;
+            // When the edge is chosen by both components, the first one
+            // takes it
+            if (best[other].load(std::memory_order_relaxed) == i
+                && other < c)
+              continue;
+            chosen.push_back(i);
+          }
+        barrier.wait();
+        for (std::size_t k = 0; k < chosen.size(); ++k) {
+          const Record& r = records[chosen[k]];
+          detail::union_find_link(parent, r.u, r.v);
+          best[r.u].store(none, std::memory_order_relaxed);
+          best[r.v].store(none, std::memory_order_relaxed);
+          tree[t].push_back(r.e);
+        }
+        barrier.wait();
+        // Only the ends of the chosen edges were linked: pointing them to
+        // their roots leaves every end of an edge one step from its root
+        for (std::size_t k = 0; k < chosen.size(); ++k) {
+          const Record& r = records[chosen[k]];
+          parent[r.u].store(detail::union_find_root(parent, r.u),
+                            std::memory_order_relaxed);
+          parent[r.v].store(detail::union_find_root(parent, r.v),
+                            std::memory_order_relaxed);
+        }
+        barrier.wait();
+
+        // Keep the edges between different components, with the roots of
+        // their ends
+        std::size_t m = records.size();
+        std::size_t r_first = graph::detail::block_begin(m, num_threads, t);
+        std::size_t r_last = graph::detail::block_begin(m, num_threads,
+                                                        t + 1);
+        std::size_t kept = r_first;
+        for (std::size_t i = r_first; i < r_last; ++i) {
+          Record r = records[i];
+          r.u = detail::union_find_root(parent, r.u);
+          r.v = detail::union_find_root(parent, r.v);
+          if (r.u != r.v) records[kept++] = r;
+        }
+        offsets[t + 1] = kept - r_first;
+        barrier.wait();
+        if (t == 0) {
+          for (std::size_t q = 0; q < num_threads; ++q)
+            offsets[q + 1] += offsets[q];
+          next.resize(offsets[num_threads]);
+        }
+        barrier.wait();
+        std::copy(records.begin() + r_first, records.begin() + kept,
+                  next.begin() + offsets[t]);
+        barrier.wait();
+        if (t == 0) {
+          records.swap(next);
+          std::vector<Record>().swap(next);
+          chunks.reset(0, records.size());
+        }
+        barrier.wait();
+      }
+    });
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+      for (std::size_t k = 0; k < tree[t].size(); ++k)
+        *spanning_tree_edges++ = tree[t][k];
+  }
+
+  template <typename Graph, typename OutputIterator>
+  inline void
+  parallel_boruvka_minimum_spanning_tree(const Graph& g,
+                                         OutputIterator spanning_tree_edges,
+                                         std::size_t num_threads = 0)
+  {
+    parallel_boruvka_minimum_spanning_tree(g, spanning_tree_edges,
+                                           get(edge_weight, g),
+                                           get(vertex_index, g),
+                                           num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BORUVKA_MST_HPP
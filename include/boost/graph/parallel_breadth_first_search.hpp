@@ -0,0 +1,151 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
+#define BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
+
+/*
+ * Multithreaded level-synchronous breadth-first search.
+ *
+ * The vertices of each level (the frontier) are handed out in chunks to a
+ * fixed set of threads, which scan their out-edges and claim each newly
+ * reached vertex by atomically setting its bit in an atomic_bit_map.  The
+ * thread that wins a vertex appends it to its own part of the next
+ * frontier, and the parts are concatenated once every thread has finished
+ * the level.  Levels are separated by barriers, so every vertex is
+ * discovered at the same depth as in the serial breadth_first_search.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <exception>
+#include <algorithm>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/atomic_bit_map.hpp>
+
+namespace boost {
+
+  // Visitor contract: all threads share vis, and its event functions are
+  // called concurrently.  discover_vertex(v) and tree_edge(e) with target v
+  // are called exactly once per reached vertex v, by the thread that claimed
+  // it; examine_vertex, examine_edge, non_tree_edge and finish_vertex by the
+  // thread that scans the frontier vertex.  gray_target and black_target are
+  // never called.  Every event of level k happens before every event of
+  // level k + 1, so a visitor may read what it stored for the vertices of
+  // earlier levels (record_distances and record_predecessors work, given
+  // property maps whose distinct elements can be written concurrently).
+  // initialize_vertex is called for every vertex before the search starts.
+  // num_threads == 0 uses one thread per hardware thread.
+  template <typename Graph, typename BFSVisitor, typename VertexIndexMap>
+  void
+  parallel_breadth_first_search
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     BFSVisitor vis, VertexIndexMap index, std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    typedef graph_traits<Graph> Traits;
+    typedef typename Traits::vertex_descriptor Vertex;
+
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    atomic_bit_map<VertexIndexMap> visited(num_vertices(g), index);
+
+    typename Traits::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      vis.initialize_vertex(*vi, g);
+    put(visited, s, true);
+    vis.discover_vertex(s, g);
+
+    std::vector<Vertex> frontier(1, s), next;
+    std::vector<std::vector<Vertex> > local(num_threads);
+    std::vector<std::size_t> offsets(num_threads + 1);
+    graph::detail::chunk_dispenser<std::size_t> chunks(0, 1, 64);
+    graph::detail::thread_barrier barrier(num_threads);
+    std::atomic<bool> failed(false);
+
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      std::vector<Vertex>& mine = local[t];
+      std::exception_ptr error;
+      for (;;) {
+        // Expand this thread's share of the frontier
+        try {
+          std::size_t b, e;
+          while (!failed.load(std::memory_order_relaxed)
+                 && chunks.next(b, e)) {
+            for (std::size_t i = b; i < e; ++i) {
+              Vertex u = frontier[i];
+              vis.examine_vertex(u, g);
+              typename Traits::out_edge_iterator ei, ei_end;
+              for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end;
+                   ++ei) {
+                vis.examine_edge(*ei, g);
+                Vertex v = target(*ei, g);
+                if (test_and_set(visited, v)) {
+                  vis.tree_edge(*ei, g);
+                  vis.discover_vertex(v, g);
+                  mine.push_back(v);
+                } else {
+                  vis.non_tree_edge(*ei, g);
+                }
+              }
+              vis.finish_vertex(u, g);
+            }
+          }
+        } catch (...) {
+          // Keep meeting the other threads at the barriers and stop with
+          // them at the end of the level
+          error = std::current_exception();
+          failed.store(true, std::memory_order_relaxed);
+        }
+        barrier.wait();
+        if (failed.load(std::memory_order_relaxed)) break;
+
+        // Concatenate the parts of the next frontier
+        offsets[t + 1] = mine.size();
+        barrier.wait();
+        if (t == 0) {
+          for (std::size_t i = 0; i < num_threads; ++i)
+            offsets[i + 1] += offsets[i];
+          next.resize(offsets[num_threads]);
+        }
+        barrier.wait();
+        std::copy(mine.begin(), mine.end(), next.begin() + offsets[t]);
+        mine.clear();
+        barrier.wait();
+        if (t == 0) {
+          frontier.swap(next);
+          chunks.reset(0, frontier.size());
+        }
+        barrier.wait();
+        if (frontier.empty()) break;
+      }
+      if (error) std::rethrow_exception(error);
+    });
+  }
+
+  template <typename Graph, typename BFSVisitor>
+  void
+  parallel_breadth_first_search
+    (const Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor s,
+     BFSVisitor vis, std::size_t num_threads = 0)
+  {
+    parallel_breadth_first_search(g, s, vis, get(vertex_index, g),
+                                  num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
@@ -0,0 +1,302 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_CONNECTED_COMPONENTS_HPP
+#define BOOST_GRAPH_PARALLEL_CONNECTED_COMPONENTS_HPP
+
+/*
+ * Multithreaded connected components by concurrent union-find, following
+ * Afforest (M. Sutton, T. Ben-Nun and A. Barak, "Optimizing parallel graph
+ * connectivity computation via subgraph sampling", IPDPS 2018).
+ *
+ * Every vertex starts as its own root, and linking two trees makes the
+ * root with the larger index point to the other one by compare-and-swap,
+ * retrying from the new roots when another thread got there first.  The
+ * parents thus only ever decrease, which makes the structure lock-free, and
+ * the root of a component is its smallest vertex.  The threads first link
+ * each vertex to its first two neighbors and compress the paths; a sample
+ * of the vertices then gives the largest component found so far, and only
+ * the vertices outside it need to link their other neighbors.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    typedef std::vector<std::atomic<std::size_t> > union_find_parents;
+
+    // Joins the trees of u and v, making the larger root point to the
+    // smaller one
+    inline void union_find_link(union_find_parents& parent, std::size_t u,
+                                std::size_t v)
+    {
+      std::size_t p1 = parent[u].load(std::memory_order_relaxed);
+      std::size_t p2 = parent[v].load(std::memory_order_relaxed);
+      while (p1 != p2) {
+        std::size_t high = (std::max)(p1, p2), low = (std::min)(p1, p2);
+        std::size_t p_high = parent[high].load(std::memory_order_relaxed);
+        if (p_high == low) return;
+        if (p_high == high
+            && parent[high].compare_exchange_strong(p_high, low,
+                                                    std::memory_order_acq_rel))
+          return;
+        p1 = parent[parent[high].load(std::memory_order_relaxed)]
+               .load(std::memory_order_relaxed);
+        p2 = parent[low].load(std::memory_order_relaxed);
+      }
+    }
+
+    // Makes the vertices of [first, last) point to their roots; no link
+    // may run at the same time
+    inline void union_find_compress(union_find_parents& parent,
+                                    std::size_t first, std::size_t last)
+    {
+      for (std::size_t v = first; v < last; ++v) {
+        std::size_t p = parent[v].load(std::memory_order_relaxed);
+        std::size_t pp = parent[p].load(std::memory_order_relaxed);
+        while (p != pp) {
+          p = pp;
+          pp = parent[p].load(std::memory_order_relaxed);
+        }
+        parent[v].store(p, std::memory_order_relaxed);
+      }
+    }
+
+    // The most frequent root among num_samples vertices drawn at random
+    inline std::size_t union_find_sample_largest(union_find_parents& parent,
+                                                 std::size_t num_samples)
+    {
+      std::size_t n = parent.size();
+      minstd_rand gen(1);
+      std::vector<std::size_t> roots(num_samples);
+      for (std::size_t i = 0; i < num_samples; ++i)
+        roots[i] = parent[gen() % n].load(std::memory_order_relaxed);
+      std::sort(roots.begin(), roots.end());
+      std::size_t best = roots[0], best_count = 0;
+      for (std::size_t i = 0; i < num_samples;) {
+        std::size_t j = i;
+        while (j < num_samples && roots[j] == roots[i]) ++j;
+        if (j - i > best_count) {
+          best = roots[i];
+          best_count = j - i;
+        }
+        i = j;
+      }
+      return best;
+    }
+
+    // Numbers the roots 0, 1, ... in increasing order, as the depth-first
+    // search of connected_components does, and calls put_number(v, k) with
+    // the number k of the root of each vertex v.  The parents must be
+    // compressed.  Returns the number of components.
+    template <typename PutNumber>
+    std::size_t union_find_number_components(union_find_parents& parent,
+                                             PutNumber put_number,
+                                             std::size_t num_threads)
+    {
+      std::size_t n = parent.size();
+      std::vector<std::size_t> number(n), block_roots(num_threads + 1);
+      graph::detail::thread_barrier barrier(num_threads);
+      graph::detail::parallel_for_blocks
+        (num_threads, n, [&](std::size_t t, std::size_t first,
+                             std::size_t last) {
+          std::size_t count = 0;
+          for (std::size_t v = first; v < last; ++v)
+            if (parent[v].load(std::memory_order_relaxed) == v) ++count;
+          block_roots[t + 1] = count;
+          barrier.wait();
+          std::size_t next = 0;
+          for (std::size_t q = 0; q <= t; ++q) next += block_roots[q];
+          for (std::size_t v = first; v < last; ++v)
+            if (parent[v].load(std::memory_order_relaxed) == v)
+              number[v] = next++;
+          barrier.wait();
+          for (std::size_t v = first; v < last; ++v)
+            put_number(v, number[parent[v].load(std::memory_order_relaxed)]);
+        });
+      std::size_t total = 0;
+      for (std::size_t t = 1; t <= num_threads; ++t) total += block_roots[t];
+      return total;
+    }
+
+    template <typename Graph, typename VertexIndexMap, typename Vertex>
+    inline void afforest_link_in_edges(const Graph& g, VertexIndexMap index,
+                                       union_find_parents& parent,
+                                       std::size_t i, Vertex v, mpl::true_)
+    {
+      typename graph_traits<Graph>::in_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = in_edges(v, g); ei != ei_end; ++ei)
+        union_find_link(parent, i, get(index, source(*ei, g)));
+    }
+
+    template <typename Graph, typename VertexIndexMap, typename Vertex>
+    inline void afforest_link_in_edges(const Graph&, VertexIndexMap,
+                                       union_find_parents&, std::size_t,
+                                       Vertex, mpl::false_)
+    {}
+
+  } // namespace detail
+
+  // The connected components of connected_components(g, c), numbered in
+  // the same way, with num_threads threads; zero stands for the number of
+  // hardware threads.  The edges of a directed graph are taken without
+  // their direction, giving its weakly connected components.  Returns the
+  // number of components.
+  template <typename Graph, typename ComponentMap, typename VertexIndexMap>
+  typename property_traits<ComponentMap>::value_type
+  parallel_connected_components(const Graph& g, ComponentMap c,
+                                VertexIndexMap index, std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typedef typename property_traits<ComponentMap>::value_type comp_type;
+    typedef typename graph_traits<Graph>::directed_category directed;
+    typedef typename graph_traits<Graph>::traversal_category traversal;
+    // The largest component may only be skipped if every edge is seen from
+    // both ends, which takes the in-edges of a directed graph
+    const bool undirected = is_convertible<directed, undirected_tag>::value;
+    typedef mpl::bool_<!is_convertible<directed, undirected_tag>::value
+                       && is_convertible<traversal,
+                                         bidirectional_graph_tag>::value>
+      use_in_edges;
+    const bool skip_largest = undirected || use_in_edges::value;
+    const std::size_t rounds = 2, num_samples = 1024;
+
+    std::size_t n = num_vertices(g);
+    if (n == 0) return comp_type(0);
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    if (num_threads > n) num_threads = n;
+
+    std::vector<Vertex> verts(n);
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      verts[get(index, *vi)] = *vi;
+
+    detail::union_find_parents parent(n);
+    std::size_t largest = n;
+    graph::detail::thread_barrier barrier(num_threads);
+    graph::detail::chunk_dispenser<std::size_t> chunks(0, n, 256);
+
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      std::size_t first = graph::detail::block_begin(n, num_threads, t);
+      std::size_t last = graph::detail::block_begin(n, num_threads, t + 1);
+      for (std::size_t i = first; i < last; ++i)
+        parent[i].store(i, std::memory_order_relaxed);
+      barrier.wait();
+
+      // Link each vertex to its r-th neighbor in round r
+      for (std::size_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = first; i < last; ++i) {
+          typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+          boost::tie(ei, ei_end) = out_edges(verts[i], g);
+          for (std::size_t k = 0; k < r && ei != ei_end; ++k) ++ei;
+          if (ei != ei_end)
+            detail::union_find_link(parent, i, get(index, target(*ei, g)));
+        }
+        barrier.wait();
+        detail::union_find_compress(parent, first, last);
+        barrier.wait();
+      }
+
+      if (t == 0 && skip_largest)
+        largest = detail::union_find_sample_largest(parent, num_samples);
+      barrier.wait();
+
+      // Link the other neighbors of the vertices outside the largest
+      // component, in chunks since its vertices take no time
+      std::size_t b, e;
+      while (chunks.next(b, e))
+        for (std::size_t i = b; i < e; ++i) {
+          if (parent[i].load(std::memory_order_relaxed) == largest) continue;
+          typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+          boost::tie(ei, ei_end) = out_edges(verts[i], g);
+          for (std::size_t k = 0; k < rounds && ei != ei_end; ++k) ++ei;
+          for (; ei != ei_end; ++ei)
+            detail::union_find_link(parent, i, get(index, target(*ei, g)));
+          detail::afforest_link_in_edges(g, index, parent, i, verts[i],
+                                         use_in_edges());
+        }
+      barrier.wait();
+      detail::union_find_compress(parent, first, last);
+    });
+
+    return comp_type(detail::union_find_number_components
+      (parent, [&](std::size_t i, std::size_t k) {
+        put(c, verts[i], comp_type(k));
+      }, num_threads));
+  }
+
+  template <typename Graph, typename ComponentMap>
+  inline typename property_traits<ComponentMap>::value_type
+  parallel_connected_components(const Graph& g, ComponentMap c,
+                                std::size_t num_threads = 0)
+  {
+    return parallel_connected_components(g, c, get(vertex_index, g),
+                                         num_threads);
+  }
+
+  // The connected components of the graph on the vertices 0, ..., n - 1
+  // whose edges are the pairs of [first, last), without building it.  The
+  // component map is indexed by the vertex numbers.
+  template <typename EdgeIterator, typename ComponentMap>
+  typename property_traits<ComponentMap>::value_type
+  parallel_connected_components(EdgeIterator first, EdgeIterator last,
+                                std::size_t n, ComponentMap c,
+                                std::size_t num_threads = 0)
+  {
+    typedef typename property_traits<ComponentMap>::value_type comp_type;
+    if (n == 0) return comp_type(0);
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    if (num_threads > n) num_threads = n;
+
+    detail::union_find_parents parent(n);
+    std::size_t m = last - first;
+    graph::detail::thread_barrier barrier(num_threads);
+    graph::detail::chunk_dispenser<std::size_t> chunks(0, m, 1024);
+
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      std::size_t vb = graph::detail::block_begin(n, num_threads, t);
+      std::size_t ve = graph::detail::block_begin(n, num_threads, t + 1);
+      for (std::size_t v = vb; v < ve; ++v)
+        parent[v].store(v, std::memory_order_relaxed);
+      barrier.wait();
+      std::size_t b, e;
+      while (chunks.next(b, e))
+        for (EdgeIterator ei = first + b; ei != first + e; ++ei)
+          detail::union_find_link(parent, std::size_t(ei->first),
+                                  std::size_t(ei->second));
+      barrier.wait();
+      detail::union_find_compress(parent, vb, ve);
+    });
+
+    return comp_type(detail::union_find_number_components
+      (parent, [&](std::size_t v, std::size_t k) {
+        put(c, v, comp_type(k));
+      }, num_threads));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_CONNECTED_COMPONENTS_HPP
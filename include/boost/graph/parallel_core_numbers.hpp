@@ -0,0 +1,159 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_CORE_NUMBERS_HPP
+#define BOOST_GRAPH_PARALLEL_CORE_NUMBERS_HPP
+
+/*
+ * Multithreaded core numbers of an unweighted graph by level-synchronous
+ * peeling (H. Kabir and K. Madduri, "Parallel k-core decomposition on
+ * multicore platforms", IPDPSW 2017).
+ *
+ * Level k removes every remaining vertex whose degree has dropped to k.
+ * Each thread owns a block of vertices and keeps the list of those that
+ * remain; it first collects those of degree k, and after a barrier removes
+ * them, decrementing the degrees of their out-neighbors atomically.  The
+ * thread whose decrement brings a neighbor from k + 1 down to k removes that
+ * neighbor in the same level, so the level ends when no degree reaches k
+ * any more.  A level that removes nothing moves straight to the smallest
+ * remaining degree.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  // The core numbers of core_numbers(g, c) in the unweighted case: the
+  // degree of a vertex is the number of edges into it, and removing a
+  // vertex decrements the degrees of the targets of its out-edges.  Returns
+  // the largest core number.  num_threads == 0 uses one thread per hardware
+  // thread.
+  template <typename Graph, typename CoreMap, typename VertexIndexMap>
+  typename property_traits<CoreMap>::value_type
+  parallel_core_numbers(const Graph& g, CoreMap c, VertexIndexMap index,
+                        std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    typedef typename property_traits<CoreMap>::value_type core_type;
+
+    std::size_t n = num_vertices(g);
+    if (n == 0) return core_type(0);
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    if (num_threads > n) num_threads = n;
+
+    std::vector<Vertex> verts(n);
+    typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+      verts[get(index, *vi)] = *vi;
+
+    std::vector<std::atomic<std::size_t> > degree(n);
+    std::vector<std::size_t> core(n);
+    std::vector<char> removed(n);
+    // Indexed by the parity of the level, so that a thread may start the
+    // next level while another still reads those of the previous one
+    std::vector<std::size_t> level_removed[2], level_min[2];
+    for (int p = 0; p < 2; ++p) {
+      level_removed[p].resize(num_threads);
+      level_min[p].resize(num_threads);
+    }
+    graph::detail::thread_barrier barrier(num_threads);
+    const std::size_t none = (std::numeric_limits<std::size_t>::max)();
+
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      std::size_t first = graph::detail::block_begin(n, num_threads, t);
+      std::size_t last = graph::detail::block_begin(n, num_threads, t + 1);
+      for (std::size_t i = first; i < last; ++i) {
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(verts[i], g); ei != ei_end;
+             ++ei)
+          degree[get(index, target(*ei, g))]
+            .fetch_add(1, std::memory_order_relaxed);
+      }
+      std::vector<std::size_t> remaining, peel;
+      for (std::size_t i = first; i < last; ++i) remaining.push_back(i);
+      barrier.wait();
+
+      std::size_t k = 0, left = n;
+      for (int p = 0; left > 0; p ^= 1) {
+        // Collect the vertices of degree k and drop those removed by other
+        // threads from the list
+        peel.clear();
+        std::size_t low = none, kept = 0;
+        for (std::size_t j = 0; j < remaining.size(); ++j) {
+          std::size_t v = remaining[j];
+          if (removed[v]) continue;
+          std::size_t d = degree[v].load(std::memory_order_relaxed);
+          if (d == k) peel.push_back(v);
+          else {
+            if (d < low) low = d;
+            remaining[kept++] = v;
+          }
+        }
+        remaining.resize(kept);
+        level_min[p][t] = low;
+        barrier.wait();
+
+        for (std::size_t j = 0; j < peel.size(); ++j) {
+          std::size_t v = peel[j];
+          core[v] = k;
+          removed[v] = 1;
+          typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(verts[v], g); ei != ei_end;
+               ++ei) {
+            std::size_t u = get(index, target(*ei, g));
+            if (degree[u].load(std::memory_order_relaxed) <= k) continue;
+            std::size_t d = degree[u].fetch_sub(1, std::memory_order_relaxed);
+            if (d == k + 1) peel.push_back(u);
+            else if (d <= k) degree[u].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+        level_removed[p][t] = peel.size();
+        barrier.wait();
+
+        std::size_t total = 0;
+        low = none;
+        for (std::size_t q = 0; q < num_threads; ++q) {
+          total += level_removed[p][q];
+          if (level_min[p][q] < low) low = level_min[p][q];
+        }
+        left -= total;
+        k = total > 0 ? k + 1 : low;
+      }
+    });
+
+    core_type result(0);
+    for (std::size_t i = 0; i < n; ++i) {
+      put(c, verts[i], core_type(core[i]));
+      if (core_type(core[i]) > result) result = core_type(core[i]);
+    }
+    return result;
+  }
+
+  template <typename Graph, typename CoreMap>
+  inline typename property_traits<CoreMap>::value_type
+  parallel_core_numbers(const Graph& g, CoreMap c, std::size_t num_threads = 0)
+  {
+    return parallel_core_numbers(g, c, get(vertex_index, g), num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_CORE_NUMBERS_HPP
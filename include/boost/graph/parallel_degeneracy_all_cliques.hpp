@@ -0,0 +1,79 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_DEGENERACY_ALL_CLIQUES_HPP
+#define BOOST_GRAPH_PARALLEL_DEGENERACY_ALL_CLIQUES_HPP
+
+/*
+ * Multithreaded degeneracy_all_cliques.
+ *
+ * The searches from the vertices of the degeneracy order are independent:
+ * the threads take the vertices in small chunks, each with a search of its
+ * own.  The visitor is shared, and a mutex serializes the calls to it.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <mutex>
+#include <boost/graph/degeneracy_all_cliques.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    // Passes the cliques of one thread to the shared visitor
+    template <typename Visitor>
+    struct locked_clique_visitor
+    {
+      template <typename Clique, typename Graph>
+      void clique(const Clique& c, Graph& g)
+      {
+        std::lock_guard<std::mutex> lock(*mutex);
+        vis->clique(c, g);
+      }
+
+      Visitor* vis;
+      std::mutex* mutex;
+    };
+
+  } // namespace detail
+
+  // degeneracy_all_cliques with num_threads threads, including the calling
+  // one; zero stands for the number of hardware threads.  The cliques are
+  // visited in an unspecified order, one at a time.
+  template <typename Graph, typename Visitor>
+  void parallel_degeneracy_all_cliques(const Graph& g, Visitor vis,
+                                       std::size_t min,
+                                       std::size_t num_threads = 0)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( AdjacencyGraphConcept<Graph> ));
+    typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+    BOOST_CONCEPT_ASSERT(( CliqueVisitorConcept<Visitor,std::deque<Vertex>,Graph> ));
+    typedef detail::locked_clique_visitor<Visitor> Locked;
+
+    detail::clique_search_graph<Graph> sg(g);
+    std::size_t n = sg.order.size();
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    std::mutex mutex;
+    graph::detail::chunk_dispenser<std::size_t> chunks(0, n, 8);
+    graph::detail::run_in_parallel(num_threads, [&](std::size_t) {
+      Locked locked = {&vis, &mutex};
+      detail::degeneracy_clique_search<Graph, Locked> search(g, sg, locked,
+                                                             min);
+      std::size_t b, e;
+      while (chunks.next(b, e))
+        for (std::size_t k = b; k < e; ++k) search(sg.order[k]);
+    });
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_DEGENERACY_ALL_CLIQUES_HPP
@@ -0,0 +1,223 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_PAGE_RANK_HPP
+#define BOOST_GRAPH_PARALLEL_PAGE_RANK_HPP
+
+/*
+ * Multithreaded pull-based PageRank.
+ *
+ * Each iteration first computes, for every vertex u, the share
+ * rank(u) / out_degree(u) that it passes along each of its out-edges, from
+ * inverse out-degrees computed once; then every vertex sums the shares of
+ * the sources of its in-edges.  Each vertex is written by one thread only,
+ * so no atomics are needed.  The rank of the vertices without out-edges
+ * (dangling vertices) is spread evenly over all the vertices instead of
+ * being lost, which keeps the sum of the ranks at num_vertices(g) without
+ * removing the dangling vertices from the graph.  The vertices are split
+ * into one contiguous block per thread with about the same number of
+ * in-edges, and the iterations stop when the L1 norm of the change in the
+ * ranks falls below a tolerance.
+ *
+ * parallel_personalized_page_rank runs the local pushes of
+ * personalized_page_rank_push for many seeds at once.  Each thread has its
+ * own push object, whose per-vertex arrays it reuses from one seed to the
+ * next, and takes the seeds in small chunks as it finishes the previous
+ * ones.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <cmath>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/graph/personalized_page_rank.hpp>
+
+namespace boost { namespace graph {
+
+// Computes the ranks that page_rank converges to when every dangling vertex
+// is treated as linking to all the vertices: the fixed point of
+//   rank(v) = (1 - damping) + damping * (sum over in-edges (u, v) of
+//             rank(u) / out_degree(u) + dangling rank / num_vertices(g)),
+// whose ranks sum to num_vertices(g).  Iterates from ranks of 1 until the
+// sum of the absolute changes of the ranks over an iteration is at most
+// tolerance * num_vertices(g), or for max_iterations iterations, and
+// returns the number of iterations.  num_threads == 0 uses one thread per
+// hardware thread.
+template<typename Graph, typename RankMap, typename VertexIndexMap>
+std::size_t
+parallel_page_rank(const Graph& g, RankMap rank_map,
+                   typename property_traits<RankMap>::value_type damping,
+                   typename property_traits<RankMap>::value_type tolerance,
+                   std::size_t max_iterations, VertexIndexMap index,
+                   std::size_t num_threads)
+{
+  BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+  BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+  typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename property_traits<RankMap>::value_type rank_type;
+
+  std::size_t n = num_vertices(g);
+  if (n == 0) return 0;
+  num_threads = detail::resolve_num_threads(num_threads);
+  if (num_threads > n) num_threads = n;
+
+  // Vertices in index order, their inverse out-degrees and the indices of
+  // the dangling ones
+  std::vector<Vertex> verts(n);
+  std::vector<rank_type> rank(n, rank_type(1)), inv_out(n), share(n);
+  std::vector<std::size_t> dangling;
+  typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+    std::size_t i = get(index, *vi);
+    verts[i] = *vi;
+    std::size_t d = out_degree(*vi, g);
+    inv_out[i] = d == 0 ? rank_type(0) : rank_type(1) / rank_type(d);
+    if (d == 0) dangling.push_back(i);
+  }
+
+  // The indices of the sources of the in-edges of each vertex, in one
+  // array, so that the iterations read them in order
+  std::vector<std::size_t> in_begin(n + 1);
+  std::vector<typename graph_traits<Graph>::vertices_size_type> in_source;
+  in_source.reserve(num_edges(g));
+  for (std::size_t i = 0; i < n; ++i) {
+    in_begin[i] = in_source.size();
+    typename graph_traits<Graph>::in_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = in_edges(verts[i], g); ei != ei_end; ++ei)
+      in_source.push_back(get(index, source(*ei, g)));
+  }
+  in_begin[n] = in_source.size();
+
+  // One block of vertices per thread, with about the same number of
+  // in-edges plus vertices
+  std::vector<std::size_t> block(num_threads + 1, n);
+  block[0] = 0;
+  for (std::size_t i = 0, t = 0; i < n && t + 1 < num_threads; ++i) {
+    std::size_t work = in_begin[i + 1] + i + 1;
+    while (t + 1 < num_threads && work * num_threads >= (in_begin[n] + n) * (t + 1))
+      block[++t] = i + 1;
+  }
+
+  std::vector<rank_type> dangling_part(num_threads), change_part(num_threads);
+  std::vector<std::size_t> dangling_block(num_threads + 1);
+  for (std::size_t t = 0; t <= num_threads; ++t)
+    dangling_block[t] = detail::block_begin(dangling.size(), num_threads, t);
+  detail::thread_barrier barrier(num_threads);
+  std::size_t iterations = 0;
+
+  detail::run_in_parallel(num_threads, [&](std::size_t t) {
+    for (std::size_t iter = 0; iter < max_iterations; ++iter) {
+      rank_type dangling_rank(0);
+      for (std::size_t i = block[t]; i < block[t + 1]; ++i)
+        share[i] = rank[i] * inv_out[i];
+      for (std::size_t j = dangling_block[t]; j < dangling_block[t + 1]; ++j)
+        dangling_rank += rank[dangling[j]];
+      dangling_part[t] = dangling_rank;
+      barrier.wait();
+
+      dangling_rank = rank_type(0);
+      for (std::size_t p = 0; p < num_threads; ++p)
+        dangling_rank += dangling_part[p];
+      rank_type base = (rank_type(1) - damping)
+        + damping * dangling_rank / rank_type(n);
+      rank_type change(0);
+      for (std::size_t i = block[t]; i < block[t + 1]; ++i) {
+        rank_type sum(0);
+        for (std::size_t j = in_begin[i]; j < in_begin[i + 1]; ++j)
+          sum += share[in_source[j]];
+        rank_type r = base + damping * sum;
+        change += std::abs(r - rank[i]);
+        rank[i] = r;
+      }
+      change_part[t] = change;
+      barrier.wait();
+
+      change = rank_type(0);
+      for (std::size_t p = 0; p < num_threads; ++p) change += change_part[p];
+      if (t == 0) iterations = iter + 1;
+      if (change <= tolerance * rank_type(n)) break;
+    }
+  });
+
+  for (std::size_t i = 0; i < n; ++i) put(rank_map, verts[i], rank[i]);
+  return iterations;
+}
+
+template<typename Graph, typename RankMap>
+inline std::size_t
+parallel_page_rank(const Graph& g, RankMap rank_map,
+                   typename property_traits<RankMap>::value_type damping = 0.85,
+                   typename property_traits<RankMap>::value_type tolerance = 1e-6,
+                   std::size_t max_iterations = 100,
+                   std::size_t num_threads = 0)
+{
+  return parallel_page_rank(g, rank_map, damping, tolerance, max_iterations,
+                            get(vertex_index, g), num_threads);
+}
+
+// The personalized PageRank estimates of the seeds in [first, last), as
+// personalized_page_rank_push computes them, with several threads.  The
+// estimates of the i-th seed replace the contents of results[i]; results
+// is resized to the number of seeds.  Returns the total number of pushes.
+// num_threads == 0 uses one thread per hardware thread.
+template<typename Graph, typename RandomAccessIterator, typename Rank,
+         typename VertexIndexMap>
+std::size_t
+parallel_personalized_page_rank
+  (const Graph& g, RandomAccessIterator first, RandomAccessIterator last,
+   std::vector<std::vector<std::pair<
+     typename graph_traits<Graph>::vertex_descriptor, Rank> > >& results,
+   Rank damping, Rank epsilon, VertexIndexMap index, std::size_t num_threads)
+{
+  BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+  std::size_t k = last - first;
+  results.resize(k);
+  if (k == 0) return 0;
+  num_threads = detail::resolve_num_threads(num_threads);
+  if (num_threads > k) num_threads = k;
+
+  detail::chunk_dispenser<std::size_t> chunks(0, k, 16);
+  std::vector<std::size_t> pushes(num_threads);
+  detail::run_in_parallel(num_threads, [&](std::size_t t) {
+    personalized_page_rank_push<Graph, Rank, VertexIndexMap> push(g, index);
+    std::size_t b, e, mine = 0;
+    while (chunks.next(b, e))
+      for (std::size_t i = b; i < e; ++i)
+        mine += push(first[i], results[i], damping, epsilon);
+    pushes[t] = mine;
+  });
+
+  std::size_t total = 0;
+  for (std::size_t t = 0; t < num_threads; ++t) total += pushes[t];
+  return total;
+}
+
+template<typename Graph, typename RandomAccessIterator, typename Rank>
+inline std::size_t
+parallel_personalized_page_rank
+  (const Graph& g, RandomAccessIterator first, RandomAccessIterator last,
+   std::vector<std::vector<std::pair<
+     typename graph_traits<Graph>::vertex_descriptor, Rank> > >& results,
+   Rank damping = Rank(0.85), Rank epsilon = Rank(1e-6),
+   std::size_t num_threads = 0)
+{
+  return parallel_personalized_page_rank(g, first, last, results, damping,
+                                         epsilon, get(vertex_index, g),
+                                         num_threads);
+}
+
+} } // end namespace boost::graph
+
+#endif // BOOST_GRAPH_PARALLEL_PAGE_RANK_HPP
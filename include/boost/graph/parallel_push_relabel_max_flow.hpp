@@ -0,0 +1,397 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_PUSH_RELABEL_MAX_FLOW_HPP
+#define BOOST_GRAPH_PARALLEL_PUSH_RELABEL_MAX_FLOW_HPP
+
+/*
+ * Multithreaded maximum flow by synchronous push-relabel, after
+ * N. Baumstark, G. Blelloch and J. Shun, "Efficient implementation of a
+ * synchronous parallel push-relabel algorithm" (ESA 2015).
+ *
+ * The active vertices, those with excess flow other than the source and
+ * the sink, are kept in a flat array and processed in rounds, all of them
+ * in parallel, each round having two steps separated by barriers:
+ *
+ * 1. Each active vertex pushes its excess along its admissible edges,
+ *    those with residual capacity to a vertex of distance one less, as
+ *    the distances were at the start of the round.  Since the pushes only
+ *    go down by one, two vertices never push along the two directions of
+ *    an edge in the same round, so that every residual capacity has a
+ *    single writer; the excess pushed to a vertex is added up atomically
+ *    on the side and the vertex joins the next array once.
+ * 2. Each vertex of the next array takes in the excess pushed to it and,
+ *    if it has no admissible edge left, is relabeled to one more than the
+ *    least distance of its residual neighbors, as they were before the
+ *    step, which keeps the distances valid even when neighbors are
+ *    relabeled together.
+ *
+ * The distances are recomputed from time to time by a global relabel: a
+ * level-synchronous parallel breadth-first search of the reverse residual
+ * graph from the sink, then from the source for the vertices that no
+ * longer reach the sink, which are given distances from n up and return
+ * their excess to the source.  The algorithm thus runs in a single phase
+ * and ends with a flow rather than a preflow.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    template <class Graph,
+              class EdgeCapacityMap,    // integer value type
+              class ResidualCapacityEdgeMap,
+              class ReverseEdgeMap,
+              class VertexIndexMap,     // vertex_descriptor -> integer
+              class FlowValue>
+    class parallel_push_relabel
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef typename graph_traits<Graph>::edge_descriptor Edge;
+      typedef typename graph_traits<Graph>::out_edge_iterator OutEdgeIter;
+
+    public:
+      parallel_push_relabel(const Graph& g_, EdgeCapacityMap cap,
+                            ResidualCapacityEdgeMap res, ReverseEdgeMap rev,
+                            Vertex src_, Vertex sink_, VertexIndexMap idx,
+                            std::size_t num_threads_)
+        : g(g_), capacity(cap), residual_capacity(res), reverse_edge(rev),
+          index(idx), n(num_vertices(g_)), src(get(idx, src_)),
+          sink(get(idx, sink_)), num_threads(num_threads_), verts(n),
+          distance(n), new_distance(n), excess(n), pushed(n), queued(n),
+          visited(n), chunks(0, 0, 64), barrier(num_threads_),
+          offsets(num_threads_ + 1), local(num_threads_), work(0),
+          global_update(false)
+      {
+        typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+          verts[get(index, *vi)] = *vi;
+        // Don't count the reverse edges
+        nm = alpha() * n + num_edges(g) / 2;
+      }
+
+      FlowValue maximum_flow()
+      {
+        graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+          initialize(t);
+          global_relabel(t);
+          for (;;) {
+            // The array only changes between barriers
+            if (active.empty()) break;
+            std::size_t b, e, scanned = 0;
+            while (chunks.next(b, e))
+              for (std::size_t i = b; i < e; ++i)
+                scanned += push(active[i], local[t]);
+            gather(t, active);
+
+            while (chunks.next(b, e))
+              for (std::size_t i = b; i < e; ++i)
+                scanned += relabel(active[i]);
+            work.fetch_add(scanned, std::memory_order_relaxed);
+            barrier.wait();
+            std::size_t first = graph::detail::block_begin(active.size(),
+                                                           num_threads, t);
+            std::size_t last = graph::detail::block_begin(active.size(),
+                                                          num_threads, t + 1);
+            for (std::size_t i = first; i < last; ++i)
+              distance[active[i]] = new_distance[active[i]];
+            barrier.wait();
+            if (t == 0) {
+              global_update = work.load(std::memory_order_relaxed)
+                * global_update_frequency() > nm;
+              if (global_update) work.store(0, std::memory_order_relaxed);
+              chunks.reset(0, active.size());
+            }
+            barrier.wait();
+            if (global_update) global_relabel(t);
+          }
+        });
+        return excess[sink];
+      }
+
+    private:
+      inline double global_update_frequency() { return 0.5; }
+      inline std::size_t alpha() { return 6; }
+      inline std::size_t beta() { return 12; }
+
+      // Sets the residual capacities to the capacities and saturates the
+      // edges out of the source
+      void initialize(std::size_t t)
+      {
+        std::size_t first = graph::detail::block_begin(n, num_threads, t);
+        std::size_t last = graph::detail::block_begin(n, num_threads, t + 1);
+        for (std::size_t v = first; v < last; ++v) {
+          excess[v] = 0;
+          pushed[v].store(0, std::memory_order_relaxed);
+          queued[v].store(0, std::memory_order_relaxed);
+          OutEdgeIter ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(verts[v], g); ei != ei_end;
+               ++ei)
+            put(residual_capacity, *ei, get(capacity, *ei));
+        }
+        barrier.wait();
+        if (t == 0) {
+          OutEdgeIter ei, ei_end;
+          for (boost::tie(ei, ei_end) = out_edges(verts[src], g);
+               ei != ei_end; ++ei) {
+            std::size_t w = get(index, target(*ei, g));
+            if (w == src) continue;
+            FlowValue delta = get(residual_capacity, *ei);
+            put(residual_capacity, *ei, 0);
+            Edge r = get(reverse_edge, *ei);
+            put(residual_capacity, r, get(residual_capacity, r) + delta);
+            excess[w] += delta;
+          }
+          for (std::size_t v = 0; v < n; ++v)
+            if (excess[v] > 0 && v != sink) active.push_back(v);
+          excess[src] = 0;
+        }
+        barrier.wait();
+      }
+
+      // Pushes the excess of v along its admissible edges, and puts v and
+      // the vertices it pushed to into the next array if they are not in
+      // it yet.  Returns the number of edges scanned.
+      std::size_t push(std::size_t v, std::vector<std::size_t>& next)
+      {
+        std::size_t d = distance[v], scanned = 0;
+        FlowValue ex = excess[v];
+        OutEdgeIter ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(verts[v], g);
+             ei != ei_end && ex > 0; ++ei) {
+          ++scanned;
+          std::size_t w = get(index, target(*ei, g));
+          // The distance comes first: w may be reading the residual
+          // capacity of the reverse edge otherwise
+          if (distance[w] + 1 != d) continue;
+          FlowValue r = get(residual_capacity, *ei);
+          if (r <= 0) continue;
+          FlowValue delta = (std::min)(r, ex);
+          put(residual_capacity, *ei, r - delta);
+          Edge rev = get(reverse_edge, *ei);
+          put(residual_capacity, rev, get(residual_capacity, rev) + delta);
+          ex -= delta;
+          pushed[w].fetch_add(delta, std::memory_order_relaxed);
+          enqueue(w, next);
+        }
+        excess[v] = ex;
+        if (ex > 0) enqueue(v, next);
+        return scanned;
+      }
+
+      void enqueue(std::size_t v, std::vector<std::size_t>& next)
+      {
+        if (v != src && v != sink
+            && queued[v].load(std::memory_order_relaxed) == 0
+            && queued[v].exchange(1, std::memory_order_relaxed) == 0)
+          next.push_back(v);
+      }
+
+      // Takes in the excess pushed to v and sets its new distance.
+      // Returns the work done.
+      std::size_t relabel(std::size_t v)
+      {
+        excess[v] += pushed[v].exchange(0, std::memory_order_relaxed);
+        queued[v].store(0, std::memory_order_relaxed);
+        std::size_t d = distance[v], least = 2 * n, scanned = 0;
+        OutEdgeIter ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(verts[v], g); ei != ei_end;
+             ++ei) {
+          ++scanned;
+          if (get(residual_capacity, *ei) <= 0) continue;
+          std::size_t dw = distance[get(index, target(*ei, g))];
+          if (dw + 1 == d) {
+            new_distance[v] = d;
+            return scanned;
+          }
+          least = (std::min)(least, dw + 1);
+        }
+        // A vertex with excess can always send it back to the source
+        BOOST_ASSERT(least < 2 * n);
+        new_distance[v] = least;
+        return scanned + beta();
+      }
+
+      // Moves the vertices that the threads put into their local arrays
+      // to target, and sets the chunks to go through it.  The pushes to
+      // the source and the sink are taken in on the way.
+      void gather(std::size_t t, std::vector<std::size_t>& target)
+      {
+        offsets[t + 1] = local[t].size();
+        barrier.wait();
+        if (t == 0) {
+          for (std::size_t q = 0; q < num_threads; ++q)
+            offsets[q + 1] += offsets[q];
+          target.resize(offsets[num_threads]);
+          chunks.reset(0, target.size());
+          excess[src] += pushed[src].exchange(0, std::memory_order_relaxed);
+          excess[sink] += pushed[sink].exchange(0,
+                                                std::memory_order_relaxed);
+        }
+        barrier.wait();
+        std::copy(local[t].begin(), local[t].end(),
+                  target.begin() + offsets[t]);
+        local[t].clear();
+        barrier.wait();
+      }
+
+      // Sets the distances to the exact distances to the sink in the
+      // residual graph, or to n plus those to the source for the vertices
+      // that do not reach the sink
+      void global_relabel(std::size_t t)
+      {
+        std::size_t first = graph::detail::block_begin(n, num_threads, t);
+        std::size_t last = graph::detail::block_begin(n, num_threads, t + 1);
+        for (std::size_t v = first; v < last; ++v)
+          visited[v].store(0, std::memory_order_relaxed);
+        barrier.wait();
+        if (t == 0) {
+          visited[sink].store(1, std::memory_order_relaxed);
+          visited[src].store(1, std::memory_order_relaxed);
+          distance[sink] = 0;
+          distance[src] = n;
+          local[0].push_back(sink);
+        }
+        gather(t, frontier);
+        search(t);
+        if (t == 0) local[0].push_back(src);
+        gather(t, frontier);
+        search(t);
+        // Unreached vertices have no excess, and never get any
+        for (std::size_t v = first; v < last; ++v)
+          if (visited[v].load(std::memory_order_relaxed) == 0)
+            distance[v] = 2 * n;
+        barrier.wait();
+        if (t == 0) chunks.reset(0, active.size());
+        barrier.wait();
+      }
+
+      // Level-synchronous breadth-first search of the reverse residual
+      // graph from the frontier
+      void search(std::size_t t)
+      {
+        while (!frontier.empty()) {
+          std::size_t b, e;
+          while (chunks.next(b, e))
+            for (std::size_t i = b; i < e; ++i) {
+              std::size_t v = frontier[i];
+              OutEdgeIter ei, ei_end;
+              for (boost::tie(ei, ei_end) = out_edges(verts[v], g);
+                   ei != ei_end; ++ei) {
+                std::size_t w = get(index, target(*ei, g));
+                if (visited[w].load(std::memory_order_relaxed) != 0
+                    || get(residual_capacity, get(reverse_edge, *ei)) <= 0
+                    || visited[w].exchange(1, std::memory_order_relaxed) != 0)
+                  continue;
+                distance[w] = distance[v] + 1;
+                local[t].push_back(w);
+              }
+            }
+          gather(t, frontier);
+        }
+      }
+
+      const Graph& g;
+      EdgeCapacityMap capacity;
+      ResidualCapacityEdgeMap residual_capacity;
+      ReverseEdgeMap reverse_edge;
+      VertexIndexMap index;
+      std::size_t n, src, sink, num_threads, nm;
+      std::vector<Vertex> verts;
+      std::vector<std::size_t> distance, new_distance;
+      std::vector<FlowValue> excess;
+      // The excess pushed to each vertex during the round
+      std::vector<std::atomic<FlowValue> > pushed;
+      std::vector<std::atomic<unsigned char> > queued, visited;
+      std::vector<std::size_t> active, frontier;
+      graph::detail::chunk_dispenser<std::size_t> chunks;
+      graph::detail::thread_barrier barrier;
+      std::vector<std::size_t> offsets;
+      std::vector<std::vector<std::size_t> > local;
+      std::atomic<std::size_t> work;
+      bool global_update;
+    };
+
+  } // namespace detail
+
+  // The maximum flow from src to sink, as by push_relabel_max_flow, with
+  // num_threads threads; zero stands for the number of hardware threads.
+  // The residual capacities describe the flow on return.
+  template <class Graph,
+            class CapacityEdgeMap, class ResidualCapacityEdgeMap,
+            class ReverseEdgeMap, class VertexIndexMap>
+  typename property_traits<CapacityEdgeMap>::value_type
+  parallel_push_relabel_max_flow
+    (Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor src,
+     typename graph_traits<Graph>::vertex_descriptor sink,
+     CapacityEdgeMap cap, ResidualCapacityEdgeMap res,
+     ReverseEdgeMap rev, VertexIndexMap index_map, std::size_t num_threads)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    typedef typename property_traits<CapacityEdgeMap>::value_type FlowValue;
+
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    if (num_threads > num_vertices(g)) num_threads = num_vertices(g);
+    detail::parallel_push_relabel<Graph, CapacityEdgeMap,
+      ResidualCapacityEdgeMap, ReverseEdgeMap, VertexIndexMap, FlowValue>
+      algo(g, cap, res, rev, src, sink, index_map, num_threads);
+    return algo.maximum_flow();
+  }
+
+  template <class Graph, class P, class T, class R>
+  typename detail::edge_capacity_value<Graph, P, T, R>::type
+  parallel_push_relabel_max_flow
+    (Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor src,
+     typename graph_traits<Graph>::vertex_descriptor sink,
+     const bgl_named_params<P, T, R>& params, std::size_t num_threads = 0)
+  {
+    return parallel_push_relabel_max_flow
+      (g, src, sink,
+       choose_const_pmap(get_param(params, edge_capacity), g, edge_capacity),
+       choose_pmap(get_param(params, edge_residual_capacity),
+                   g, edge_residual_capacity),
+       choose_const_pmap(get_param(params, edge_reverse), g, edge_reverse),
+       choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+       num_threads);
+  }
+
+  template <class Graph>
+  typename property_traits<
+    typename property_map<Graph, edge_capacity_t>::const_type
+  >::value_type
+  parallel_push_relabel_max_flow
+    (Graph& g,
+     typename graph_traits<Graph>::vertex_descriptor src,
+     typename graph_traits<Graph>::vertex_descriptor sink,
+     std::size_t num_threads = 0)
+  {
+    bgl_named_params<int, buffer_param_t> params(0); // bogus empty param
+    return parallel_push_relabel_max_flow(g, src, sink, params, num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_PUSH_RELABEL_MAX_FLOW_HPP
@@ -0,0 +1,572 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_STRONG_COMPONENTS_HPP
+#define BOOST_GRAPH_PARALLEL_STRONG_COMPONENTS_HPP
+
+/*
+ * Multithreaded strongly connected components of a bidirectional graph,
+ * after the Multistep method (G. M. Slota, S. Rajamanickam and
+ * K. Madduri, "BFS and coloring-based parallel algorithms for strongly
+ * connected components and related problems", IPDPS 2014).
+ *
+ * 1. Trimming: a vertex without in-edges or without out-edges from the
+ *    vertices left is a component of its own.  The threads count these
+ *    edges, then each removes such vertices from its share depth-first,
+ *    decrementing the counts of their neighbors and removing those that
+ *    drop to zero in turn, so that a chain is trimmed in one pass without
+ *    any barrier per vertex.
+ * 2. Forward-backward: the vertices reached both forward and backward from
+ *    a pivot of high degree form its component, usually the largest one.
+ *    Both searches are level-synchronous parallel breadth-first searches.
+ * 3. Coloring: every vertex left takes the largest index among the
+ *    vertices that reach it, by propagating the indices forward until
+ *    nothing changes; each vertex that keeps its own index then collects
+ *    its component by a backward search among the vertices of its color.
+ *    This is repeated, trimming first, on the vertices left.
+ * 4. Once few vertices are left, an iterative Tarjan search finishes the
+ *    job on one thread.
+ *
+ * The components are finally numbered in the order of their smallest
+ * vertex, which does not depend on the number of threads.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/parallel_connected_components.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    template <typename Graph, typename VertexIndexMap>
+    class parallel_scc
+    {
+      typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+      typedef typename graph_traits<Graph>::out_edge_iterator OutEdgeIter;
+      typedef typename graph_traits<Graph>::in_edge_iterator InEdgeIter;
+      typedef std::vector<std::atomic<std::size_t> > atomic_array;
+
+    public:
+      // Tarjan's algorithm takes over once at most serial_cutoff vertices
+      // are left
+      parallel_scc(const Graph& g, VertexIndexMap index,
+                   std::size_t num_threads, std::size_t serial_cutoff)
+        : g(g), index(index), n(num_vertices(g)), num_threads(num_threads),
+          serial_cutoff(serial_cutoff), verts(n), comp(n), color(n),
+          in_count(n), out_count(n), state(n), local(num_threads)
+      {
+        typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+          verts[get(index, *vi)] = *vi;
+        remaining.resize(n);
+        graph::detail::parallel_for_blocks
+          (num_threads, n, [&](std::size_t, std::size_t first,
+                               std::size_t last) {
+            for (std::size_t v = first; v < last; ++v) {
+              comp[v].store(n, std::memory_order_relaxed);
+              state[v].store(unmarked, std::memory_order_relaxed);
+              remaining[v] = v;
+            }
+          });
+      }
+
+      // Puts the component numbers in c and returns their number
+      template <typename ComponentMap>
+      std::size_t run(ComponentMap c)
+      {
+        trim();
+        if (remaining.size() > serial_cutoff) forward_backward();
+        for (;;) {
+          trim();
+          if (remaining.size() <= serial_cutoff) break;
+          color_round();
+        }
+        tarjan();
+        return number(c);
+      }
+
+    private:
+      std::size_t none() const { return n; }
+
+      // The states of the vertices, one byte each so that the searches
+      // test them in cache
+      enum { unmarked, marked, done };
+
+      bool left(std::size_t v) const
+      {
+        return state[v].load(std::memory_order_relaxed) != done;
+      }
+
+      // Gives v the component of r, unless it has one
+      bool claim(std::size_t v, std::size_t r)
+      {
+        unsigned char s = state[v].load(std::memory_order_relaxed);
+        while (s != done)
+          if (state[v].compare_exchange_weak(s, done,
+                                             std::memory_order_relaxed)) {
+            comp[v].store(r, std::memory_order_relaxed);
+            return true;
+          }
+        return false;
+      }
+
+      // Marks v, unless it is marked or has a component
+      bool mark(std::size_t v)
+      {
+        unsigned char s = unmarked;
+        return state[v].load(std::memory_order_relaxed) == unmarked
+          && state[v].compare_exchange_strong(s, marked,
+                                              std::memory_order_relaxed);
+      }
+
+      // Replaces remaining by the vertices of the parts in local
+      void gather()
+      {
+        std::size_t total = 0;
+        for (std::size_t t = 0; t < num_threads; ++t) total += local[t].size();
+        remaining.resize(total);
+        std::vector<std::size_t> offsets(num_threads + 1);
+        for (std::size_t t = 0; t < num_threads; ++t)
+          offsets[t + 1] = offsets[t] + local[t].size();
+        graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+          std::copy(local[t].begin(), local[t].end(),
+                    remaining.begin() + offsets[t]);
+          local[t].clear();
+        });
+      }
+
+      // Drops the vertices with a component from remaining
+      void compact()
+      {
+        graph::detail::parallel_for_blocks
+          (num_threads, remaining.size(),
+           [&](std::size_t t, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+              if (left(remaining[i])) local[t].push_back(remaining[i]);
+          });
+        gather();
+      }
+
+      // Search from the vertices of frontier, along the out-edges if
+      // forward and the in-edges otherwise: examine(v) is called before the
+      // edges of v are scanned, and the neighbors w of v for which
+      // reach(v, w) returns true are searched from in turn.  Large levels
+      // are shared among the threads, level by level; while the frontier
+      // is small, as along a chain, the first thread goes on alone, first
+      // in first out, until it grows.
+      template <typename Examine, typename Reach>
+      void search(std::vector<std::size_t>& frontier, bool forward,
+                  Examine examine, Reach reach)
+      {
+        const std::size_t small_frontier = 256, large_frontier = 4096;
+        graph::detail::chunk_dispenser<std::size_t>
+          chunks(0, frontier.size(), 64);
+        graph::detail::thread_barrier barrier(num_threads);
+        std::vector<std::size_t> offsets(num_threads + 1), next;
+        // The size of the frontier, indexed by the parity of the step so
+        // that the first thread may set the next one while the others
+        // still read the current one
+        std::size_t size[2] = {frontier.size(), 0};
+
+        auto expand = [&](std::size_t v, std::vector<std::size_t>& out) {
+          examine(v);
+          if (forward) {
+            OutEdgeIter ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(verts[v], g);
+                 ei != ei_end; ++ei) {
+              std::size_t w = get(index, target(*ei, g));
+              if (reach(v, w)) out.push_back(w);
+            }
+          } else {
+            InEdgeIter ei, ei_end;
+            for (boost::tie(ei, ei_end) = in_edges(verts[v], g);
+                 ei != ei_end; ++ei) {
+              std::size_t w = get(index, source(*ei, g));
+              if (reach(v, w)) out.push_back(w);
+            }
+          }
+        };
+
+        graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+          std::vector<std::size_t>& mine = local[t];
+          for (int p = 0; size[p] > 0; p ^= 1) {
+            if (size[p] < small_frontier) {
+              if (t == 0) {
+                std::size_t head = 0;
+                while (head < frontier.size()
+                       && frontier.size() - head < large_frontier)
+                  expand(frontier[head++], frontier);
+                frontier.erase(frontier.begin(), frontier.begin() + head);
+                chunks.reset(0, frontier.size());
+                size[p ^ 1] = frontier.size();
+              }
+              barrier.wait();
+              continue;
+            }
+
+            std::size_t b, e;
+            while (chunks.next(b, e))
+              for (std::size_t k = b; k < e; ++k) expand(frontier[k], mine);
+            offsets[t + 1] = mine.size();
+            barrier.wait();
+            if (t == 0) {
+              for (std::size_t q = 0; q < num_threads; ++q)
+                offsets[q + 1] += offsets[q];
+              next.resize(offsets[num_threads]);
+            }
+            barrier.wait();
+            std::copy(mine.begin(), mine.end(), next.begin() + offsets[t]);
+            mine.clear();
+            barrier.wait();
+            if (t == 0) {
+              frontier.swap(next);
+              chunks.reset(0, frontier.size());
+              size[p ^ 1] = frontier.size();
+            }
+            barrier.wait();
+          }
+        });
+      }
+
+      // Step 1
+      void trim()
+      {
+        graph::detail::thread_barrier barrier(num_threads);
+        std::size_t r = remaining.size();
+        graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+          std::size_t first = graph::detail::block_begin(r, num_threads, t);
+          std::size_t last = graph::detail::block_begin(r, num_threads, t + 1);
+          for (std::size_t i = first; i < last; ++i) {
+            std::size_t v = remaining[i], ins = 0, outs = 0;
+            InEdgeIter ii, ii_end;
+            for (boost::tie(ii, ii_end) = in_edges(verts[v], g); ii != ii_end;
+                 ++ii) {
+              std::size_t u = get(index, source(*ii, g));
+              if (u != v && left(u)) ++ins;
+            }
+            OutEdgeIter oi, oi_end;
+            for (boost::tie(oi, oi_end) = out_edges(verts[v], g);
+                 oi != oi_end; ++oi) {
+              std::size_t w = get(index, target(*oi, g));
+              if (w != v && left(w)) ++outs;
+            }
+            in_count[v].store(ins, std::memory_order_relaxed);
+            out_count[v].store(outs, std::memory_order_relaxed);
+          }
+          barrier.wait();
+
+          std::vector<std::size_t> stack;
+          for (std::size_t i = first; i < last; ++i) {
+            std::size_t v = remaining[i];
+            if ((in_count[v].load(std::memory_order_relaxed) == 0
+                 || out_count[v].load(std::memory_order_relaxed) == 0)
+                && claim(v, v))
+              stack.push_back(v);
+            while (!stack.empty()) {
+              std::size_t u = stack.back();
+              stack.pop_back();
+              OutEdgeIter oi, oi_end;
+              for (boost::tie(oi, oi_end) = out_edges(verts[u], g);
+                   oi != oi_end; ++oi) {
+                std::size_t w = get(index, target(*oi, g));
+                if (w != u && left(w)
+                    && in_count[w].fetch_sub(1, std::memory_order_relaxed) == 1
+                    && claim(w, w))
+                  stack.push_back(w);
+              }
+              InEdgeIter ii, ii_end;
+              for (boost::tie(ii, ii_end) = in_edges(verts[u], g);
+                   ii != ii_end; ++ii) {
+                std::size_t w = get(index, source(*ii, g));
+                if (w != u && left(w)
+                    && out_count[w].fetch_sub(1, std::memory_order_relaxed) == 1
+                    && claim(w, w))
+                  stack.push_back(w);
+              }
+            }
+          }
+        });
+        compact();
+      }
+
+      // Step 2
+      void forward_backward()
+      {
+        // The pivot maximizes the product of the in- and out-degrees
+        std::vector<std::size_t> best(num_threads, none());
+        std::vector<std::size_t> best_score(num_threads, 0);
+        graph::detail::parallel_for_blocks
+          (num_threads, remaining.size(),
+           [&](std::size_t t, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+              std::size_t v = remaining[i];
+              std::size_t score = (in_degree(verts[v], g) + 1)
+                                  * (out_degree(verts[v], g) + 1);
+              if (best[t] == none() || score > best_score[t]) {
+                best[t] = v;
+                best_score[t] = score;
+              }
+            }
+          });
+        std::size_t pivot = none(), score = 0;
+        for (std::size_t t = 0; t < num_threads; ++t)
+          if (best[t] != none() && (pivot == none() || best_score[t] > score)) {
+            pivot = best[t];
+            score = best_score[t];
+          }
+        if (pivot == none()) return;
+
+        // Mark the vertices reached forward, and take those of them that
+        // reach the pivot
+        std::vector<std::size_t> frontier(1, pivot);
+        mark(pivot);
+        search(frontier, true, [](std::size_t) {},
+               [&](std::size_t, std::size_t w) { return mark(w); });
+        frontier.assign(1, pivot);
+        claim(pivot, pivot);
+        search(frontier, false, [](std::size_t) {},
+               [&](std::size_t, std::size_t w) {
+                 unsigned char s = marked;
+                 if (state[w].load(std::memory_order_relaxed) != marked
+                     || !state[w].compare_exchange_strong
+                          (s, done, std::memory_order_relaxed))
+                   return false;
+                 comp[w].store(pivot, std::memory_order_relaxed);
+                 return true;
+               });
+        compact();
+        unmark();
+      }
+
+      void unmark()
+      {
+        graph::detail::parallel_for_blocks
+          (num_threads, remaining.size(),
+           [&](std::size_t, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+              state[remaining[i]].store(unmarked, std::memory_order_relaxed);
+          });
+      }
+
+      // Step 3
+      void color_round()
+      {
+        graph::detail::parallel_for_blocks
+          (num_threads, remaining.size(),
+           [&](std::size_t, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+              color[remaining[i]].store(remaining[i],
+                                        std::memory_order_relaxed);
+              state[remaining[i]].store(marked, std::memory_order_relaxed);
+            }
+          });
+
+        // A vertex is marked while it waits in the frontier, and unmarked
+        // before its color is read, so that a vertex whose color grows
+        // after that is queued again
+        std::vector<std::size_t> frontier(remaining);
+        search(frontier, true,
+               [&](std::size_t v) { state[v].store(unmarked); },
+               [&](std::size_t v, std::size_t w) {
+                 if (!left(w)) return false;
+                 std::size_t c = color[v].load();
+                 std::size_t cw = color[w].load();
+                 while (cw < c)
+                   if (color[w].compare_exchange_weak(cw, c))
+                     return state[w].exchange(marked) == unmarked;
+                 return false;
+               });
+
+        // The vertices that kept their own color are the roots
+        graph::detail::parallel_for_blocks
+          (num_threads, remaining.size(),
+           [&](std::size_t t, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+              std::size_t v = remaining[i];
+              if (color[v].load(std::memory_order_relaxed) == v) {
+                claim(v, v);
+                local[t].push_back(v);
+              }
+            }
+          });
+        std::size_t r = 0;
+        for (std::size_t t = 0; t < num_threads; ++t) r += local[t].size();
+        frontier.clear();
+        frontier.reserve(r);
+        for (std::size_t t = 0; t < num_threads; ++t) {
+          frontier.insert(frontier.end(), local[t].begin(), local[t].end());
+          local[t].clear();
+        }
+        search(frontier, false, [](std::size_t) {},
+               [&](std::size_t v, std::size_t w) {
+                 std::size_t root = comp[v].load(std::memory_order_relaxed);
+                 return color[w].load(std::memory_order_relaxed) == root
+                   && claim(w, root);
+               });
+        compact();
+      }
+
+      // Step 4: Tarjan's algorithm on the vertices left, with an explicit
+      // stack; their colors become their positions in remaining
+      void tarjan()
+      {
+        std::size_t r = remaining.size();
+        for (std::size_t k = 0; k < r; ++k)
+          color[remaining[k]].store(k, std::memory_order_relaxed);
+        std::vector<std::size_t> order(r, 0), low(r), component_stack;
+        std::vector<char> on_stack(r, 0);
+        struct frame { std::size_t k; OutEdgeIter ei, ei_end; };
+        std::vector<frame> dfs;
+        std::size_t time = 0;
+
+        for (std::size_t k0 = 0; k0 < r; ++k0) {
+          if (order[k0] != 0) continue;
+          frame f0 = {k0, OutEdgeIter(), OutEdgeIter()};
+          boost::tie(f0.ei, f0.ei_end) = out_edges(verts[remaining[k0]], g);
+          dfs.push_back(f0);
+          order[k0] = low[k0] = ++time;
+          component_stack.push_back(k0);
+          on_stack[k0] = 1;
+          while (!dfs.empty()) {
+            frame& f = dfs.back();
+            if (f.ei != f.ei_end) {
+              std::size_t w = get(index, target(*f.ei, g));
+              ++f.ei;
+              if (!left(w)) continue;
+              std::size_t j = color[w].load(std::memory_order_relaxed);
+              if (order[j] == 0) {
+                order[j] = low[j] = ++time;
+                component_stack.push_back(j);
+                on_stack[j] = 1;
+                frame next = {j, OutEdgeIter(), OutEdgeIter()};
+                boost::tie(next.ei, next.ei_end) = out_edges(verts[w], g);
+                dfs.push_back(next);
+              } else if (on_stack[j] && order[j] < low[f.k]) {
+                low[f.k] = order[j];
+              }
+              continue;
+            }
+            std::size_t k = f.k;
+            dfs.pop_back();
+            if (!dfs.empty() && low[k] < low[dfs.back().k])
+              low[dfs.back().k] = low[k];
+            if (low[k] == order[k]) {
+              std::size_t j;
+              do {
+                j = component_stack.back();
+                component_stack.pop_back();
+                on_stack[j] = 0;
+                comp[remaining[j]].store(remaining[k],
+                                         std::memory_order_relaxed);
+              } while (j != k);
+            }
+          }
+        }
+        remaining.clear();
+      }
+
+      // Makes every vertex point to the smallest vertex of its component
+      // and numbers the components in that order
+      template <typename ComponentMap>
+      std::size_t number(ComponentMap c)
+      {
+        typedef typename property_traits<ComponentMap>::value_type comp_type;
+        graph::detail::thread_barrier barrier(num_threads);
+        graph::detail::parallel_for_blocks
+          (num_threads, n, [&](std::size_t, std::size_t first,
+                               std::size_t last) {
+            for (std::size_t v = first; v < last; ++v)
+              color[v].store(n, std::memory_order_relaxed);
+            barrier.wait();
+            for (std::size_t v = first; v < last; ++v) {
+              std::atomic<std::size_t>& smallest
+                = color[comp[v].load(std::memory_order_relaxed)];
+              std::size_t s = smallest.load(std::memory_order_relaxed);
+              while (v < s
+                     && !smallest.compare_exchange_weak
+                          (s, v, std::memory_order_relaxed)) {}
+            }
+            barrier.wait();
+            for (std::size_t v = first; v < last; ++v)
+              comp[v].store(color[comp[v].load(std::memory_order_relaxed)]
+                              .load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+          });
+        return union_find_number_components
+          (comp, [&](std::size_t v, std::size_t k) {
+            put(c, verts[v], comp_type(k));
+          }, num_threads);
+      }
+
+      const Graph& g;
+      VertexIndexMap index;
+      std::size_t n, num_threads, serial_cutoff;
+      std::vector<Vertex> verts;
+      // The representative of the component of each vertex, or n while
+      // it has none
+      atomic_array comp;
+      atomic_array color, in_count, out_count;
+      std::vector<std::atomic<unsigned char> > state;
+      // The vertices without a component
+      std::vector<std::size_t> remaining;
+      std::vector<std::vector<std::size_t> > local;
+    };
+
+  } // namespace detail
+
+  // The strongly connected components of strong_components(g, c), with
+  // num_threads threads; zero stands for the number of hardware threads.
+  // The components are numbered in the order of their smallest vertex
+  // instead of a reverse topological order.  Returns the number of
+  // components.  Once at most serial_cutoff vertices are left, below which
+  // Tarjan's algorithm is faster than another round of coloring, they are
+  // finished on one thread.
+  template <typename Graph, typename ComponentMap, typename VertexIndexMap>
+  typename property_traits<ComponentMap>::value_type
+  parallel_strong_components(const Graph& g, ComponentMap c,
+                             VertexIndexMap index, std::size_t num_threads,
+                             std::size_t serial_cutoff = std::size_t(1) << 16)
+  {
+    BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+    // Not BidirectionalGraphConcept, which a bidirectional CSR graph does
+    // not model for want of degree()
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    typedef typename property_traits<ComponentMap>::value_type comp_type;
+
+    std::size_t n = num_vertices(g);
+    if (n == 0) return comp_type(0);
+    num_threads = graph::detail::resolve_num_threads(num_threads);
+    if (num_threads > n) num_threads = n;
+    detail::parallel_scc<Graph, VertexIndexMap>
+      scc(g, index, num_threads, serial_cutoff);
+    return comp_type(scc.run(c));
+  }
+
+  template <typename Graph, typename ComponentMap>
+  inline typename property_traits<ComponentMap>::value_type
+  parallel_strong_components(const Graph& g, ComponentMap c,
+                             std::size_t num_threads = 0)
+  {
+    return parallel_strong_components(g, c, get(vertex_index, g),
+                                      num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_STRONG_COMPONENTS_HPP
@@ -0,0 +1,98 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_TRIANGLE_COUNT_HPP
+#define BOOST_GRAPH_PARALLEL_TRIANGLE_COUNT_HPP
+
+/*
+ * Multithreaded count_triangles.
+ *
+ * The adjacency lists are sorted by blocks of vertices, one per thread.  The
+ * lowest vertices of the triangles are then handed out to the threads in
+ * small chunks, since the work per vertex varies widely.  Each thread adds
+ * the triangles it finds to a count array of its own, so no atomics are
+ * needed, and the arrays are summed by blocks of vertices at the end.
+ */
+
+#include <boost/graph/detail/threading.hpp>
+
+#ifdef BOOST_GRAPH_NO_THREADS
+#error This file requires C++11 thread support
+#endif
+
+#include <vector>
+#include <boost/graph/triangle_count.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    struct parallel_triangle_for
+    {
+      std::size_t num_threads;
+      template <typename Function>
+      void operator()(std::size_t n, Function f) const
+      {
+        boost::graph::detail::parallel_for_blocks
+          (num_threads, n,
+           [&](std::size_t, std::size_t first, std::size_t last) {
+             f(first, last);
+           });
+      }
+    };
+
+  } // namespace detail
+
+  // count_triangles with num_threads threads, including the calling one;
+  // zero stands for the number of hardware threads
+  template <typename Graph, typename TriangleMap, typename ClusteringMap,
+            typename VertexIndexMap>
+  triangle_totals
+  parallel_count_triangles(const Graph& g, TriangleMap tm, ClusteringMap cm,
+                           VertexIndexMap index, std::size_t num_threads)
+  {
+    num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+    detail::parallel_triangle_for for_range = {num_threads};
+    detail::triangle_graph tg;
+    detail::build_triangle_graph(g, index, tg, for_range);
+
+    std::size_t n = num_vertices(g);
+    std::vector<std::vector<std::size_t> > counts(num_threads);
+    std::vector<boost::uintmax_t> triangles(num_threads);
+    boost::graph::detail::chunk_dispenser<std::size_t> chunks(0, n, 64);
+    boost::graph::detail::run_in_parallel(num_threads, [&](std::size_t t) {
+      std::vector<std::size_t> local(n);
+      boost::uintmax_t found = 0;
+      std::size_t b, e;
+      while (chunks.next(b, e))
+        found += detail::count_triangles_from(tg, b, e, &local[0]);
+      counts[t].swap(local);
+      triangles[t] = found;
+    });
+
+    boost::uintmax_t total = 0;
+    for (std::size_t t = 0; t < num_threads; ++t) total += triangles[t];
+    for_range(n, [&](std::size_t first, std::size_t last) {
+      for (std::size_t t = 1; t < num_threads; ++t)
+        for (std::size_t v = first; v < last; ++v)
+          counts[0][v] += counts[t][v];
+    });
+    return detail::finish_triangle_counts(g, tg, counts[0], total, tm, cm,
+                                          index);
+  }
+
+  template <typename Graph, typename TriangleMap, typename ClusteringMap>
+  inline triangle_totals
+  parallel_count_triangles(const Graph& g, TriangleMap tm, ClusteringMap cm,
+                           std::size_t num_threads = 0)
+  {
+    return parallel_count_triangles(g, tm, cm, get(vertex_index, g),
+                                    num_threads);
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_TRIANGLE_COUNT_HPP
@@ -0,0 +1,156 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
+#define BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
+
+/*
+ * Personalized PageRank by local push (R. Andersen, F. Chung and K. Lang,
+ * "Local graph partitioning using PageRank vectors", FOCS 2006).
+ *
+ * The estimate p starts at zero and the residual r at 1 on the seed.  A
+ * push at a vertex u whose residual is at least epsilon * out_degree(u)
+ * moves (1 - damping) * r(u) into p(u) and spreads damping * r(u) evenly
+ * over the residuals of the targets of its out-edges.  The pushes stop when
+ * no residual is large enough, after at most 1 / (epsilon * (1 - damping))
+ * of them whatever the size of the graph, so only the neighborhood of the
+ * seed is touched.  The per-vertex arrays are kept between seeds and
+ * cleared through the list of the vertices that the last seed touched.
+ */
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+
+namespace boost { namespace graph {
+
+// Approximates the personalized PageRank of the seeds of one graph, one
+// seed at a time.  The personalized PageRank of seed s is the probability
+// distribution of the walk that, at each step, follows a random out-edge
+// with probability damping and jumps back to s otherwise, or from a vertex
+// without out-edges always; it sums to 1.  The estimate p(v) of each vertex
+// v is at most its personalized PageRank; on an undirected graph it is
+// within epsilon * degree(v) of it, and on any graph the sum of the errors
+// is at most epsilon * num_edges(g).
+template<typename Graph, typename Rank = double,
+         typename VertexIndexMap =
+           typename property_map<Graph, vertex_index_t>::const_type>
+class personalized_page_rank_push
+{
+ public:
+  typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+  typedef Rank rank_type;
+  typedef std::pair<vertex_descriptor, Rank> entry;
+
+  explicit personalized_page_rank_push(const Graph& g)
+    : m_g(g), m_index(get(vertex_index, g)), m_estimate(num_vertices(g)),
+      m_residual(num_vertices(g)), m_flags(num_vertices(g)) {}
+
+  personalized_page_rank_push(const Graph& g, VertexIndexMap index)
+    : m_g(g), m_index(index), m_estimate(num_vertices(g)),
+      m_residual(num_vertices(g)), m_flags(num_vertices(g)) {}
+
+  // Replaces the contents of result by the vertices with a nonzero
+  // estimate for seed and their estimates, in the order they were first
+  // reached.  Returns the number of pushes.
+  std::size_t
+  operator()(vertex_descriptor seed, std::vector<entry>& result,
+             Rank damping = Rank(0.85), Rank epsilon = Rank(1e-6))
+  {
+    BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+    std::size_t s = get(m_index, seed);
+    m_touched.push_back(seed);
+    m_residual[s] = Rank(1);
+    m_queue.push_back(seed);
+    m_flags[s] = touched | queued;
+
+    std::size_t pushes = 0;
+    for (std::size_t head = 0; head < m_queue.size(); ++head) {
+      vertex_descriptor u = m_queue[head];
+      std::size_t i = get(m_index, u);
+      m_flags[i] &= ~queued;
+      Rank r = m_residual[i];
+      std::size_t degree = out_degree(u, m_g);
+      if (r < epsilon * Rank(degree == 0 ? 1 : degree)) continue;
+
+      ++pushes;
+      m_residual[i] = Rank(0);
+      m_estimate[i] += (Rank(1) - damping) * r;
+      if (degree == 0) {
+        // The walk jumps back to the seed
+        add_residual(seed, s, damping * r, epsilon);
+        continue;
+      }
+      Rank share = damping * r / Rank(degree);
+      typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(u, m_g); ei != ei_end; ++ei) {
+        vertex_descriptor v = target(*ei, m_g);
+        add_residual(v, get(m_index, v), share, epsilon);
+      }
+    }
+
+    result.clear();
+    for (std::size_t j = 0; j < m_touched.size(); ++j) {
+      std::size_t i = get(m_index, m_touched[j]);
+      if (m_estimate[i] != Rank(0))
+        result.push_back(entry(m_touched[j], m_estimate[i]));
+      m_estimate[i] = m_residual[i] = Rank(0);
+      m_flags[i] = 0;
+    }
+    m_touched.clear();
+    m_queue.clear();
+    return pushes;
+  }
+
+ private:
+  enum { touched = 1, queued = 2 };
+
+  void add_residual(vertex_descriptor v, std::size_t i, Rank amount,
+                    Rank epsilon)
+  {
+    if (!(m_flags[i] & touched)) {
+      m_touched.push_back(v);
+      m_flags[i] = touched;
+    }
+    m_residual[i] += amount;
+    if (!(m_flags[i] & queued)) {
+      std::size_t degree = out_degree(v, m_g);
+      if (m_residual[i] >= epsilon * Rank(degree == 0 ? 1 : degree)) {
+        m_queue.push_back(v);
+        m_flags[i] |= queued;
+      }
+    }
+  }
+
+  const Graph& m_g;
+  VertexIndexMap m_index;
+  std::vector<Rank> m_estimate, m_residual;
+  std::vector<unsigned char> m_flags;
+  std::vector<vertex_descriptor> m_queue, m_touched;
+};
+
+// The personalized PageRank estimates of one seed; see
+// personalized_page_rank_push.  Returns the number of pushes.
+template<typename Graph, typename Rank>
+inline std::size_t
+personalized_page_rank(const Graph& g,
+                       typename graph_traits<Graph>::vertex_descriptor seed,
+                       std::vector<std::pair<
+                         typename graph_traits<Graph>::vertex_descriptor,
+                         Rank> >& result,
+                       Rank damping = Rank(0.85), Rank epsilon = Rank(1e-6))
+{
+  personalized_page_rank_push<Graph, Rank> push(g);
+  return push(seed, result, damping, epsilon);
+}
+
+} } // end namespace boost::graph
+
+#endif // BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
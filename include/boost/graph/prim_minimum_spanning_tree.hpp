@@ -13,6 +13,9 @@
 #include <functional>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/two_bit_color_map.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/limits.hpp>
 
 namespace boost {
   
@@ -21,6 +24,14 @@ namespace boost {
     template <class U, class V> struct _project2nd {
       V operator()(U, V v) const { return v; }
     };
+
+    // The keys of Prim's algorithm are edge weights, which do not come out
+    // of the queue in nondecreasing order as the radix heap requires.  For
+    // 8- and 16-bit unsigned weights, use a Dial queue with one bucket per
+    // weight value instead.
+    template <class W>
+    struct dijkstra_queue_kind<W, std::less<W>, _project2nd<W, W>, true>
+      : mpl::if_c<(sizeof(W) <= 2), dial_queue_tag, d_ary_heap_queue_tag> {};
   }
 
   namespace detail {
@@ -62,6 +73,36 @@ namespace boost {
                             vis);
   }
 
+  // With the given queue, such as a d_ary_heap_indirect or
+  // dial_queue_indirect keyed on the distance map
+  template <class VertexListGraph, class DijkstraVisitor,
+            class PredecessorMap, class DistanceMap,
+            class WeightMap, class IndexMap, class UpdatableQueue>
+  inline void
+  prim_minimum_spanning_tree
+    (const VertexListGraph& g,
+     typename graph_traits<VertexListGraph>::vertex_descriptor s,
+     PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+     IndexMap index_map,
+     DijkstraVisitor vis, UpdatableQueue& Q)
+  {
+    typedef typename property_traits<WeightMap>::value_type W;
+    typedef color_traits<two_bit_color_type> Color;
+    two_bit_color_map<IndexMap> color(num_vertices(g), index_map);
+    typename graph_traits<VertexListGraph>::vertex_iterator ui, ui_end;
+    for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui) {
+      vis.initialize_vertex(*ui, g);
+      put(distance, *ui, (std::numeric_limits<W>::max)());
+      put(predecessor, *ui, *ui);
+      put(color, *ui, Color::white());
+    }
+    put(distance, s, W(0));
+    dijkstra_shortest_paths_no_init(g, &s, &s + 1, predecessor, distance,
+                                    weight, index_map, std::less<W>(),
+                                    detail::_project2nd<W,W>(), W(0), vis,
+                                    color, Q);
+  }
+
   template <class VertexListGraph, class PredecessorMap,
             class P, class T, class R>
   inline void prim_minimum_spanning_tree
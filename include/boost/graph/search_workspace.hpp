@@ -0,0 +1,244 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Per-vertex search state (distance, predecessor, color and position in the
+// priority queue) kept across calls to dijkstra_shortest_paths and
+// breadth_first_search, passed with the workspace() named parameter.
+//
+// Every entry carries the generation in which it was last written, and
+// reset() starts a new generation, so entries left by earlier searches read
+// as unreached without being visited: a search then costs time in the
+// number of vertices it reaches instead of the number of vertices of the
+// graph.
+
+#ifndef BOOST_GRAPH_SEARCH_WORKSPACE_HPP
+#define BOOST_GRAPH_SEARCH_WORKSPACE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <boost/limits.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  namespace detail {
+
+    template <typename Vertex, typename Distance>
+    struct search_workspace_entry
+    {
+      unsigned int generation;
+      Distance distance;
+      Vertex predecessor;
+      std::size_t index_in_heap;
+      default_color_type color;
+    };
+
+    // Read-write map of one field of the entries of a search_workspace; an
+    // entry from an earlier generation reads as its initial value
+    template <typename Workspace, typename Value,
+              Value Workspace::entry_type::*Field>
+    struct search_workspace_map
+    {
+      typedef typename Workspace::vertex_descriptor key_type;
+      typedef Value value_type;
+      typedef Value reference;
+      typedef read_write_property_map_tag category;
+
+      search_workspace_map() : workspace(0) {}
+      explicit search_workspace_map(Workspace* workspace)
+        : workspace(workspace) {}
+
+      Workspace* workspace;
+    };
+
+    // Visitor of a search with a workspace: the event initialize_vertex
+    // fires for each vertex when the search first examines an edge to it,
+    // unless it was reached already in this generation, instead of for
+    // every vertex before the search.  Every other event is passed on.
+    template <typename Visitor, typename Workspace>
+    struct search_workspace_visitor
+    {
+      search_workspace_visitor(Visitor vis, const Workspace* workspace)
+        : m_vis(vis), m_workspace(workspace) {}
+
+      template <class Vertex, class Graph>
+      void initialize_vertex(Vertex u, const Graph& g)
+      { m_vis.initialize_vertex(u, g); }
+      template <class Vertex, class Graph>
+      void discover_vertex(Vertex u, const Graph& g)
+      { m_vis.discover_vertex(u, g); }
+      template <class Vertex, class Graph>
+      void examine_vertex(Vertex u, const Graph& g)
+      { m_vis.examine_vertex(u, g); }
+      template <class Vertex, class Graph>
+      void finish_vertex(Vertex u, const Graph& g)
+      { m_vis.finish_vertex(u, g); }
+
+      template <class Edge, class Graph>
+      void examine_edge(Edge e, const Graph& g)
+      {
+        if (!m_workspace->touched(target(e, g)))
+          m_vis.initialize_vertex(target(e, g), g);
+        m_vis.examine_edge(e, g);
+      }
+      template <class Edge, class Graph>
+      void tree_edge(Edge e, const Graph& g) { m_vis.tree_edge(e, g); }
+      template <class Edge, class Graph>
+      void non_tree_edge(Edge e, const Graph& g)
+      { m_vis.non_tree_edge(e, g); }
+      template <class Edge, class Graph>
+      void gray_target(Edge e, const Graph& g) { m_vis.gray_target(e, g); }
+      template <class Edge, class Graph>
+      void black_target(Edge e, const Graph& g)
+      { m_vis.black_target(e, g); }
+      template <class Edge, class Graph>
+      void edge_relaxed(Edge e, const Graph& g)
+      { m_vis.edge_relaxed(e, g); }
+      template <class Edge, class Graph>
+      void edge_not_relaxed(Edge e, const Graph& g)
+      { m_vis.edge_not_relaxed(e, g); }
+
+      Visitor m_vis;
+      const Workspace* m_workspace;
+    };
+
+    template <typename Visitor, typename Workspace>
+    inline search_workspace_visitor<Visitor, Workspace>
+    make_search_workspace_visitor(Visitor vis, const Workspace& workspace)
+    {
+      return search_workspace_visitor<Visitor, Workspace>(vis, &workspace);
+    }
+
+  } // namespace detail
+
+  // Outside of detail, where they would hide boost::get and boost::put from
+  // the unqualified calls of the algorithms in detail
+  template <typename Workspace, typename Value,
+            Value Workspace::entry_type::*Field>
+  inline Value
+  get(const detail::search_workspace_map<Workspace, Value, Field>& pm,
+      typename Workspace::vertex_descriptor key)
+  {
+    const typename Workspace::entry_type* e = pm.workspace->find(key);
+    return e ? e->*Field : pm.workspace->initial(key).*Field;
+  }
+
+  template <typename Workspace, typename Value,
+            Value Workspace::entry_type::*Field>
+  inline void
+  put(const detail::search_workspace_map<Workspace, Value, Field>& pm,
+      typename Workspace::vertex_descriptor key, const Value& value)
+  {
+    pm.workspace->touch(key).*Field = value;
+  }
+
+  // Distance is the value type of the distance map, and inf the distance of
+  // the vertices not reached in the current generation; their predecessor
+  // is themselves, their color white and they are not in a queue.
+  template <typename Graph, typename Distance = std::size_t,
+            typename VertexIndexMap =
+              typename property_map<Graph, vertex_index_t>::const_type>
+  class search_workspace
+  {
+  public:
+    typedef typename graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+    typedef Distance distance_type;
+    typedef VertexIndexMap vertex_index_map_type;
+    typedef detail::search_workspace_entry<vertex_descriptor, Distance>
+      entry_type;
+
+    typedef detail::search_workspace_map<search_workspace, Distance,
+                                         &entry_type::distance>
+      distance_map_type;
+    typedef detail::search_workspace_map<search_workspace, vertex_descriptor,
+                                         &entry_type::predecessor>
+      predecessor_map_type;
+    typedef detail::search_workspace_map<search_workspace, std::size_t,
+                                         &entry_type::index_in_heap>
+      index_in_heap_map_type;
+    typedef detail::search_workspace_map<search_workspace, default_color_type,
+                                         &entry_type::color>
+      color_map_type;
+
+    explicit search_workspace
+      (const Graph& g,
+       Distance inf = (std::numeric_limits<Distance>::max)())
+      : m_entries(num_vertices(g)), m_index(get(vertex_index, g)),
+        m_generation(1), m_inf(inf)
+    { clear_generations(); }
+
+    search_workspace(const Graph& g, VertexIndexMap index,
+                     Distance inf = (std::numeric_limits<Distance>::max)())
+      : m_entries(num_vertices(g)), m_index(index), m_generation(1),
+        m_inf(inf)
+    { clear_generations(); }
+
+    // Forget the previous search in O(1); every call taking this workspace
+    // starts with it
+    void reset()
+    {
+      if (++m_generation == 0) {
+        // Once every 2^32 searches, the generations wrap around
+        clear_generations();
+        m_generation = 1;
+      }
+    }
+
+    distance_map_type distance_map() { return distance_map_type(this); }
+    predecessor_map_type predecessor_map()
+    { return predecessor_map_type(this); }
+    index_in_heap_map_type index_in_heap_map()
+    { return index_in_heap_map_type(this); }
+    color_map_type color_map() { return color_map_type(this); }
+
+    VertexIndexMap vertex_index_map() const { return m_index; }
+    Distance distance_inf() const { return m_inf; }
+
+    // Was v reached by the current search?
+    bool touched(vertex_descriptor v) const { return find(v) != 0; }
+
+    const entry_type* find(vertex_descriptor v) const
+    {
+      const entry_type& e = m_entries[get(m_index, v)];
+      return e.generation == m_generation ? &e : 0;
+    }
+
+    entry_type& touch(vertex_descriptor v)
+    {
+      entry_type& e = m_entries[get(m_index, v)];
+      if (e.generation != m_generation) e = initial(v);
+      return e;
+    }
+
+    entry_type initial(vertex_descriptor v) const
+    {
+      entry_type e;
+      e.generation = m_generation;
+      e.distance = m_inf;
+      e.predecessor = v;
+      e.index_in_heap = std::size_t(-1);
+      e.color = white_color;
+      return e;
+    }
+
+  private:
+    void clear_generations()
+    {
+      for (std::size_t i = 0; i < m_entries.size(); ++i)
+        m_entries[i].generation = 0;
+    }
+
+    std::vector<entry_type> m_entries;
+    VertexIndexMap m_index;
+    unsigned int m_generation;
+    Distance m_inf;
+  };
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_SEARCH_WORKSPACE_HPP
@@ -31,6 +31,7 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
 #include <boost/pending/bucket_sorter.hpp>
+#include <boost/property_map/shared_array_property_map.hpp>
 
 namespace boost {
 
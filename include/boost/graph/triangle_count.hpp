@@ -0,0 +1,344 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_TRIANGLE_COUNT_HPP
+#define BOOST_GRAPH_TRIANGLE_COUNT_HPP
+
+/*
+ * Triangle counting by sorted adjacency intersection.
+ *
+ * The simple undirected graph underlying g (without self-loops, parallel
+ * edges or edge directions) is copied into compressed sparse row arrays in
+ * which the vertices are numbered by increasing degree, and each edge is
+ * kept only at its endpoint of lower number.  Every vertex then has at most
+ * sqrt(2m) out-neighbors, and every triangle {u, v, w} with u < v < w is
+ * found exactly once, as an element w common to the sorted out-neighbor
+ * lists of u and of its out-neighbor v (M. Latapy, "Main-memory triangle
+ * computations for very large (sparse (power-law)) graphs", Theoretical
+ * Computer Science 407, 2008).  Lists of similar lengths are intersected by
+ * a branch-free merge, and a short list with a much longer one by galloping
+ * through the longer one.
+ */
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost {
+
+  // Totals of count_triangles over the whole graph
+  struct triangle_totals
+  {
+    boost::uintmax_t triangles;  // number of triangles
+    boost::uintmax_t triples;    // number of paths of two edges
+    double transitivity;         // 3 * triangles / triples, or 0
+    double mean_clustering;      // mean of the clustering coefficients
+  };
+
+  namespace detail {
+
+    // The oriented graph in which the triangles are counted; vertices are
+    // numbered by rank, the position of their vertex index in the order of
+    // increasing (degree, index)
+    struct triangle_graph
+    {
+      std::vector<std::size_t> offsets, targets;
+      std::vector<std::size_t> degree;  // in the simple undirected graph
+      std::vector<std::size_t> order;   // vertex index of each rank
+    };
+
+    // Intersects the sorted ranges [a, a_end) and [b, b_end) and calls
+    // f(x) for every common element x; returns their number
+    template <typename Function>
+    inline std::size_t
+    merge_intersect(const std::size_t* a, const std::size_t* a_end,
+                    const std::size_t* b, const std::size_t* b_end,
+                    Function& f)
+    {
+      std::size_t count = 0;
+      while (a != a_end && b != b_end) {
+        std::size_t x = *a, y = *b;
+        if (x == y) {
+          f(x);
+          ++count;
+        }
+        a += x <= y;
+        b += y <= x;
+      }
+      return count;
+    }
+
+    // The same for a short [a, a_end) and a long [b, b_end)
+    template <typename Function>
+    inline std::size_t
+    gallop_intersect(const std::size_t* a, const std::size_t* a_end,
+                     const std::size_t* b, const std::size_t* b_end,
+                     Function& f)
+    {
+      std::size_t count = 0;
+      for (; a != a_end && b != b_end; ++a) {
+        // hi stops at b_end rather than past it, which would be undefined
+        std::size_t step = 1;
+        const std::size_t* hi = b;
+        while (hi != b_end && *hi < *a) {
+          b = hi + 1;
+          hi = std::size_t(b_end - hi) > step ? hi + step : b_end;
+          step *= 2;
+        }
+        b = std::lower_bound(b, hi == b_end ? b_end : hi + 1, *a);
+        if (b != b_end && *b == *a) {
+          f(*a);
+          ++count;
+          ++b;
+        }
+      }
+      return count;
+    }
+
+    template <typename Function>
+    inline std::size_t
+    sorted_intersect(const std::size_t* a, const std::size_t* a_end,
+                     const std::size_t* b, const std::size_t* b_end,
+                     Function& f)
+    {
+      std::size_t na = a_end - a, nb = b_end - b;
+      if (na * 32 < nb) return gallop_intersect(a, a_end, b, b_end, f);
+      if (nb * 32 < na) return gallop_intersect(b, b_end, a, a_end, f);
+      return merge_intersect(a, a_end, b, b_end, f);
+    }
+
+    // Adds one triangle to the count of every third vertex found
+    struct count_third_vertex
+    {
+      std::size_t* counts;
+      void operator()(std::size_t w) const { ++counts[w]; }
+    };
+
+    // Counts the triangles at the vertices of ranks [first, last), the
+    // lowest vertex of each, adding one to counts[r] for every vertex r of
+    // each triangle; returns the number of triangles
+    inline boost::uintmax_t
+    count_triangles_from(const triangle_graph& tg, std::size_t first,
+                         std::size_t last, std::size_t* counts)
+    {
+      const std::size_t* targets = tg.targets.empty() ? 0 : &tg.targets[0];
+      count_third_vertex f = {counts};
+      boost::uintmax_t total = 0;
+      for (std::size_t u = first; u < last; ++u) {
+        const std::size_t* u_begin = targets + tg.offsets[u];
+        const std::size_t* u_end = targets + tg.offsets[u + 1];
+        std::size_t at_u = 0;
+        for (const std::size_t* vi = u_begin; vi != u_end; ++vi) {
+          std::size_t v = *vi;
+          // Only the targets after v can close a triangle with u and v
+          std::size_t c = sorted_intersect(vi + 1, u_end,
+                                           targets + tg.offsets[v],
+                                           targets + tg.offsets[v + 1], f);
+          counts[v] += c;
+          at_u += c;
+        }
+        counts[u] += at_u;
+        total += at_u;
+      }
+      return total;
+    }
+
+    // Sorts the out-neighbor lists of the vertices [first, last) and moves
+    // their distinct elements to the front of their ranges, whose new
+    // lengths go to length
+    inline void
+    sort_triangle_lists(std::vector<std::size_t>& offsets,
+                        std::vector<std::size_t>& targets,
+                        std::vector<std::size_t>& length,
+                        std::size_t first, std::size_t last)
+    {
+      for (std::size_t u = first; u < last; ++u) {
+        std::size_t* b = targets.empty() ? 0 : &targets[0] + offsets[u];
+        std::size_t* e = b + (offsets[u + 1] - offsets[u]);
+        std::sort(b, e);
+        length[u] = std::unique(b, e) - b;
+      }
+    }
+
+    struct serial_triangle_for
+    {
+      template <typename Function>
+      void operator()(std::size_t n, Function f) const { f(0, n); }
+    };
+
+    struct sort_triangle_lists_range
+    {
+      std::vector<std::size_t>* offsets;
+      std::vector<std::size_t>* targets;
+      std::vector<std::size_t>* length;
+      void operator()(std::size_t first, std::size_t last) const
+      { sort_triangle_lists(*offsets, *targets, *length, first, last); }
+    };
+
+    // Builds tg from g; for_range(n, f) must call f(first, last) on
+    // disjoint ranges covering [0, n), possibly concurrently
+    template <typename Graph, typename VertexIndexMap, typename ForRange>
+    void build_triangle_graph(const Graph& g, VertexIndexMap index,
+                              triangle_graph& tg, ForRange for_range)
+    {
+      BOOST_CONCEPT_ASSERT(( VertexListGraphConcept<Graph> ));
+      BOOST_CONCEPT_ASSERT(( IncidenceGraphConcept<Graph> ));
+      std::size_t n = num_vertices(g);
+
+      // Both directions of every edge other than self-loops, by vertex
+      // index, then sorted and without duplicates: the simple undirected
+      // graph
+      std::vector<std::size_t> offsets(n + 1), targets, length(n);
+      typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+      typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        std::size_t u = get(index, *vi);
+        for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei) {
+          std::size_t v = get(index, target(*ei, g));
+          if (u != v) {
+            ++offsets[u + 1];
+            ++offsets[v + 1];
+          }
+        }
+      }
+      for (std::size_t u = 0; u < n; ++u) offsets[u + 1] += offsets[u];
+      targets.resize(offsets[n]);
+      std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        std::size_t u = get(index, *vi);
+        for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei) {
+          std::size_t v = get(index, target(*ei, g));
+          if (u != v) {
+            targets[next[u]++] = v;
+            targets[next[v]++] = u;
+          }
+        }
+      }
+      sort_triangle_lists_range sort = {&offsets, &targets, &length};
+      for_range(n, sort);
+
+      // Ranks by increasing (degree, index)
+      std::vector<std::pair<std::size_t, std::size_t> > by_degree(n);
+      for (std::size_t u = 0; u < n; ++u)
+        by_degree[u] = std::make_pair(length[u], u);
+      std::sort(by_degree.begin(), by_degree.end());
+      tg.order.resize(n);
+      tg.degree.resize(n);
+      std::vector<std::size_t> rank(n);
+      for (std::size_t r = 0; r < n; ++r) {
+        tg.order[r] = by_degree[r].second;
+        tg.degree[r] = by_degree[r].first;
+        rank[by_degree[r].second] = r;
+      }
+
+      // Every edge at its endpoint of lower rank
+      tg.offsets.assign(n + 1, 0);
+      for (std::size_t u = 0; u < n; ++u)
+        for (std::size_t j = offsets[u]; j < offsets[u] + length[u]; ++j)
+          if (rank[u] < rank[targets[j]]) ++tg.offsets[rank[u] + 1];
+      for (std::size_t r = 0; r < n; ++r) tg.offsets[r + 1] += tg.offsets[r];
+      tg.targets.resize(tg.offsets[n]);
+      next.assign(tg.offsets.begin(), tg.offsets.end() - 1);
+      for (std::size_t u = 0; u < n; ++u)
+        for (std::size_t j = offsets[u]; j < offsets[u] + length[u]; ++j)
+          if (rank[u] < rank[targets[j]])
+            tg.targets[next[rank[u]]++] = rank[targets[j]];
+      std::vector<std::size_t> oriented_length(n);
+      sort_triangle_lists_range oriented_sort =
+        {&tg.offsets, &tg.targets, &oriented_length};
+      for_range(n, oriented_sort);
+    }
+
+    // Writes the triangle counts and the clustering coefficients, given by
+    // rank in counts, and computes the totals
+    template <typename TriangleMap, typename ClusteringMap,
+              typename VertexIndexMap, typename Graph>
+    triangle_totals
+    finish_triangle_counts(const Graph& g, const triangle_graph& tg,
+                           const std::vector<std::size_t>& counts,
+                           boost::uintmax_t triangles, TriangleMap tm,
+                           ClusteringMap cm, VertexIndexMap index)
+    {
+      typedef typename property_traits<ClusteringMap>::value_type Coefficient;
+      std::size_t n = tg.order.size();
+      std::vector<std::size_t> rank(n);
+      for (std::size_t r = 0; r < n; ++r) rank[tg.order[r]] = r;
+
+      triangle_totals totals;
+      totals.triangles = triangles;
+      totals.triples = 0;
+      double sum = 0;
+      typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        std::size_t r = rank[get(index, *vi)];
+        boost::uintmax_t d = tg.degree[r];
+        boost::uintmax_t triples = d * (d - (d > 0)) / 2;
+        totals.triples += triples;
+        double c = triples == 0 ? 0.0 : double(counts[r]) / double(triples);
+        sum += c;
+        put(tm, *vi, counts[r]);
+        put(cm, *vi, Coefficient(c));
+      }
+      totals.transitivity = totals.triples == 0 ? 0.0
+        : 3.0 * double(triangles) / double(totals.triples);
+      totals.mean_clustering = n == 0 ? 0.0 : sum / double(n);
+      return totals;
+    }
+
+  } // namespace detail
+
+  // Counts the triangles of the simple undirected graph underlying g: edge
+  // directions, self-loops and parallel edges are ignored.  Writes the
+  // number of triangles on each vertex to tm and its clustering coefficient
+  // (the fraction of the pairs of its neighbors that are adjacent) to cm,
+  // either of which may be a dummy_property_map, and returns the totals.
+  template <typename Graph, typename TriangleMap, typename ClusteringMap,
+            typename VertexIndexMap>
+  triangle_totals
+  count_triangles(const Graph& g, TriangleMap tm, ClusteringMap cm,
+                  VertexIndexMap index)
+  {
+    detail::triangle_graph tg;
+    detail::build_triangle_graph(g, index, tg,
+                                 detail::serial_triangle_for());
+    std::vector<std::size_t> counts(num_vertices(g));
+    boost::uintmax_t triangles = counts.empty() ? 0
+      : detail::count_triangles_from(tg, 0, counts.size(), &counts[0]);
+    return detail::finish_triangle_counts(g, tg, counts, triangles, tm, cm,
+                                          index);
+  }
+
+  template <typename Graph, typename TriangleMap, typename ClusteringMap>
+  inline triangle_totals
+  count_triangles(const Graph& g, TriangleMap tm, ClusteringMap cm)
+  {
+    return count_triangles(g, tm, cm, get(vertex_index, g));
+  }
+
+  template <typename Graph, typename TriangleMap>
+  inline triangle_totals
+  count_triangles(const Graph& g, TriangleMap tm)
+  {
+    return count_triangles(g, tm, dummy_property_map(), get(vertex_index, g));
+  }
+
+  template <typename Graph>
+  inline triangle_totals
+  count_triangles(const Graph& g)
+  {
+    return count_triangles(g, dummy_property_map(), dummy_property_map(),
+                           get(vertex_index, g));
+  }
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_TRIANGLE_COUNT_HPP
@@ -0,0 +1,514 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compressed sparse row graph whose adjacency lists are stored sorted and
+// gap-encoded with variable-length integers.
+
+#ifndef BOOST_GRAPH_VARINT_CSR_GRAPH_HPP
+#define BOOST_GRAPH_VARINT_CSR_GRAPH_HPP
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/cstdint.hpp>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+
+namespace boost {
+
+namespace detail {
+
+  /* Adjacency list encoding of varint_csr_graph.
+   *
+   * The targets of each row are sorted.  The first one is stored as its
+   * signed distance from the source, zigzag-encoded, and each of the others
+   * as its distance from the previous target (zero for parallel edges).
+   * Every number is written as a little-endian base-128 varint: seven bits
+   * per byte, with the high bit set on all bytes but the last.  Graphs whose
+   * neighbors have nearby indices thus need a byte or two per edge.
+   *
+   * Each row starts with two varints of its own: the index of its first
+   * edge, relative to the first edge of its block of varint_csr_block_size
+   * vertices, and its out-degree.  The graph only keeps, per vertex, the
+   * 32-bit position of the row relative to the first byte of its block, and
+   * per block the index of its first edge and byte.  That is four bytes and
+   * a bit per vertex, plus a byte or two for the header of each row,
+   * instead of full-width edge and byte indices for every vertex.
+   */
+  const std::size_t varint_csr_block_size = 64;
+
+  template <typename T>
+  inline void varint_encode(T value, std::vector<unsigned char>& out) {
+    while (value >= 0x80) {
+      out.push_back(static_cast<unsigned char>(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+  }
+
+  template <typename T>
+  inline T varint_decode(const unsigned char*& pos) {
+    unsigned char byte = *pos++;
+    T value = byte & 0x7f;
+    for (unsigned int shift = 7; byte & 0x80; shift += 7) {
+      byte = *pos++;
+      value |= T(byte & 0x7f) << shift;
+    }
+    return value;
+  }
+
+  template <typename Vertex>
+  inline boost::uint64_t zigzag_encode(Vertex source, Vertex target) {
+    return target >= source
+             ? boost::uint64_t(target - source) << 1
+             : (boost::uint64_t(source - target) << 1) - 1;
+  }
+
+  template <typename Vertex>
+  inline Vertex zigzag_decode(Vertex source, boost::uint64_t code) {
+    return (code & 1) ? Vertex(source - Vertex((code + 1) >> 1))
+                      : Vertex(source + Vertex(code >> 1));
+  }
+
+  template <typename Vertex, typename EdgeIndex>
+  class varint_csr_edge_descriptor
+  {
+   public:
+    Vertex src;
+    Vertex tgt;
+    EdgeIndex idx;
+
+    varint_csr_edge_descriptor(Vertex src, Vertex tgt, EdgeIndex idx)
+      : src(src), tgt(tgt), idx(idx) {}
+    varint_csr_edge_descriptor() : src(0), tgt(0), idx(0) {}
+
+    bool operator==(const varint_csr_edge_descriptor& e) const
+    { return idx == e.idx; }
+    bool operator!=(const varint_csr_edge_descriptor& e) const
+    { return idx != e.idx; }
+    bool operator<(const varint_csr_edge_descriptor& e) const
+    { return idx < e.idx; }
+    bool operator>(const varint_csr_edge_descriptor& e) const
+    { return idx > e.idx; }
+    bool operator<=(const varint_csr_edge_descriptor& e) const
+    { return idx <= e.idx; }
+    bool operator>=(const varint_csr_edge_descriptor& e) const
+    { return idx >= e.idx; }
+  };
+
+  template <typename Vertex, typename EdgeIndex>
+  struct varint_csr_edge_index_map
+  {
+    typedef EdgeIndex                 value_type;
+    typedef EdgeIndex                 reference;
+    typedef varint_csr_edge_descriptor<Vertex, EdgeIndex> key_type;
+    typedef readable_property_map_tag category;
+  };
+
+  template <typename Vertex, typename EdgeIndex>
+  inline EdgeIndex
+  get(const varint_csr_edge_index_map<Vertex, EdgeIndex>&,
+      const varint_csr_edge_descriptor<Vertex, EdgeIndex>& key)
+  {
+    return key.idx;
+  }
+
+  // Decodes the targets of one row as it goes.  Iterators into the same row
+  // compare by edge index, so the end iterator needs no valid position.
+  template <typename Vertex, typename EdgeIndex>
+  class varint_csr_out_edge_iterator
+    : public iterator_facade<varint_csr_out_edge_iterator<Vertex, EdgeIndex>,
+                             varint_csr_edge_descriptor<Vertex, EdgeIndex>,
+                             std::forward_iterator_tag,
+                             const varint_csr_edge_descriptor<Vertex, EdgeIndex>&>
+  {
+   public:
+    typedef varint_csr_edge_descriptor<Vertex, EdgeIndex> edge_descriptor;
+
+    varint_csr_out_edge_iterator() : m_pos(0), m_end(0) {}
+
+    // Iterator to the first of the edges [first, last) of source, whose
+    // encoding starts at pos
+    varint_csr_out_edge_iterator(Vertex source, EdgeIndex first,
+                                 EdgeIndex last, const unsigned char* pos)
+      : m_edge(source, source, first), m_pos(pos), m_end(last)
+    {
+      if (first != last)
+        m_edge.tgt = zigzag_decode(source,
+                                   varint_decode<boost::uint64_t>(m_pos));
+    }
+
+    // Past-the-end iterator of a row ending at edge last
+    varint_csr_out_edge_iterator(Vertex source, EdgeIndex last)
+      : m_edge(source, source, last), m_pos(0), m_end(last) {}
+
+   public: // GCC 4.2.1 doesn't like the private-and-friend thing
+    // iterator_facade requirements
+    const edge_descriptor& dereference() const { return m_edge; }
+
+    bool equal(const varint_csr_out_edge_iterator& other) const
+    { return m_edge == other.m_edge; }
+
+    void increment()
+    {
+      if (++m_edge.idx != m_end)
+        m_edge.tgt += varint_decode<Vertex>(m_pos);
+    }
+
+    edge_descriptor m_edge;
+    const unsigned char* m_pos;
+    EdgeIndex m_end;
+
+    friend class boost::iterator_core_access;
+  };
+
+  template <typename Vertex, typename EdgeIndex>
+  class varint_csr_adjacency_iterator
+    : public iterator_adaptor<varint_csr_adjacency_iterator<Vertex, EdgeIndex>,
+                              varint_csr_out_edge_iterator<Vertex, EdgeIndex>,
+                              Vertex, use_default, Vertex>
+  {
+    typedef iterator_adaptor<varint_csr_adjacency_iterator<Vertex, EdgeIndex>,
+                             varint_csr_out_edge_iterator<Vertex, EdgeIndex>,
+                             Vertex, use_default, Vertex> super_t;
+
+   public:
+    varint_csr_adjacency_iterator() {}
+    explicit varint_csr_adjacency_iterator
+      (const varint_csr_out_edge_iterator<Vertex, EdgeIndex>& i)
+      : super_t(i) {}
+
+   private:
+    friend class boost::iterator_core_access;
+    Vertex dereference() const { return this->base_reference()->tgt; }
+  };
+
+} // namespace detail
+
+/** Directed compressed sparse row graph with compressed adjacency lists.
+ *
+ * Like compressed_sparse_row_graph, but each adjacency list is sorted and
+ * stored as variable-length gaps between consecutive targets (see
+ * varint_encode above) instead of full-width vertex indices, which are
+ * decoded on the fly by the out-edge and adjacency iterators.  This usually
+ * takes one to three bytes per edge instead of sizeof(Vertex).  The graph
+ * is immutable and has no properties; edge indices number the edges row by
+ * row in sorted target order and can be used with external property maps.
+ *
+ * Vertex and EdgeIndex should be unsigned integral types.
+ */
+template <typename Vertex = std::size_t, typename EdgeIndex = Vertex>
+class varint_csr_graph
+{
+ public:
+  // For Graph
+  typedef Vertex vertex_descriptor;
+  typedef detail::varint_csr_edge_descriptor<Vertex, EdgeIndex>
+    edge_descriptor;
+  typedef directed_tag directed_category;
+  typedef allow_parallel_edge_tag edge_parallel_category;
+
+  class traversal_category: public incidence_graph_tag,
+                            public adjacency_graph_tag,
+                            public vertex_list_graph_tag {};
+
+  static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
+
+  // For VertexListGraph
+  typedef counting_iterator<Vertex> vertex_iterator;
+  typedef Vertex vertices_size_type;
+
+  // For EdgeListGraph (only num_edges is provided)
+  typedef EdgeIndex edges_size_type;
+  typedef void edge_iterator;
+
+  // For IncidenceGraph
+  typedef detail::varint_csr_out_edge_iterator<Vertex, EdgeIndex>
+    out_edge_iterator;
+  typedef EdgeIndex degree_size_type;
+
+  // For AdjacencyGraph
+  typedef detail::varint_csr_adjacency_iterator<Vertex, EdgeIndex>
+    adjacency_iterator;
+
+  // For BidirectionalGraph (not implemented)
+  typedef void in_edge_iterator;
+
+  typedef no_property vertex_property_type;
+  typedef no_property edge_property_type;
+  typedef no_property graph_property_type;
+
+  // An empty graph with numverts vertices
+  explicit varint_csr_graph(vertices_size_type numverts = 0)
+  {
+    compressed_sparse_row_graph<directedS, no_property, no_property,
+                                no_property, Vertex, EdgeIndex> g(numverts);
+    assign(g);
+  }
+
+  //  From number of vertices and unsorted list of edges, which is traversed
+  //  twice; needs temporary storage for an uncompressed copy of the graph
+  template <typename MultiPassInputIterator>
+  varint_csr_graph(edges_are_unsorted_multi_pass_t,
+                   MultiPassInputIterator edge_begin,
+                   MultiPassInputIterator edge_end,
+                   vertices_size_type numverts)
+  {
+    compressed_sparse_row_graph<directedS, no_property, no_property,
+                                no_property, Vertex, EdgeIndex>
+      g(edges_are_unsorted_multi_pass, edge_begin, edge_end, numverts);
+    assign(g);
+  }
+
+  //  From number of vertices and list of edges sorted by source
+  template <typename InputIterator>
+  varint_csr_graph(edges_are_sorted_t,
+                   InputIterator edge_begin, InputIterator edge_end,
+                   vertices_size_type numverts)
+  {
+    compressed_sparse_row_graph<directedS, no_property, no_property,
+                                no_property, Vertex, EdgeIndex>
+      g(edges_are_sorted, edge_begin, edge_end, numverts);
+    assign(g);
+  }
+
+  // Compress the out-edges of a compressed_sparse_row_graph
+  template <typename Directed, typename VertexProperty,
+            typename EdgeProperty, typename GraphProperty>
+  explicit varint_csr_graph(const compressed_sparse_row_graph<Directed,
+                              VertexProperty, EdgeProperty, GraphProperty,
+                              Vertex, EdgeIndex>& g)
+  {
+    assign(g);
+  }
+
+  // Size in bytes of the encoded adjacency lists and of the row indices
+  std::size_t encoded_size() const
+  {
+    return m_bytes.size()
+           + m_rowoffset.size() * sizeof(boost::uint32_t)
+           + m_block_edge.size() * sizeof(EdgeIndex)
+           + m_block_byte.size() * sizeof(std::size_t);
+  }
+
+  // Decodes the header of the row of v: the index of its first edge and
+  // its out-degree.  Returns the position of its first target.
+  const unsigned char* row(Vertex v, EdgeIndex& first, EdgeIndex& degree) const
+  {
+    std::size_t block = v / detail::varint_csr_block_size;
+    const unsigned char* pos = &m_bytes[m_block_byte[block] + m_rowoffset[v]];
+    first = m_block_edge[block] + detail::varint_decode<EdgeIndex>(pos);
+    degree = detail::varint_decode<EdgeIndex>(pos);
+    return pos;
+  }
+
+  // private: non-portable, requires friend templates
+  Vertex m_num_vertices;
+  EdgeIndex m_num_edges;
+  std::vector<boost::uint32_t> m_rowoffset;
+  std::vector<EdgeIndex> m_block_edge;
+  std::vector<std::size_t> m_block_byte;
+  std::vector<unsigned char> m_bytes;
+
+ private:
+  template <typename Graph>
+  void assign(const Graph& g)
+  {
+    const std::size_t block_size = detail::varint_csr_block_size;
+    Vertex numverts = num_vertices(g);
+    const std::vector<EdgeIndex>& rowstart = g.m_forward.m_rowstart;
+    const std::vector<Vertex>& column = g.m_forward.m_column;
+    m_num_vertices = numverts;
+    m_num_edges = rowstart[numverts];
+    m_rowoffset.resize(numverts);
+    m_block_edge.resize((numverts + block_size - 1) / block_size);
+    m_block_byte.resize(m_block_edge.size());
+    m_bytes.clear();
+    m_bytes.reserve(column.size() * 2 + numverts * 2);
+    std::vector<Vertex> row;
+    for (Vertex v = 0; v < numverts; ++v) {
+      std::size_t block = v / block_size;
+      if (v % block_size == 0) {
+        m_block_edge[block] = rowstart[v];
+        m_block_byte[block] = m_bytes.size();
+      }
+      std::size_t offset = m_bytes.size() - m_block_byte[block];
+      if (offset != std::size_t(boost::uint32_t(offset)))
+        boost::throw_exception(std::length_error
+          ("varint_csr_graph: more than 4 GB of edges in one block"));
+      m_rowoffset[v] = boost::uint32_t(offset);
+      detail::varint_encode(EdgeIndex(rowstart[v] - m_block_edge[block]),
+                            m_bytes);
+      detail::varint_encode(EdgeIndex(rowstart[v + 1] - rowstart[v]),
+                            m_bytes);
+      row.assign(column.begin() + rowstart[v], column.begin() + rowstart[v + 1]);
+      if (row.empty()) continue;
+      std::sort(row.begin(), row.end());
+      detail::varint_encode(detail::zigzag_encode(v, row[0]), m_bytes);
+      for (std::size_t i = 1; i < row.size(); ++i)
+        detail::varint_encode(Vertex(row[i] - row[i - 1]), m_bytes);
+    }
+    std::vector<unsigned char>(m_bytes).swap(m_bytes);
+  }
+};
+
+#define BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS typename Vertex, typename EdgeIndex
+#define BOOST_VARINT_CSR_GRAPH_TYPE varint_csr_graph<Vertex, EdgeIndex>
+
+// From VertexListGraph
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+num_vertices(const BOOST_VARINT_CSR_GRAPH_TYPE& g) {
+  return g.m_num_vertices;
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<counting_iterator<Vertex>, counting_iterator<Vertex> >
+vertices(const BOOST_VARINT_CSR_GRAPH_TYPE& g) {
+  return std::make_pair(counting_iterator<Vertex>(0),
+                        counting_iterator<Vertex>(num_vertices(g)));
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+vertex(Vertex i, const BOOST_VARINT_CSR_GRAPH_TYPE&)
+{
+  return i;
+}
+
+// From IncidenceGraph
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+source(typename BOOST_VARINT_CSR_GRAPH_TYPE::edge_descriptor e,
+       const BOOST_VARINT_CSR_GRAPH_TYPE&)
+{
+  return e.src;
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+target(typename BOOST_VARINT_CSR_GRAPH_TYPE::edge_descriptor e,
+       const BOOST_VARINT_CSR_GRAPH_TYPE&)
+{
+  return e.tgt;
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<typename BOOST_VARINT_CSR_GRAPH_TYPE::out_edge_iterator,
+                 typename BOOST_VARINT_CSR_GRAPH_TYPE::out_edge_iterator>
+out_edges(Vertex v, const BOOST_VARINT_CSR_GRAPH_TYPE& g)
+{
+  typedef typename BOOST_VARINT_CSR_GRAPH_TYPE::out_edge_iterator it;
+  EdgeIndex first, degree;
+  const unsigned char* pos = g.row(v, first, degree);
+  return std::make_pair(it(v, first, first + degree, pos),
+                        it(v, first + degree));
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline EdgeIndex
+out_degree(Vertex v, const BOOST_VARINT_CSR_GRAPH_TYPE& g)
+{
+  EdgeIndex first, degree;
+  g.row(v, first, degree);
+  return degree;
+}
+
+// From AdjacencyGraph
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<typename BOOST_VARINT_CSR_GRAPH_TYPE::adjacency_iterator,
+                 typename BOOST_VARINT_CSR_GRAPH_TYPE::adjacency_iterator>
+adjacent_vertices(Vertex v, const BOOST_VARINT_CSR_GRAPH_TYPE& g)
+{
+  typedef typename BOOST_VARINT_CSR_GRAPH_TYPE::adjacency_iterator it;
+  std::pair<typename BOOST_VARINT_CSR_GRAPH_TYPE::out_edge_iterator,
+            typename BOOST_VARINT_CSR_GRAPH_TYPE::out_edge_iterator>
+    range = out_edges(v, g);
+  return std::make_pair(it(range.first), it(range.second));
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline EdgeIndex
+num_edges(const BOOST_VARINT_CSR_GRAPH_TYPE& g)
+{
+  return g.m_num_edges;
+}
+
+// Rows are sorted, so the search stops at the first target past j
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline std::pair<typename BOOST_VARINT_CSR_GRAPH_TYPE::edge_descriptor, bool>
+edge(Vertex i, Vertex j, const BOOST_VARINT_CSR_GRAPH_TYPE& g)
+{
+  typedef typename BOOST_VARINT_CSR_GRAPH_TYPE::out_edge_iterator out_edge_iter;
+  std::pair<out_edge_iter, out_edge_iter> range = out_edges(i, g);
+  for (; range.first != range.second && range.first->tgt <= j; ++range.first) {
+    if (range.first->tgt == j)
+      return std::make_pair(*range.first, true);
+  }
+  return std::make_pair(typename BOOST_VARINT_CSR_GRAPH_TYPE::edge_descriptor(),
+                        false);
+}
+
+// Property maps
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+struct property_map<BOOST_VARINT_CSR_GRAPH_TYPE, vertex_index_t>
+{
+  typedef typed_identity_property_map<Vertex> type;
+  typedef type const_type;
+};
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+struct property_map<BOOST_VARINT_CSR_GRAPH_TYPE, edge_index_t>
+{
+  typedef detail::varint_csr_edge_index_map<Vertex, EdgeIndex> type;
+  typedef type const_type;
+};
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline typed_identity_property_map<Vertex>
+get(vertex_index_t, const BOOST_VARINT_CSR_GRAPH_TYPE&)
+{
+  return typed_identity_property_map<Vertex>();
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline Vertex
+get(vertex_index_t, const BOOST_VARINT_CSR_GRAPH_TYPE&, Vertex v)
+{
+  return v;
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline detail::varint_csr_edge_index_map<Vertex, EdgeIndex>
+get(edge_index_t, const BOOST_VARINT_CSR_GRAPH_TYPE&)
+{
+  return detail::varint_csr_edge_index_map<Vertex, EdgeIndex>();
+}
+
+template<BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS>
+inline EdgeIndex
+get(edge_index_t, const BOOST_VARINT_CSR_GRAPH_TYPE&,
+    typename BOOST_VARINT_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+  return e.idx;
+}
+
+#undef BOOST_VARINT_CSR_GRAPH_TYPE
+#undef BOOST_VARINT_CSR_GRAPH_TEMPLATE_PARMS
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_VARINT_CSR_GRAPH_HPP
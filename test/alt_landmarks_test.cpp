@@ -0,0 +1,229 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Runs astar_search with the heuristics of alt_landmarks on a road-like
+// grid and on a sparse directed random graph, checks the distances against
+// dijkstra_shortest_paths and the bounds against the distances, and
+// reports how many vertices the searches examine and how long they take,
+// next to A* with the zero heuristic (that is, Dijkstra's algorithm
+// stopped at the target).
+// Usage: alt_landmarks_test [grid side [random graph vertices [queries [landmarks]]]]
+
+#include <boost/graph/alt_landmarks.hpp>
+#include <boost/graph/astar_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/timer.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iostream>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS, no_property, unsigned> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::pair<std::size_t, std::size_t> Edge;
+typedef property_map<Graph, edge_bundle_t>::const_type WeightMap;
+typedef property_map<Graph, vertex_index_t>::const_type IndexMap;
+
+struct found_target { };
+
+// Stops the search at the target and counts the vertices it examines
+class target_visitor : public default_astar_visitor
+{
+public:
+  target_visitor(Vertex t, std::size_t& examined)
+    : m_target(t), m_examined(&examined) {}
+
+  template <typename G>
+  void examine_vertex(Vertex u, const G&)
+  {
+    ++*m_examined;
+    if (u == m_target) throw found_target();
+  }
+
+private:
+  Vertex m_target;
+  std::size_t* m_examined;
+};
+
+// Distance from s to t found by astar_search with h, and the number of
+// vertices examined
+template <typename Heuristic>
+unsigned astar_distance(const Graph& g, Vertex s, Vertex t, Heuristic h,
+                        std::size_t& examined, std::vector<unsigned>& distance)
+{
+  examined = 0;
+  try {
+    astar_search
+      (g, s, h,
+       weight_map(get(edge_bundle, g))
+         .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g)))
+         .visitor(target_visitor(t, examined)));
+  } catch (found_target&) { }
+  return distance[t];
+}
+
+template <typename Landmarks>
+void test_landmarks(const Graph& g, const Landmarks& landmarks,
+                    const char* name, std::size_t num_queries,
+                    minstd_rand& gen)
+{
+  const unsigned inf = (std::numeric_limits<unsigned>::max)();
+  std::vector<unsigned> truth(num_vertices(g)), distance(num_vertices(g));
+  uniform_int<std::size_t> random_vertex(0, num_vertices(g) - 1);
+  std::size_t alt_examined = 0, zero_examined = 0, examined, reachable = 0;
+  double alt_time = 0, zero_time = 0;
+  timer timer;
+  for (std::size_t q = 0; q < num_queries; ++q) {
+    Vertex s = Vertex(random_vertex(gen)), t = Vertex(random_vertex(gen));
+    dijkstra_shortest_paths
+      (g, s, weight_map(get(edge_bundle, g))
+               .distance_map(make_iterator_property_map(truth.begin(), get(vertex_index, g))));
+
+    // Admissible: no bound exceeds the distance it bounds
+    for (std::size_t i = 0; i < 20; ++i) {
+      Vertex u = Vertex(random_vertex(gen));
+      if (truth[u] != inf) BOOST_TEST(landmarks.lower_bound(s, u) <= truth[u]);
+    }
+    BOOST_TEST(landmarks.lower_bound(t, t) == 0);
+
+    // Both searches examine every vertex s reaches when t is not one of
+    // them, so only the others count in the averages
+    if (truth[t] != inf) ++reachable;
+    timer.restart();
+    unsigned d = astar_distance(g, s, t, landmarks.heuristic(s, t), examined,
+                                distance);
+    if (truth[t] != inf) {
+      alt_time += timer.elapsed();
+      alt_examined += examined;
+    }
+    BOOST_TEST(d == truth[t]);
+
+    timer.restart();
+    d = astar_distance(g, s, t, astar_heuristic<Graph, unsigned>(), examined,
+                       distance);
+    if (truth[t] != inf) {
+      zero_time += timer.elapsed();
+      zero_examined += examined;
+    }
+    BOOST_TEST(d == truth[t]);
+  }
+  reachable = (std::max)(reachable, std::size_t(1));
+  std::cout << "  " << name << ": " << landmarks.num_landmarks()
+            << " landmarks, scale " << landmarks.scale() << ", "
+            << double(alt_examined) / reachable << " vertices examined ("
+            << double(zero_examined) / reachable
+            << " with the zero heuristic), " << alt_time / reachable * 1e6
+            << " us per query (" << zero_time / reachable * 1e6
+            << " us)\n";
+}
+
+void test_graph(const Graph& g, const char* name, std::size_t num_queries,
+                std::size_t k, minstd_rand& gen)
+{
+  std::cout << name << ": " << num_vertices(g) << " vertices, "
+            << num_edges(g) << " edges\n";
+  WeightMap weight = get(edge_bundle, g);
+  IndexMap index = get(vertex_index, g);
+
+  timer timer;
+  alt_landmarks<Graph, WeightMap, IndexMap> avoid
+    (g, k, avoid_landmarks, weight, index);
+  std::cout << "  avoid selection: " << timer.elapsed() << " s\n";
+  test_landmarks(g, avoid, "avoid, 32-bit", num_queries, gen);
+
+  timer.restart();
+  alt_landmarks<Graph, WeightMap, IndexMap> farthest
+    (g, k, farthest_landmarks, weight, index);
+  std::cout << "  farthest selection: " << timer.elapsed() << " s\n";
+  test_landmarks(g, farthest, "farthest, 32-bit", num_queries, gen);
+
+  // With 16-bit entries, the distances of larger grids no longer fit and
+  // are rounded
+  alt_landmarks<Graph, WeightMap, IndexMap, boost::uint16_t> compact
+    (g, avoid.landmarks().begin(), avoid.landmarks().end(), weight, index);
+  test_landmarks(g, compact, "avoid, 16-bit", num_queries, gen);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 100;
+  std::size_t n = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 5000;
+  std::size_t num_queries = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 100;
+  std::size_t k = argc > 4 ? lexical_cast<std::size_t>(argv[4]) : 16;
+  minstd_rand gen(1);
+
+  // Road-like grid with integer travel times and a few one-way streets
+  {
+    std::vector<Edge> edges;
+    for (std::size_t i = 0; i < side; ++i)
+      for (std::size_t j = 0; j < side; ++j) {
+        std::size_t v = i * side + j;
+        if (j + 1 < side) {
+          edges.push_back(Edge(v, v + 1));
+          if ((v * 7) % 10 != 0) edges.push_back(Edge(v + 1, v));
+        }
+        if (i + 1 < side) {
+          edges.push_back(Edge(v + side, v));
+          if ((v * 3) % 10 != 0) edges.push_back(Edge(v, v + side));
+        }
+      }
+    uniform_int<unsigned> travel_time(1, 1000);
+    std::vector<unsigned> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = travel_time(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), side * side);
+    test_graph(g, "Road-like grid", num_queries, k, gen);
+  }
+
+  // Sparse directed random graph, where some targets cannot be reached
+  {
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    std::vector<Edge> edges(ERIter(gen, n, 2.0 / n), ERIter());
+    uniform_int<unsigned> random_weight(0, 1000);
+    std::vector<unsigned> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = random_weight(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    test_graph(g, "Directed random graph", num_queries, k, gen);
+  }
+
+  // Undirected graph with the default weight and index maps, and more
+  // landmarks than vertices
+  {
+    typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                           property<edge_weight_t, double> > UGraph;
+    UGraph g(5);
+    add_edge(0, 1, 1.5, g);
+    add_edge(1, 2, 1.0, g);
+    add_edge(0, 2, 3.0, g);
+    add_edge(2, 3, 0.5, g);
+    alt_landmarks<UGraph> landmarks(g, 10);
+    BOOST_TEST(landmarks.num_landmarks() == 5);
+    BOOST_TEST(landmarks.lower_bound(0, 3) <= 3.0);
+    BOOST_TEST(landmarks.lower_bound(0, 3) > 2.9);
+    BOOST_TEST(landmarks.lower_bound(3, 0) > 2.9);
+    // 4 is isolated, and is a landmark: no other vertex reaches it
+    BOOST_TEST(landmarks.lower_bound(0, 4) >= 3.0);
+
+    alt_landmarks<UGraph> none(g, 0);
+    BOOST_TEST(none.lower_bound(0, 3) == 0.0);
+  }
+
+  return boost::report_errors();
+}
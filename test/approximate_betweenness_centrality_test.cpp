@@ -0,0 +1,185 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that approximate_betweenness_centrality stays within its error
+// bound of brandes_betweenness_centrality, with source and path sampling,
+// on unweighted and weighted directed random graphs and on an undirected
+// graph, reports the number of samples and the running times, and runs
+// betweenness_centrality_clustering with approximate edge centralities.
+// Usage: approximate_betweenness_centrality_test [vertices [epsilon]]
+
+#include <boost/graph/approximate_betweenness_centrality.hpp>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/bc_clustering.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS, no_property, int> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double max_error(const std::vector<double>& a,
+                        const std::vector<double>& b)
+{
+  double error = 0;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    error = (std::max)(error, std::abs(a[i] - b[i]));
+  return error;
+}
+
+void test_graph(const Graph& g, bool weighted, const char* name,
+                double epsilon, minstd_rand& gen)
+{
+  std::size_t n = num_vertices(g);
+  std::cout << name << ": " << n << " vertices, " << num_edges(g)
+            << " edges\n";
+  std::vector<double> expected(n), expected_edge(num_edges(g));
+  std::vector<double> centrality(n), edge(num_edges(g));
+
+  timer timer;
+  if (weighted)
+    brandes_betweenness_centrality
+      (g, weight_map(get(edge_bundle, g))
+            .centrality_map(make_iterator_property_map(expected.begin(), get(vertex_index, g)))
+            .edge_centrality_map(make_iterator_property_map(expected_edge.begin(), get(edge_index, g))));
+  else
+    brandes_betweenness_centrality
+      (g, make_iterator_property_map(expected.begin(), get(vertex_index, g)),
+       make_iterator_property_map(expected_edge.begin(), get(edge_index, g)));
+  std::cout << "  brandes_betweenness_centrality: " << timer.elapsed()
+            << " s\n";
+
+  // The bound holds with probability 0.9 for each run; with this seed, it
+  // holds for all of them
+  double bound = epsilon * double(n) * double(n - 1);
+  betweenness_sampling methods[] = {source_sampling, path_sampling};
+  const char* method_names[] = {"source sampling", "path sampling"};
+  for (int i = 0; i < 2; ++i) {
+    timer.restart();
+    std::size_t samples;
+    if (weighted)
+      samples = approximate_betweenness_centrality
+        (g, methods[i], epsilon, 0.1, gen,
+         weight_map(get(edge_bundle, g))
+           .centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, g)))
+           .edge_centrality_map(make_iterator_property_map(edge.begin(), get(edge_index, g))));
+    else
+      samples = approximate_betweenness_centrality
+        (g, methods[i], epsilon, 0.1, gen,
+         centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, g)))
+           .edge_centrality_map(make_iterator_property_map(edge.begin(), get(edge_index, g))));
+    double time = timer.elapsed();
+    double error = max_error(centrality, expected);
+    double edge_error = max_error(edge, expected_edge);
+    std::cout << "  " << method_names[i] << ": " << samples << " samples, "
+              << time << " s, largest error " << error / bound
+              << " (edges " << edge_error / bound << ") of the bound\n";
+    BOOST_TEST(samples > 0);
+    BOOST_TEST(error <= bound);
+    BOOST_TEST(edge_error <= bound);
+  }
+}
+
+// Stops after the first removal
+struct remove_one
+{
+  typedef double centrality_type;
+  bool removed;
+  remove_one() : removed(false) {}
+  template<typename E, typename G>
+  bool operator()(double, E, const G&)
+  {
+    bool done = removed;
+    removed = true;
+    return done;
+  }
+};
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 3000;
+  double epsilon = argc > 2 ? lexical_cast<double>(argv[2]) : 0.05;
+  minstd_rand gen(1);
+
+  // Sparse directed random graph, with small integer weights so that many
+  // shortest paths tie
+  {
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    std::vector<Edge> edges(ERIter(gen, n, 4.0 / n), ERIter());
+    uniform_int<> random_weight(1, 3);
+    std::vector<int> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = random_weight(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    test_graph(g, false, "Unweighted random graph", epsilon, gen);
+    test_graph(g, true, "Weighted random graph", epsilon, gen);
+  }
+
+  // Two cliques joined by a path through vertex 10
+  typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                         property<edge_index_t, std::size_t> > UGraph;
+  UGraph ug(21);
+  std::size_t next_index = 0;
+  for (std::size_t c = 0; c < 2; ++c)
+    for (std::size_t i = 0; i < 10; ++i)
+      for (std::size_t j = i + 1; j < 10; ++j)
+        add_edge(11 * c + i, 11 * c + j, next_index++, ug);
+  add_edge(9, 10, next_index++, ug);
+  add_edge(10, 11, next_index++, ug);
+  // On a copy without edge indices, source sampling needs more samples
+  // than there are vertices, so it is exact, and path sampling finds that
+  // every path between the cliques goes through 10
+  {
+    typedef adjacency_list<vecS, vecS, undirectedS> PlainGraph;
+    PlainGraph pg(21);
+    graph_traits<UGraph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(ug); ei != ei_end; ++ei)
+      add_edge(source(*ei, ug), target(*ei, ug), pg);
+    std::vector<double> expected(21), centrality(21);
+    brandes_betweenness_centrality
+      (pg, make_iterator_property_map(expected.begin(), get(vertex_index, pg)));
+    std::size_t samples = approximate_betweenness_centrality
+      (pg, source_sampling, 0.05, 0.1, gen,
+       centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, pg))));
+    BOOST_TEST(samples == 21);
+    BOOST_TEST(max_error(centrality, expected) < 1e-9);
+
+    // 100 of the 210 unordered pairs go through 10
+    samples = approximate_betweenness_centrality
+      (pg, path_sampling, 0.05, 0.1, gen,
+       centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, pg))));
+    BOOST_TEST(std::abs(centrality[10] - expected[10]) <= 0.05 * 210);
+    BOOST_TEST(std::abs(expected[10] - 100) < 1e-9);
+  }
+
+  // Clustering removes one of the bridges first
+  {
+    std::vector<double> edge_centrality(num_edges(ug));
+    betweenness_centrality_clustering
+      (ug, remove_one(),
+       make_iterator_property_map(edge_centrality.begin(), get(edge_index, ug)),
+       get(vertex_index, ug),
+       approximate_edge_betweenness<minstd_rand>(path_sampling, 0.05, 0.1,
+                                                 gen));
+    BOOST_TEST(num_edges(ug) == 91);
+    BOOST_TEST(!(edge(9, 10, ug).second && edge(10, 11, ug).second));
+  }
+
+  return boost::report_errors();
+}
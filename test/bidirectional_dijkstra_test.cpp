@@ -0,0 +1,220 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks bidirectional_dijkstra_shortest_path against dijkstra_shortest_paths
+// on grid_graph, on a road-like CSR graph and on a directed R-MAT graph, and
+// compares its running time, with and without workspaces, with a Dijkstra
+// search that stops at the target.
+// Usage: bidirectional_dijkstra_test [grid side [R-MAT scale [queries]]]
+
+#include <boost/graph/bidirectional_dijkstra_shortest_path.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/search_workspace.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/grid_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/array.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <iostream>
+
+using namespace boost;
+
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+struct target_reached {};
+
+// The two searches add up the weights of a path in a different order than
+// Dijkstra's algorithm, so floating-point lengths may differ in the last bits
+template <typename D>
+bool same_length(D a, D b)
+{ return std::abs(double(a) - double(b)) <= 1e-9 * std::max(double(a), double(b)); }
+
+// Stops dijkstra_shortest_paths when the target is removed from the queue
+template <typename Vertex>
+struct stop_at_target : public default_dijkstra_visitor
+{
+  explicit stop_at_target(Vertex t) : t(t) {}
+  template <typename Graph>
+  void examine_vertex(Vertex u, const Graph&) const
+  { if (u == t) throw target_reached(); }
+  Vertex t;
+};
+
+template <typename Graph, typename WeightMap>
+void run_queries(const Graph& g, WeightMap weight, const char* name,
+                 std::size_t num_queries, minstd_rand& gen)
+{
+  typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename property_traits<WeightMap>::value_type D;
+  const D inf = (std::numeric_limits<D>::max)();
+  std::size_t n = num_vertices(g);
+  std::vector<D> distance(n);
+  uniform_int<std::size_t> random_vertex(0, n - 1);
+  double dijkstra_time = 0, bidirectional_time = 0, workspace_time = 0;
+  search_workspace<Graph, D> forward(g), backward(g);
+
+  for (std::size_t q = 0; q < num_queries; ++q) {
+    Vertex s = vertex(random_vertex(gen), g), t = vertex(random_vertex(gen), g);
+
+    timer timer;
+    try {
+      dijkstra_shortest_paths
+        (g, s, weight_map(weight)
+               .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g)))
+               .visitor(stop_at_target<Vertex>(t)));
+    } catch (const target_reached&) {}
+    dijkstra_time += timer.elapsed();
+
+    std::vector<Vertex> path;
+    timer.restart();
+    D d = bidirectional_dijkstra_shortest_path
+            (g, s, t, std::back_inserter(path), weight_map(weight));
+    bidirectional_time += timer.elapsed();
+
+    // The same query with the state kept in workspaces
+    std::vector<Vertex> workspace_path;
+    timer.restart();
+    D workspace_d = bidirectional_dijkstra_shortest_path
+      (g, s, t, std::back_inserter(workspace_path), weight, forward, backward);
+    workspace_time += timer.elapsed();
+    BOOST_TEST(workspace_d == d);
+    BOOST_TEST(workspace_path == path);
+
+    D expected = distance[get(vertex_index, g, t)];
+    if (expected == inf) {
+      BOOST_TEST(d == inf);
+      BOOST_TEST(path.empty());
+      continue;
+    }
+    BOOST_TEST(same_length(d, expected));
+    // The path goes from s to t along edges whose weights add up to d
+    BOOST_TEST(!path.empty() && path.front() == s && path.back() == t);
+    D length = D();
+    for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+      D best = inf;
+      typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(path[i], g); ei != ei_end; ++ei)
+        if (target(*ei, g) == path[i + 1] && get(weight, *ei) < best)
+          best = get(weight, *ei);
+      BOOST_TEST(best != inf);
+      length += best;
+    }
+    BOOST_TEST(same_length(length, d));
+  }
+  std::cout << name << ": Dijkstra stopping at the target " << dijkstra_time
+            << " s, bidirectional Dijkstra " << bidirectional_time
+            << " s, speedup = " << dijkstra_time / bidirectional_time
+            << "; with workspaces " << workspace_time << " s, speedup = "
+            << dijkstra_time / workspace_time << ".\n";
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 300;
+  int scale = argc > 2 ? lexical_cast<int>(argv[2]) : 14;
+  std::size_t num_queries = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 50;
+  minstd_rand gen(1);
+
+  // grid_graph, with different weights in the two directions of each edge
+  {
+    typedef grid_graph<2> Grid;
+    boost::array<std::size_t, 2> lengths = {{side, side}};
+    Grid grid(lengths);
+    std::vector<double> weights(num_edges(grid));
+    uniform_real<> random_weight(1, 10);
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = random_weight(gen);
+    run_queries(grid, make_iterator_property_map(weights.begin(), get(edge_index, grid)),
+                "grid_graph", num_queries, gen);
+  }
+
+  // Road-like CSR graph with integer travel times
+  {
+    typedef compressed_sparse_row_graph<bidirectionalS, no_property, unsigned> Graph;
+    std::vector<Edge> edges;
+    for (std::size_t i = 0; i < side; ++i)
+      for (std::size_t j = 0; j < side; ++j) {
+        std::size_t v = i * side + j;
+        if (j + 1 < side) {
+          edges.push_back(Edge(v, v + 1));
+          edges.push_back(Edge(v + 1, v));
+        }
+        if (i + 1 < side) {
+          edges.push_back(Edge(v, v + side));
+          edges.push_back(Edge(v + side, v));
+        }
+      }
+    uniform_int<unsigned> travel_time(1, 100);
+    std::vector<unsigned> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = travel_time(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), side * side);
+    run_queries(g, get(edge_bundle, g), "Road-like CSR", num_queries, gen);
+  }
+
+  // Directed scale-free graph, where many targets are unreachable
+  {
+    typedef compressed_sparse_row_graph<bidirectionalS, no_property, unsigned> Graph;
+    std::size_t n = std::size_t(1) << scale;
+    std::vector<Edge> edges(rmat_iterator<minstd_rand, Graph>(gen, n, 8 * n, 0.57, 0.19, 0.19, 0.05),
+                            rmat_iterator<minstd_rand, Graph>());
+    uniform_int<unsigned> random_weight(0, 1000);
+    std::vector<unsigned> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = random_weight(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    run_queries(g, get(edge_bundle, g), "Directed R-MAT", num_queries, gen);
+
+    // Same source and target
+    std::vector<std::size_t> path;
+    BOOST_TEST(bidirectional_dijkstra_shortest_path
+                 (g, 3, 3, std::back_inserter(path), weight_map(get(edge_bundle, g))) == 0);
+    BOOST_TEST(path.size() == 1 && path[0] == 3);
+  }
+
+  // Interior edge weights, and a negative weight
+  {
+    typedef adjacency_list<vecS, vecS, bidirectionalS, no_property,
+                           property<edge_weight_t, int> > Graph;
+    Graph g(4);
+    add_edge(0, 1, 2, g);
+    add_edge(1, 3, 2, g);
+    add_edge(0, 2, 1, g);
+    add_edge(2, 3, 4, g);
+    std::vector<std::size_t> path;
+    BOOST_TEST(bidirectional_dijkstra_shortest_path(g, 0, 3, std::back_inserter(path)) == 4);
+    BOOST_TEST(path.size() == 3 && path[0] == 0 && path[1] == 1 && path[2] == 3);
+    path.clear();
+    BOOST_TEST(bidirectional_dijkstra_shortest_path(g, 3, 0, std::back_inserter(path))
+               == (std::numeric_limits<int>::max)());
+    BOOST_TEST(path.empty());
+
+    add_edge(2, 1, -3, g);
+    bool thrown = false;
+    try {
+      bidirectional_dijkstra_shortest_path(g, 0, 3, std::back_inserter(path));
+    } catch (const negative_edge&) {
+      thrown = true;
+    }
+    BOOST_TEST(thrown);
+  }
+
+  return boost::report_errors();
+}
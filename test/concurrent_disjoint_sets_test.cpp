@@ -0,0 +1,169 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that concurrent_disjoint_sets ends with the sets of the sequential
+// disjoint_sets when several threads join them at once while others query
+// them, that the threaded incremental_components and component_index give
+// the components of connected_components, and compares the times of the
+// producer threads with those of threads sharing a disjoint_sets behind a
+// mutex.
+// Usage: concurrent_disjoint_sets_test [R-MAT scale [max threads]]
+
+#include <boost/graph/incremental_components.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+// Whether the sets of ds are the components in comp
+template <typename DisjointSets>
+bool same_partition(DisjointSets& ds, const std::vector<std::size_t>& comp)
+{
+  std::size_t n = comp.size();
+  // The first element of each component and set seen so far
+  std::vector<std::size_t> by_comp(n, n), by_root(n, n);
+  for (std::size_t v = 0; v < n; ++v) {
+    std::size_t r = ds.find_set(v);
+    if (by_comp[comp[v]] == n) by_comp[comp[v]] = v;
+    if (by_root[r] == n) by_root[r] = v;
+    if (by_comp[comp[v]] != by_root[r]) return false;
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 20;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+
+  std::size_t n = std::size_t(1) << scale;
+  typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+  std::vector<Edge> edges(RMATIter(gen, n, 2 * n, 0.57, 0.19, 0.19, 0.05),
+                          RMATIter());
+  std::size_t m = edges.size();
+  Graph g(edges.begin(), edges.end(), n);
+  std::vector<std::size_t> comp(n);
+  std::size_t num = connected_components(g, &comp[0]);
+  std::cout << "R-MAT graph: " << n << " vertices, " << m << " edges, "
+            << num << " components\n";
+
+  {
+    std::vector<std::size_t> rank(n), parent(n);
+    disjoint_sets<std::size_t*, std::size_t*> ds(&rank[0], &parent[0]);
+    initialize_incremental_components(g, ds);
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < m; ++i)
+      ds.union_set(edges[i].first, edges[i].second);
+    std::cout << "  disjoint_sets, sequential: " << seconds_since(start)
+              << " s\n";
+    BOOST_TEST(same_partition(ds, comp));
+  }
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    // Each producer joins the sets of every threads-th edge, behind a
+    // mutex, then without one while as many threads query the sets
+    std::vector<std::size_t> rank(n), parent(n);
+    disjoint_sets<std::size_t*, std::size_t*> locked(&rank[0], &parent[0]);
+    initialize_incremental_components(g, locked);
+    std::mutex mutex;
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    graph::detail::run_in_parallel(threads, [&](std::size_t t) {
+      for (std::size_t i = t; i < m; i += threads) {
+        std::lock_guard<std::mutex> lock(mutex);
+        locked.union_set(edges[i].first, edges[i].second);
+      }
+    });
+    double locked_time = seconds_since(start);
+    BOOST_TEST(same_partition(locked, comp));
+
+    concurrent_disjoint_sets<std::size_t> ds(n);
+    std::atomic<std::size_t> producers(threads), wrong(0);
+    start = std::chrono::steady_clock::now();
+    graph::detail::run_in_parallel(2 * threads, [&](std::size_t t) {
+      if (t < threads) {
+        for (std::size_t i = t; i < m; i += threads)
+          ds.union_set(edges[i].first, edges[i].second);
+        --producers;
+      } else {
+        // Vertices of different components are never in the same set
+        minstd_rand local(t);
+        while (producers.load() > 0) {
+          std::size_t u = local() % n, v = local() % n;
+          if (ds.same_set(u, v) && comp[u] != comp[v]) ++wrong;
+        }
+      }
+    });
+    double time = seconds_since(start);
+    std::cout << "  " << threads << " producer threads, locked "
+              << "disjoint_sets: " << locked_time
+              << " s, concurrent_disjoint_sets: " << time << " s\n";
+    BOOST_TEST_EQ(wrong.load(), 0u);
+    BOOST_TEST(same_partition(ds, comp));
+    for (std::size_t i = 0; i < m; ++i)
+      BOOST_TEST(same_component(edges[i].first, edges[i].second, ds));
+  }
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    concurrent_disjoint_sets<std::size_t> ds(n);
+    initialize_incremental_components(g, ds);
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    incremental_components(g, ds, threads);
+    double time = seconds_since(start);
+    BOOST_TEST(same_partition(ds, comp));
+
+    start = std::chrono::steady_clock::now();
+    component_index<std::size_t> index(ds, threads);
+    double index_time = seconds_since(start);
+    std::cout << "  incremental_components, " << threads << " threads: "
+              << time << " s, component_index: " << index_time << " s\n";
+    BOOST_TEST_EQ(index.size(), num);
+    // The components come in the order of their roots, each element once
+    std::vector<std::size_t> seen(n, 0);
+    std::size_t previous_root = 0;
+    for (std::size_t c = 0; c < index.size(); ++c) {
+      component_index<std::size_t>::component_iterator ci = index[c].first,
+        ci_end = index[c].second;
+      BOOST_TEST(ci != ci_end);
+      std::size_t root = *ci;
+      BOOST_TEST(c == 0 || root > previous_root);
+      previous_root = root;
+      for (; ci != ci_end; ++ci) {
+        ++seen[*ci];
+        BOOST_TEST_EQ(comp[*ci], comp[root]);
+      }
+    }
+    BOOST_TEST_EQ(std::size_t(std::count(seen.begin(), seen.end(), 1u)), n);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,180 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Builds contraction hierarchies of a road-like grid and of a sparse
+// directed random graph, checks random queries against
+// dijkstra_shortest_paths, and reports the preprocessing time, the number
+// of shortcuts and the query latency percentiles, next to those of
+// bidirectional_dijkstra_shortest_path.
+// Usage: contraction_hierarchy_test [grid side [random graph vertices [queries]]]
+
+#include <boost/graph/contraction_hierarchy.hpp>
+#include <boost/graph/bidirectional_dijkstra_shortest_path.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <iostream>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS, no_property, unsigned> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::pair<std::size_t, std::size_t> Edge;
+typedef contraction_hierarchy<Graph, property_map<Graph, edge_bundle_t>::const_type,
+                              property_map<Graph, vertex_index_t>::const_type>
+  Hierarchy;
+
+void print_percentiles(const char* name, std::vector<double> times)
+{
+  std::sort(times.begin(), times.end());
+  std::size_t n = times.size();
+  std::cout << "  " << name << ": median " << times[n / 2] * 1e6
+            << " us, 90th percentile " << times[n * 9 / 10] * 1e6
+            << " us, 99th percentile " << times[n * 99 / 100] * 1e6
+            << " us\n";
+}
+
+void test_hierarchy(const Graph& g, const char* name, std::size_t num_queries,
+                    minstd_rand& gen)
+{
+  const unsigned inf = (std::numeric_limits<unsigned>::max)();
+  timer timer;
+  Hierarchy ch(g, get(edge_bundle, g), get(vertex_index, g));
+  std::cout << name << ": " << num_vertices(g) << " vertices, "
+            << num_edges(g) << " edges\n  preprocessing "
+            << timer.elapsed() << " s, " << ch.num_shortcuts()
+            << " shortcuts\n";
+  BOOST_TEST(num_edges(ch.upward_graph()) + num_edges(ch.downward_graph())
+             <= num_edges(g) + ch.num_shortcuts());
+
+  std::vector<unsigned> distance(num_vertices(g));
+  std::vector<double> ch_times, bidirectional_times;
+  uniform_int<std::size_t> random_vertex(0, num_vertices(g) - 1);
+  for (std::size_t q = 0; q < num_queries; ++q) {
+    Vertex s = Vertex(random_vertex(gen)), t = Vertex(random_vertex(gen));
+    dijkstra_shortest_paths
+      (g, s, weight_map(get(edge_bundle, g))
+               .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g))));
+
+    std::vector<Vertex> path;
+    timer.restart();
+    unsigned d = ch.shortest_path(s, t, std::back_inserter(path));
+    ch_times.push_back(timer.elapsed());
+    BOOST_TEST(d == distance[t]);
+    BOOST_TEST(ch.distance(s, t) == d);
+
+    std::vector<Vertex> bidirectional_path;
+    timer.restart();
+    bidirectional_dijkstra_shortest_path(g, s, t,
+                                         std::back_inserter(bidirectional_path),
+                                         weight_map(get(edge_bundle, g)));
+    bidirectional_times.push_back(timer.elapsed());
+
+    if (d == inf) {
+      BOOST_TEST(path.empty());
+      continue;
+    }
+    // The unpacked path uses edges of g whose weights add up to d
+    BOOST_TEST(!path.empty() && path.front() == s && path.back() == t);
+    unsigned length = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+      unsigned best = inf;
+      graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(path[i], g); ei != ei_end; ++ei)
+        if (target(*ei, g) == path[i + 1]) best = (std::min)(best, g[*ei]);
+      BOOST_TEST(best != inf);
+      length += best;
+    }
+    BOOST_TEST(length == d);
+  }
+  print_percentiles("contraction hierarchy queries", ch_times);
+  print_percentiles("bidirectional Dijkstra queries", bidirectional_times);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 100;
+  std::size_t n = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 5000;
+  std::size_t num_queries = argc > 3 ? lexical_cast<std::size_t>(argv[3]) : 200;
+  minstd_rand gen(1);
+
+  // Road-like grid with integer travel times and a few one-way streets
+  {
+    std::vector<Edge> edges;
+    for (std::size_t i = 0; i < side; ++i)
+      for (std::size_t j = 0; j < side; ++j) {
+        std::size_t v = i * side + j;
+        if (j + 1 < side) {
+          edges.push_back(Edge(v, v + 1));
+          if ((v * 7) % 10 != 0) edges.push_back(Edge(v + 1, v));
+        }
+        if (i + 1 < side) {
+          edges.push_back(Edge(v + side, v));
+          if ((v * 3) % 10 != 0) edges.push_back(Edge(v, v + side));
+        }
+      }
+    uniform_int<unsigned> travel_time(1, 100);
+    std::vector<unsigned> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = travel_time(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), side * side);
+    test_hierarchy(g, "Road-like grid", num_queries, gen);
+  }
+
+  // Sparse directed random graph, with parallel edges and self-loops, where
+  // some targets cannot be reached
+  {
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    std::vector<Edge> edges(ERIter(gen, n, 1.5 / n), ERIter());
+    uniform_int<unsigned> random_weight(0, 1000);
+    std::vector<unsigned> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = random_weight(gen);
+    edges.push_back(Edge(0, 1));
+    weights.push_back(5);
+    edges.push_back(Edge(0, 1));
+    weights.push_back(3);
+    edges.push_back(Edge(2, 2));
+    weights.push_back(1);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    test_hierarchy(g, "Directed random graph", num_queries, gen);
+  }
+
+  // Undirected graph with the default weight and index maps
+  {
+    typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                           property<edge_weight_t, double> > UGraph;
+    UGraph g(5);
+    add_edge(0, 1, 1.5, g);
+    add_edge(1, 2, 1.0, g);
+    add_edge(0, 2, 3.0, g);
+    add_edge(2, 3, 0.5, g);
+    contraction_hierarchy<UGraph> ch(g);
+    std::vector<std::size_t> path;
+    BOOST_TEST(ch.shortest_path(3, 0, std::back_inserter(path)) == 3.0);
+    BOOST_TEST(path.size() == 4 && path[0] == 3 && path[1] == 2
+               && path[2] == 1 && path[3] == 0);
+    path.clear();
+    BOOST_TEST(ch.shortest_path(1, 1, std::back_inserter(path)) == 0.0);
+    BOOST_TEST(path.size() == 1 && path[0] == 1);
+    BOOST_TEST(ch.distance(0, 4) == (std::numeric_limits<double>::max)());
+  }
+
+  return boost::report_errors();
+}
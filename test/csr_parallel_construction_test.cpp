@@ -0,0 +1,117 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that building a compressed_sparse_row_graph with
+// edges_are_unsorted_parallel gives exactly the graph built serially with
+// edges_are_unsorted_multi_pass, and reports how construction time scales with
+// the number of threads.  Usage: csr_parallel_construction_test [scale
+// [edge factor [max threads]]]
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef compressed_sparse_row_graph<directedS, no_property, int> WeightedGraph;
+typedef compressed_sparse_row_graph<bidirectionalS, no_property, int>
+  BidirGraph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+template <typename G>
+bool same_structure(const G& a, const G& b)
+{
+  return a.m_forward.m_rowstart == b.m_forward.m_rowstart
+      && a.m_forward.m_column == b.m_forward.m_column;
+}
+
+int main(int argc, char* argv[])
+{
+  int scale = argc > 1 ? lexical_cast<int>(argv[1]) : 16;
+  std::size_t edge_factor = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 16;
+  std::size_t max_threads = argc > 3 ? lexical_cast<std::size_t>(argv[3])
+                          : (std::max)(4u, std::thread::hardware_concurrency());
+
+  std::size_t n = std::size_t(1) << scale;
+  std::size_t m = edge_factor * n;
+  minstd_rand gen(1);
+  std::vector<Edge> edge_list(rmat_iterator<minstd_rand, Graph>(gen, n, m, 0.57, 0.19, 0.19, 0.05),
+                              rmat_iterator<minstd_rand, Graph>());
+  std::vector<int> weights(edge_list.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+    weights[i] = int(i);
+  std::cout << n << " vertices, " << edge_list.size() << " edges.\n";
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  Graph serial(edges_are_unsorted_multi_pass, edge_list.begin(),
+               edge_list.end(), n);
+  double serial_time = seconds_since(start);
+  std::cout << "Serial construction: " << serial_time << " seconds.\n";
+
+  WeightedGraph serial_weighted(edges_are_unsorted_multi_pass,
+                                edge_list.begin(), edge_list.end(),
+                                weights.begin(), n);
+  BidirGraph serial_bidir(edges_are_unsorted_multi_pass, edge_list.begin(),
+                          edge_list.end(), weights.begin(), n);
+
+  for (std::size_t t = 1; t <= max_threads; t *= 2) {
+    start = std::chrono::steady_clock::now();
+    Graph g(edges_are_unsorted_parallel, edge_list.begin(), edge_list.end(),
+            n, t);
+    double time = seconds_since(start);
+    std::cout << t << " thread(s): " << time << " seconds, speedup = "
+              << serial_time / time << ".\n";
+    BOOST_TEST(same_structure(g, serial));
+
+    WeightedGraph gw(edges_are_unsorted_parallel, edge_list.begin(),
+                     edge_list.end(), weights.begin(), n, t);
+    BOOST_TEST(same_structure(gw, serial_weighted));
+    BOOST_TEST(gw.m_forward.m_edge_properties
+               == serial_weighted.m_forward.m_edge_properties);
+
+    BidirGraph gb(edges_are_unsorted_parallel, edge_list.begin(),
+                  edge_list.end(), weights.begin(), n, t);
+    BOOST_TEST(same_structure(gb, serial_bidir));
+    BOOST_TEST(gb.m_forward.m_edge_properties
+               == serial_bidir.m_forward.m_edge_properties);
+    BOOST_TEST(gb.m_backward.m_rowstart == serial_bidir.m_backward.m_rowstart);
+    BOOST_TEST(gb.m_backward.m_column == serial_bidir.m_backward.m_column);
+    BOOST_TEST(gb.m_backward.m_edge_properties
+               == serial_bidir.m_backward.m_edge_properties);
+  }
+
+  // Degenerate inputs: no edges, and more threads than edges
+  std::vector<Edge> few_edges;
+  Graph empty(edges_are_unsorted_parallel, few_edges.begin(), few_edges.end(),
+              10, 4);
+  BOOST_TEST(num_vertices(empty) == 10);
+  BOOST_TEST(num_edges(empty) == 0);
+  few_edges.push_back(Edge(3, 1));
+  few_edges.push_back(Edge(0, 2));
+  few_edges.push_back(Edge(3, 0));
+  Graph small(edges_are_unsorted_parallel, few_edges.begin(),
+              few_edges.end(), 4, 8);
+  Graph small_serial(edges_are_unsorted_multi_pass, few_edges.begin(),
+                     few_edges.end(), 4);
+  BOOST_TEST(same_structure(small, small_serial));
+
+  return boost::report_errors();
+}
@@ -0,0 +1,149 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that degeneracy_all_cliques visits the maximal cliques that
+// bron_kerbosch_all_cliques visits, for several minimum sizes, on small
+// random undirected and directed graphs, and compares their times on a
+// graph made of dense communities joined by sparse random edges.
+// Usage: degeneracy_all_cliques_test [community size [communities]]
+
+#include <boost/graph/degeneracy_all_cliques.hpp>
+#include <boost/graph/bron_kerbosch_all_cliques.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+using namespace boost;
+
+typedef std::vector<std::vector<std::size_t> > Cliques;
+
+// Records every clique visited, as a sorted vector of vertex indices
+struct clique_recorder
+{
+  explicit clique_recorder(Cliques& cliques) : cliques(cliques) {}
+
+  template <typename Clique, typename Graph>
+  void clique(const Clique& c, const Graph& g)
+  {
+    std::vector<std::size_t> k;
+    for (typename Clique::const_iterator i = c.begin(); i != c.end(); ++i)
+      k.push_back(get(vertex_index, g, *i));
+    std::sort(k.begin(), k.end());
+    cliques.push_back(k);
+  }
+
+  Cliques& cliques;
+};
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef adjacency_list<vecS, vecS, directedS> DiGraph;
+
+// The simple undirected graph whose edges join the vertices with arcs both
+// ways, on which bron_kerbosch_all_cliques gives the expected cliques (it
+// does not check both directions in all its tests on a directed graph)
+Graph mutual(const DiGraph& g)
+{
+  Graph m(num_vertices(g));
+  graph_traits<DiGraph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    std::size_t u = source(*ei, g), v = target(*ei, g);
+    if (u < v && edge(v, u, g).second && !edge(u, v, m).second)
+      add_edge(u, v, m);
+  }
+  return m;
+}
+
+Graph mutual(const Graph& g) { return g; }
+
+template <typename G>
+void check(const G& g, std::size_t min)
+{
+  Cliques expected, found;
+  bron_kerbosch_all_cliques(mutual(g), clique_recorder(expected), min);
+  degeneracy_all_cliques(g, clique_recorder(found), min);
+  std::sort(expected.begin(), expected.end());
+  std::sort(found.begin(), found.end());
+  BOOST_TEST(found == expected);
+}
+
+template <typename G>
+void check_random(minstd_rand& gen, std::size_t n, double p)
+{
+  typedef erdos_renyi_iterator<minstd_rand, G> ERIter;
+  G g(ERIter(gen, n, p, true), ERIter(), n);
+  for (std::size_t min = 1; min <= 4; ++min) check(g, min);
+  BOOST_TEST_EQ(degeneracy_clique_number(g),
+                bron_kerbosch_clique_number(mutual(g)));
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t size = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 40;
+  std::size_t communities = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 10;
+  minstd_rand gen(1);
+
+  for (int i = 0; i < 5; ++i) {
+    check_random<Graph>(gen, 30, 0.2);
+    check_random<Graph>(gen, 40, 0.5);
+    check_random<DiGraph>(gen, 30, 0.5);
+  }
+  {
+    // Isolated vertices, a self-loop and parallel edges
+    Graph g(5);
+    add_edge(0, 1, g);
+    add_edge(1, 0, g);
+    add_edge(1, 1, g);
+    add_edge(1, 2, g);
+    Cliques found;
+    degeneracy_all_cliques(g, clique_recorder(found), 1);
+    std::sort(found.begin(), found.end());
+    Cliques expected(4);
+    expected[0].push_back(0);
+    expected[0].push_back(1);
+    expected[1].push_back(1);
+    expected[1].push_back(2);
+    expected[2].push_back(3);
+    expected[3].push_back(4);
+    BOOST_TEST(found == expected);
+  }
+
+  // Dense communities, each with edge probability 0.7, joined by a few
+  // random edges
+  {
+    std::size_t n = size * communities;
+    Graph g(n);
+    for (std::size_t c = 0; c < communities; ++c)
+      for (std::size_t u = 0; u < size; ++u)
+        for (std::size_t v = u + 1; v < size; ++v)
+          if (gen() % 10 < 7) add_edge(c * size + u, c * size + v, g);
+    for (std::size_t i = 0; i < 2 * n; ++i)
+      add_edge(gen() % n, gen() % n, g);
+    std::cout << "Communities: " << n << " vertices, " << num_edges(g)
+              << " edges\n";
+
+    Cliques expected, found;
+    timer timer;
+    bron_kerbosch_all_cliques(g, clique_recorder(expected), 3);
+    double reference = timer.elapsed();
+    timer.restart();
+    degeneracy_all_cliques(g, clique_recorder(found), 3);
+    double time = timer.elapsed();
+    std::cout << "  " << found.size() << " maximal cliques\n"
+              << "  bron_kerbosch_all_cliques: " << reference
+              << " s, degeneracy_all_cliques: " << time << " s\n";
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+    BOOST_TEST(found == expected);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,194 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks delta_stepping_shortest_paths against
+// dijkstra_shortest_paths_no_color_map on road-like grid graphs and R-MAT
+// graphs, and compares their running times.  Usage:
+// delta_stepping_shortest_paths_test [grid side [R-MAT scale [max threads]]]
+
+#include <boost/graph/delta_stepping_shortest_paths.hpp>
+#include <boost/graph/dijkstra_shortest_paths_no_color_map.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+template <typename Graph, typename Weight>
+void check_paths(const Graph& g, std::size_t s, const char* name,
+                 std::size_t max_threads)
+{
+  typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+  std::size_t n = num_vertices(g);
+  std::vector<Weight> expected(n), distance(n);
+  std::vector<Vertex> pred(n);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  dijkstra_shortest_paths_no_color_map
+    (g, vertex(s, g), weight_map(get(edge_bundle, g))
+                      .distance_map(make_iterator_property_map(expected.begin(), get(vertex_index, g))));
+  double dijkstra_time = seconds_since(start);
+  std::cout << name << ": dijkstra_shortest_paths_no_color_map "
+            << dijkstra_time << " s.\n";
+
+  for (std::size_t t = 1; t <= max_threads; t *= 2) {
+    std::fill(distance.begin(), distance.end(), Weight(-1));
+    start = std::chrono::steady_clock::now();
+    delta_stepping_shortest_paths
+      (g, vertex(s, g), weight_map(get(edge_bundle, g))
+                        .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g)))
+                        .predecessor_map(make_iterator_property_map(pred.begin(), get(vertex_index, g)))
+                        .num_threads(t));
+    double time = seconds_since(start);
+    std::cout << "  " << t << " thread(s): " << time << " s, speedup = "
+              << dijkstra_time / time << ".\n";
+    BOOST_TEST(distance == expected);
+
+    // Predecessors form a shortest-path tree
+    BOOST_TEST(pred[s] == vertex(s, g));
+    for (std::size_t v = 0; v < n; ++v) {
+      if (v == s) continue;
+      if (distance[v] == (std::numeric_limits<Weight>::max)()) {
+        BOOST_TEST(pred[v] == vertex(v, g));
+      } else {
+        // Parallel edges are common in R-MAT graphs; one must be tight
+        bool tight = false;
+        typename graph_traits<Graph>::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(pred[v], g); ei != ei_end;
+             ++ei)
+          if (target(*ei, g) == vertex(v, g)
+              && distance[pred[v]] + g[*ei] == distance[v])
+            tight = true;
+        BOOST_TEST(tight);
+      }
+    }
+  }
+
+  // Very small and very large bucket widths
+  Weight deltas[] = {Weight(1), Weight(1000000)};
+  for (int i = 0; i < 2; ++i) {
+    delta_stepping_shortest_paths
+      (g, vertex(s, g), weight_map(get(edge_bundle, g))
+                        .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g)))
+                        .delta(deltas[i]).num_threads(2));
+    BOOST_TEST(distance == expected);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 500;
+  int scale = argc > 2 ? lexical_cast<int>(argv[2]) : 16;
+  std::size_t max_threads = argc > 3 ? lexical_cast<std::size_t>(argv[3])
+                          : (std::max)(4u, std::thread::hardware_concurrency());
+  minstd_rand gen(1);
+
+  // Road-like graph: a grid with integer travel times in both directions
+  {
+    typedef compressed_sparse_row_graph<directedS, no_property, int> Graph;
+    std::vector<Edge> edges;
+    for (std::size_t i = 0; i < side; ++i)
+      for (std::size_t j = 0; j < side; ++j) {
+        std::size_t v = i * side + j;
+        if (j + 1 < side) {
+          edges.push_back(Edge(v, v + 1));
+          edges.push_back(Edge(v + 1, v));
+        }
+        if (i + 1 < side) {
+          edges.push_back(Edge(v, v + side));
+          edges.push_back(Edge(v + side, v));
+        }
+      }
+    uniform_int<> travel_time(1, 100);
+    std::vector<int> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = travel_time(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), side * side);
+    check_paths<Graph, int>(g, 0, "Grid", max_threads);
+  }
+
+  // Scale-free graph with real weights
+  {
+    typedef compressed_sparse_row_graph<directedS, no_property, double> Graph;
+    std::size_t n = std::size_t(1) << scale;
+    std::vector<Edge> edges(rmat_iterator<minstd_rand, Graph>(gen, n, 16 * n, 0.57, 0.19, 0.19, 0.05),
+                            rmat_iterator<minstd_rand, Graph>());
+    uniform_real<> weight(0, 1);
+    std::vector<double> weights(edges.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+      weights[i] = weight(gen);
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    std::size_t s = 0;
+    for (std::size_t v = 0; v < n; ++v)
+      if (out_degree(v, g) > out_degree(s, g)) s = v;
+    check_paths<Graph, double>(g, s, "R-MAT", max_threads);
+  }
+
+  // Skewed weights: a few edges are so heavy that a bucket ring covering
+  // them at delta = 1 would take gigabytes, so the far buckets overflow
+  {
+    typedef compressed_sparse_row_graph<directedS, no_property, int> Graph;
+    std::size_t n = 10000;
+    std::vector<Edge> edges;
+    std::vector<int> weights;
+    uniform_int<> light(1, 20);
+    for (std::size_t v = 0; v < n; ++v)
+      for (int k = 0; k < 4; ++k) {
+        edges.push_back(Edge(v, gen() % n));
+        weights.push_back(gen() % 50 == 0 ? 100000000 : light(gen));
+      }
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    check_paths<Graph, int>(g, 0, "Skewed weights", max_threads);
+  }
+
+  // Zero weights, including a zero-weight cycle
+  {
+    typedef compressed_sparse_row_graph<directedS, no_property, int> Graph;
+    Edge edges[] = {Edge(0, 1), Edge(1, 2), Edge(2, 1), Edge(2, 3),
+                    Edge(0, 3), Edge(4, 0)};
+    int weights[] = {5, 0, 0, 0, 7, 1};
+    Graph g(edges_are_unsorted_multi_pass, edges, edges + 6, weights, 5);
+    check_paths<Graph, int>(g, 0, "Zero weights", 4);
+  }
+
+  // Negative weights are refused
+  {
+    typedef compressed_sparse_row_graph<directedS, no_property, int> Graph;
+    Edge edges[] = {Edge(0, 1), Edge(1, 2)};
+    int weights[] = {1, -1};
+    Graph g(edges_are_unsorted_multi_pass, edges, edges + 2, weights, 3);
+    bool threw = false;
+    try {
+      delta_stepping_shortest_paths(g, 0, weight_map(get(edge_bundle, g)));
+    } catch (const negative_edge&) {
+      threw = true;
+    }
+    BOOST_TEST(threw);
+  }
+
+  return boost::report_errors();
+}
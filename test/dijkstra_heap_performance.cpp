@@ -12,6 +12,8 @@
 
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/dijkstra_shortest_paths_no_color_map.hpp>
+#include <boost/graph/prim_minimum_spanning_tree.hpp>
+#include <boost/graph/astar_search.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/random/linear_congruential.hpp>
 #include <boost/lexical_cast.hpp>
@@ -81,6 +83,108 @@ void run_test(const Graph& g, const char* name, Kind kind,
 }
 #endif
 
+// Run Dijkstra's algorithm from vertex 0 with the queue Q, which is keyed on
+// distance
+template<typename Graph, typename DistanceMap, typename Queue>
+void run_with_queue(const Graph& g, DistanceMap distance, Queue& Q)
+{
+  typedef typename property_traits<DistanceMap>::value_type D;
+  typename graph_traits<Graph>::vertex_descriptor s = vertex(0, g);
+  typename graph_traits<Graph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+    put(distance, *vi, (std::numeric_limits<D>::max)());
+  put(distance, s, D(0));
+  two_bit_color_map<> color(num_vertices(g));
+  dijkstra_shortest_paths_no_init(g, &s, &s + 1, dummy_property_map(),
+                                  distance, get(edge_weight, g),
+                                  get(vertex_index, g), std::less<D>(),
+                                  closed_plus<D>(), D(0),
+                                  make_dijkstra_visitor(null_visitor()),
+                                  color, Q);
+}
+
+// Compare the priority queues on integer weights: the d-ary heap, the radix
+// heap that is selected by default for unsigned distances, and the Dial
+// queue
+typedef adjacency_list<vecS, vecS, directedS, no_property,
+                       property<edge_weight_t, unsigned> > IntGraph;
+
+struct zero_heuristic : astar_heuristic<IntGraph, unsigned>
+{
+  unsigned operator()(graph_traits<IntGraph>::vertex_descriptor) const
+  { return 0; }
+};
+
+void compare_integer_queues(const IntGraph& g, unsigned max_weight)
+{
+  typedef graph_traits<IntGraph>::vertex_descriptor Vertex;
+  typedef iterator_property_map<std::vector<unsigned>::iterator,
+                                property_map<IntGraph, vertex_index_t>::const_type>
+    DistanceMap;
+  typedef iterator_property_map<std::vector<std::size_t>::iterator,
+                                property_map<IntGraph, vertex_index_t>::const_type>
+    IndexInHeapMap;
+  std::size_t n = num_vertices(g);
+  std::vector<unsigned> d_ary_distances(n), radix_distances(n),
+    dial_distances(n), no_color_map_distances(n), astar_distances(n),
+    astar_costs(n);
+  std::vector<std::size_t> index_in_heap(n);
+  DistanceMap d_ary_map(d_ary_distances.begin(), get(vertex_index, g));
+  IndexInHeapMap index_in_heap_map(index_in_heap.begin(), get(vertex_index, g));
+
+  std::cout << "Running Dijkstra's on integer weights with d-ary heap (d=4)...";
+  std::cout.flush();
+  timer t;
+  d_ary_heap_indirect<Vertex, 4, IndexInHeapMap, DistanceMap, std::less<unsigned> >
+    d_ary_queue(d_ary_map, index_in_heap_map);
+  run_with_queue(g, d_ary_map, d_ary_queue);
+  double d_ary_time = t.elapsed();
+  std::cout << d_ary_time << " seconds.\n";
+
+  std::cout << "Running Dijkstra's on integer weights with radix heap...";
+  std::cout.flush();
+  t.restart();
+  dijkstra_shortest_paths(g, vertex(0, g),
+                          distance_map(
+                            boost::make_iterator_property_map(
+                              radix_distances.begin(), get(boost::vertex_index, g))));
+  double radix_time = t.elapsed();
+  std::cout << radix_time << " seconds.\n"
+            << "Speedup = " << (d_ary_time / radix_time) << ".\n";
+  BOOST_TEST(d_ary_distances == radix_distances);
+
+  std::cout << "Running Dijkstra's on integer weights with Dial queue...";
+  std::cout.flush();
+  t.restart();
+  DistanceMap dial_map(dial_distances.begin(), get(vertex_index, g));
+  dial_queue_indirect<Vertex, IndexInHeapMap, DistanceMap>
+    dial_queue(dial_map, index_in_heap_map, max_weight);
+  run_with_queue(g, dial_map, dial_queue);
+  double dial_time = t.elapsed();
+  std::cout << dial_time << " seconds.\n"
+            << "Speedup = " << (d_ary_time / dial_time) << ".\n";
+  BOOST_TEST(d_ary_distances == dial_distances);
+
+  std::cout << "Running Dijkstra's (no color map) on integer weights with radix heap...";
+  std::cout.flush();
+  t.restart();
+  dijkstra_shortest_paths_no_color_map
+    (g, vertex(0, g),
+     distance_map(boost::make_iterator_property_map(
+                    no_color_map_distances.begin(), get(boost::vertex_index, g))));
+  double no_color_map_time = t.elapsed();
+  std::cout << no_color_map_time << " seconds.\n"
+            << "Speedup = " << (d_ary_time / no_color_map_time) << ".\n";
+  BOOST_TEST(d_ary_distances == no_color_map_distances);
+
+  astar_search(g, vertex(0, g), zero_heuristic(),
+               distance_map(boost::make_iterator_property_map(
+                              astar_distances.begin(), get(boost::vertex_index, g))).
+               rank_map(boost::make_iterator_property_map(
+                          astar_costs.begin(), get(boost::vertex_index, g))));
+  BOOST_TEST(d_ary_distances == astar_distances);
+}
+
 int main(int argc, char* argv[])
 {
   unsigned n = (argc > 1? lexical_cast<unsigned>(argv[1]) : 10000u);
@@ -162,6 +266,62 @@ int main(int argc, char* argv[])
   // Verify that the results are equivalent
   BOOST_TEST(binary_heap_distances == no_color_map_distances);
 
+  // Integer weights, including zero weights
+  const unsigned max_weight = 1000;
+  IntGraph ig(n);
+  uniform_int<unsigned> rand_weight(0, max_weight);
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    add_edge(source(*ei, g), target(*ei, g), rand_weight(gen), ig);
+  compare_integer_queues(ig, max_weight);
+
+  // Prim's algorithm selects the Dial queue for 16-bit weights
+  typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                         property<edge_weight_t, unsigned short> > UndirectedGraph;
+  typedef graph_traits<UndirectedGraph>::vertex_descriptor UVertex;
+  UndirectedGraph ug(n);
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+    add_edge(source(*ei, g), target(*ei, g),
+             (unsigned short)rand_weight(gen), ug);
+  std::vector<UVertex> prim_pred(n), d_ary_pred(n);
+  std::vector<unsigned short> prim_weights(n), d_ary_weights(n);
+  std::vector<std::size_t> index_in_heap(n);
+
+  std::cout << "Running Prim's with d-ary heap (d=4)...";
+  std::cout.flush();
+  t.restart();
+  typedef iterator_property_map<std::vector<unsigned short>::iterator,
+                                property_map<UndirectedGraph, vertex_index_t>::const_type>
+    WeightMap;
+  typedef iterator_property_map<std::vector<std::size_t>::iterator,
+                                property_map<UndirectedGraph, vertex_index_t>::const_type>
+    IndexInHeapMap;
+  WeightMap d_ary_weight_map(d_ary_weights.begin(), get(vertex_index, ug));
+  d_ary_heap_indirect<UVertex, 4, IndexInHeapMap, WeightMap, std::less<unsigned short> >
+    prim_queue(d_ary_weight_map,
+               IndexInHeapMap(index_in_heap.begin(), get(vertex_index, ug)));
+  prim_minimum_spanning_tree(ug, vertex(0, ug),
+                             make_iterator_property_map(d_ary_pred.begin(), get(vertex_index, ug)),
+                             d_ary_weight_map, get(edge_weight, ug),
+                             get(vertex_index, ug),
+                             make_dijkstra_visitor(null_visitor()), prim_queue);
+  double prim_d_ary_time = t.elapsed();
+  std::cout << prim_d_ary_time << " seconds.\n";
+
+  std::cout << "Running Prim's with Dial queue...";
+  std::cout.flush();
+  t.restart();
+  prim_minimum_spanning_tree(ug, make_iterator_property_map(prim_pred.begin(), get(vertex_index, ug)),
+                             distance_map(make_iterator_property_map(prim_weights.begin(), get(vertex_index, ug))));
+  double prim_dial_time = t.elapsed();
+  std::cout << prim_dial_time << " seconds.\n"
+            << "Speedup = " << (prim_d_ary_time / prim_dial_time) << ".\n";
+  unsigned long prim_total = 0, d_ary_total = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (prim_pred[i] != i) prim_total += prim_weights[i];
+    if (d_ary_pred[i] != i) d_ary_total += d_ary_weights[i];
+  }
+  BOOST_TEST(prim_total == d_ary_total);
+
 #ifdef BOOST_GRAPH_DIJKSTRA_TESTING_DIETMAR
   run_test(g, "d-ary heap (d=2)", dijkstra_d_heap_2, binary_heap_distances);
   run_test(g, "d-ary heap (d=3)", dijkstra_d_heap_3, binary_heap_distances);
@@ -0,0 +1,126 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks direction_optimizing_bfs against breadth_first_search on
+// Graph500-style R-MAT graphs and compares their running times.
+// Usage: direction_optimizing_bfs_test [scale [edge factor]]
+
+#include <boost/graph/direction_optimizing_bfs.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static const std::size_t unreached = (std::numeric_limits<std::size_t>::max)();
+
+// Compare with breadth_first_search from s: the distances must be equal and
+// every predecessor must be an in-neighbor one level closer to s.
+template <typename G>
+void check_bfs(const G& g, std::size_t s, double& bfs_time, double& do_time)
+{
+  typedef typename graph_traits<G>::vertex_descriptor Vertex;
+  std::size_t n = num_vertices(g);
+  std::vector<std::size_t> expected(n, unreached), distance(n, unreached);
+  std::vector<Vertex> pred(n);
+  Vertex start = vertex(s, g);
+
+  timer t;
+  expected[s] = 0;
+  breadth_first_search(g, start, visitor(make_bfs_visitor(
+    record_distances(make_iterator_property_map(expected.begin(),
+                                                get(vertex_index, g)),
+                     on_tree_edge()))));
+  bfs_time += t.elapsed();
+
+  t.restart();
+  direction_optimizing_bfs
+    (g, start,
+     make_iterator_property_map(distance.begin(), get(vertex_index, g)),
+     make_iterator_property_map(pred.begin(), get(vertex_index, g)));
+  do_time += t.elapsed();
+
+  BOOST_TEST(distance == expected);
+  BOOST_TEST(pred[s] == start);
+  typename graph_traits<G>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+    std::size_t v = get(vertex_index, g, *vi);
+    if (v == s || distance[v] == unreached) continue;
+    std::size_t p = get(vertex_index, g, pred[v]);
+    BOOST_TEST(distance[p] + 1 == distance[v]);
+    BOOST_TEST(edge(pred[v], *vi, g).second);
+  }
+}
+
+template <typename G>
+void run_sources(const G& g, const char* name, int num_sources)
+{
+  double bfs_time = 0, do_time = 0;
+  for (int i = 0; i < num_sources; ++i)
+    check_bfs(g, std::size_t(i) * num_vertices(g) / num_sources, bfs_time,
+              do_time);
+  std::cout << name << ": breadth_first_search " << bfs_time
+            << " s, direction_optimizing_bfs " << do_time << " s.\n";
+}
+
+int main(int argc, char* argv[])
+{
+  int scale = argc > 1 ? lexical_cast<int>(argv[1]) : 16;
+  std::size_t edge_factor = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 16;
+  std::size_t n = std::size_t(1) << scale;
+  minstd_rand gen(1);
+
+  // Graph500 parameters; the Graph500 benchmark symmetrizes the edges
+  std::vector<Edge> edge_list(rmat_iterator<minstd_rand, Graph>(gen, n, edge_factor * n, 0.57, 0.19, 0.19, 0.05),
+                              rmat_iterator<minstd_rand, Graph>());
+  Graph directed(edges_are_unsorted_multi_pass, edge_list.begin(),
+                 edge_list.end(), n);
+  std::size_t m = edge_list.size();
+  for (std::size_t i = 0; i < m; ++i)
+    edge_list.push_back(Edge(edge_list[i].second, edge_list[i].first));
+  Graph symmetric(edges_are_unsorted_multi_pass, edge_list.begin(),
+                  edge_list.end(), n);
+  std::cout << n << " vertices, " << m << " edges.\n";
+
+  run_sources(symmetric, "Symmetric R-MAT", 8);
+  run_sources(directed, "Directed R-MAT", 8);
+
+  // Undirected graphs, where in-edges and out-edges coincide
+  typedef adjacency_list<vecS, vecS, undirectedS> UndirectedGraph;
+  typedef erdos_renyi_iterator<minstd_rand, UndirectedGraph> ERGen;
+  UndirectedGraph ug(ERGen(gen, 1000, 0.005), ERGen(), 1000);
+  run_sources(ug, "Undirected Erdos-Renyi", 4);
+
+  // Lists of vertices, with a vertex index map
+  typedef adjacency_list<listS, listS, bidirectionalS,
+                         property<vertex_index_t, std::size_t> > ListGraph;
+  ListGraph lg(ERGen(gen, 200, 0.02), ERGen(), 200);
+  std::size_t i = 0;
+  graph_traits<ListGraph>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(lg); vi != vi_end; ++vi)
+    put(vertex_index, lg, *vi, i++);
+  run_sources(lg, "Directed Erdos-Renyi (listS)", 2);
+
+  // A single vertex
+  Graph single(std::size_t(1));
+  double ignored = 0;
+  check_bfs(single, 0, ignored, ignored);
+
+  return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks exact_diameter and exact_radius against the eccentricities of all
+// the vertices on unweighted and weighted undirected random graphs, a path
+// and a disconnected graph, and reports the number of searches and the
+// running times.
+// Usage: exact_diameter_test [vertices]
+
+#include <boost/graph/eccentricity.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, int> > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+// The largest connected component of a sparse random graph
+Graph random_graph(std::size_t n, double degree, minstd_rand& gen)
+{
+  typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+  Graph g(ERIter(gen, n, degree / n), ERIter(), n);
+  std::vector<int> component(n);
+  int count = connected_components(g, &component[0]);
+  std::vector<std::size_t> sizes(count);
+  for (std::size_t v = 0; v < n; ++v) ++sizes[component[v]];
+  int largest = int(std::max_element(sizes.begin(), sizes.end())
+                    - sizes.begin());
+
+  std::vector<std::size_t> id(n);
+  std::size_t m = 0;
+  for (std::size_t v = 0; v < n; ++v)
+    if (component[v] == largest) id[v] = m++;
+  Graph h(m);
+  uniform_int<> random_weight(1, 10);
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    Vertex u = source(*ei, g), v = target(*ei, g);
+    if (component[u] == largest)
+      add_edge(id[u], id[v], random_weight(gen), h);
+  }
+  return h;
+}
+
+void test_unweighted(const Graph& g)
+{
+  timer timer;
+  std::vector<std::size_t> eccs(num_vertices(g));
+  std::pair<std::size_t, std::size_t> rd =
+    all_eccentricities_bfs(g, make_iterator_property_map(eccs.begin(), get(vertex_index, g)));
+  std::cout << "  all_eccentricities_bfs: " << timer.elapsed() << " s\n";
+
+  timer.restart();
+  std::size_t diameter_searches, radius_searches;
+  std::size_t diameter = exact_diameter(g, diameter_searches);
+  std::size_t radius = exact_radius(g, radius_searches);
+  std::cout << "  exact_diameter: " << diameter << " (" << diameter_searches
+            << " searches), exact_radius: " << radius << " ("
+            << radius_searches << " searches), " << timer.elapsed()
+            << " s\n";
+  BOOST_TEST_EQ(diameter, rd.second);
+  BOOST_TEST_EQ(radius, rd.first);
+  BOOST_TEST(diameter_searches <= num_vertices(g));
+  BOOST_TEST(radius_searches <= num_vertices(g));
+}
+
+void test_weighted(const Graph& g)
+{
+  timer timer;
+  std::size_t n = num_vertices(g);
+  std::vector<int> dist(n);
+  int radius = (std::numeric_limits<int>::max)(), diameter = 0;
+  for (std::size_t s = 0; s < n; ++s) {
+    dijkstra_shortest_paths(g, vertex(s, g), distance_map(&dist[0]));
+    int e = *std::max_element(dist.begin(), dist.end());
+    radius = (std::min)(radius, e);
+    diameter = (std::max)(diameter, e);
+  }
+  std::cout << "  Dijkstra from every vertex: " << timer.elapsed() << " s\n";
+
+  timer.restart();
+  std::size_t diameter_searches, radius_searches;
+  int exact_d = exact_diameter(g, diameter_searches,
+                               weight_map(get(edge_weight, g)));
+  int exact_r = exact_radius(g, radius_searches,
+                             weight_map(get(edge_weight, g)));
+  std::cout << "  exact_diameter: " << exact_d << " (" << diameter_searches
+            << " searches), exact_radius: " << exact_r << " ("
+            << radius_searches << " searches), " << timer.elapsed()
+            << " s\n";
+  BOOST_TEST_EQ(exact_d, diameter);
+  BOOST_TEST_EQ(exact_r, radius);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 5000;
+  minstd_rand gen(1);
+
+  for (int i = 0; i < 3; ++i) {
+    Graph g = random_graph(n, 1.5 + i, gen);
+    std::cout << "Random graph: " << num_vertices(g) << " vertices, "
+              << num_edges(g) << " edges\n";
+    test_unweighted(g);
+    test_weighted(g);
+  }
+
+  // A path of 11 vertices: diameter 10, radius 5
+  {
+    Graph path(11);
+    for (std::size_t v = 0; v < 10; ++v) add_edge(v, v + 1, 1, path);
+    std::size_t searches;
+    BOOST_TEST_EQ(exact_diameter(path, searches), 10u);
+    BOOST_TEST_EQ(exact_radius(path), 5u);
+  }
+
+  // Disconnected graphs have infinite eccentricities; an empty graph has
+  // no searches to run
+  {
+    Graph g(4);
+    add_edge(0, 1, 1, g);
+    add_edge(2, 3, 1, g);
+    std::size_t searches;
+    std::size_t inf = (std::numeric_limits<std::size_t>::max)();
+    BOOST_TEST_EQ(exact_diameter(g, searches), inf);
+    BOOST_TEST_EQ(searches, 1u);
+    BOOST_TEST_EQ(exact_radius(g), inf);
+    BOOST_TEST_EQ(exact_diameter(g, searches, weight_map(get(edge_weight, g))),
+                  (std::numeric_limits<int>::max)());
+    Graph empty;
+    BOOST_TEST_EQ(exact_diameter(empty, searches), 0u);
+    BOOST_TEST_EQ(searches, 0u);
+  }
+
+  return boost::report_errors();
+}
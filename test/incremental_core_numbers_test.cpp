@@ -0,0 +1,141 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that incremental_core_numbers keeps the core numbers of
+// core_numbers through random edge insertions and removals on an undirected
+// R-MAT graph, and compares the time of the updates with that of
+// recomputing the core numbers.
+// Usage: incremental_core_numbers_test [vertices [updates]]
+
+#include <boost/graph/incremental_core_numbers.hpp>
+#include <boost/graph/core_numbers.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+
+using namespace boost;
+
+typedef adjacency_list<setS, vecS, undirectedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef iterator_property_map<std::vector<std::size_t>::iterator,
+                              property_map<Graph, vertex_index_t>::type>
+  CoreMap;
+typedef adjacency_list<vecS, vecS, undirectedS> Multigraph;
+typedef iterator_property_map<std::vector<std::size_t>::iterator,
+                              property_map<Multigraph, vertex_index_t>::type>
+  MultiCoreMap;
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 2000;
+  std::size_t updates = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 2000;
+  minstd_rand gen(1);
+
+  typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+  Graph g(n);
+  for (RMATIter i(gen, n, 6 * n, 0.57, 0.19, 0.19, 0.05), end; i != end; ++i)
+    if (i->first != i->second) add_edge(i->first, i->second, g);
+  std::cout << n << " vertices, " << num_edges(g) << " edges\n";
+
+  std::vector<std::size_t> cores(n), expected(n);
+  CoreMap c(cores.begin(), get(vertex_index, g));
+  incremental_core_numbers<Graph, CoreMap> maintained(g, c);
+
+  // Adds random edges and removes edges at random vertices, in turn, and
+  // checks the core numbers after every update
+  double update_time = 0, recompute_time = 0;
+  std::size_t changed = 0, done = 0;
+  timer timer;
+  while (done < updates) {
+    Vertex u = gen() % n, v = gen() % n;
+    if (u == v) continue;
+    timer.restart();
+    if (done % 2 == 0) {
+      if (!add_edge(u, v, g).second) continue;
+      changed += maintained.edge_added(u, v);
+    } else {
+      if (out_degree(u, g) == 0) continue;
+      v = target(*out_edges(u, g).first, g);
+      remove_edge(u, v, g);
+      changed += maintained.edge_removed(u, v);
+    }
+    update_time += timer.elapsed();
+    ++done;
+
+    timer.restart();
+    core_numbers(g, make_iterator_property_map(expected.begin(),
+                                               get(vertex_index, g)));
+    recompute_time += timer.elapsed();
+    BOOST_TEST(cores == expected);
+  }
+  std::cout << "  " << updates << " updates changed " << changed
+            << " core numbers\n  incremental_core_numbers: " << update_time
+            << " s, core_numbers after each update: " << recompute_time
+            << " s\n";
+
+  // The same on a small multigraph, where most edges have parallel copies
+  {
+    std::size_t mn = 60;
+    Multigraph mg(mn);
+    for (std::size_t i = 0; i < 4 * mn; ++i) {
+      Vertex u = gen() % mn, v = gen() % (mn / 4);
+      if (u != v) add_edge(u, v, mg);
+    }
+    std::vector<std::size_t> mk(mn), mexpected(mn);
+    MultiCoreMap mc(mk.begin(), get(vertex_index, mg));
+    incremental_core_numbers<Multigraph, MultiCoreMap> m(mg, mc);
+    for (std::size_t i = 0; i < updates; ++i) {
+      Vertex u = gen() % mn, v = gen() % (mn / 4);
+      if (u == v) continue;
+      if (i % 2 == 0) {
+        add_edge(u, v, mg);
+        m.edge_added(u, v);
+      } else {
+        if (out_degree(u, mg) == 0) continue;
+        graph_traits<Multigraph>::edge_descriptor e = *out_edges(u, mg).first;
+        v = target(e, mg);
+        remove_edge(e, mg);
+        m.edge_removed(u, v);
+      }
+      core_numbers(mg, make_iterator_property_map(mexpected.begin(),
+                                                  get(vertex_index, mg)));
+      BOOST_TEST(mk == mexpected);
+    }
+  }
+
+  // A 4-clique and a triangle joined by an edge, built edge by edge, then
+  // taken apart
+  {
+    Graph small(7);
+    std::vector<std::size_t> k(7);
+    CoreMap kc(k.begin(), get(vertex_index, small));
+    incremental_core_numbers<Graph, CoreMap> m(small, kc);
+    std::size_t edges[][2] = {{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3},
+                              {3, 4}, {4, 5}, {5, 6}, {4, 6}};
+    for (int i = 0; i < 10; ++i) {
+      add_edge(edges[i][0], edges[i][1], small);
+      m.edge_added(edges[i][0], edges[i][1]);
+    }
+    std::size_t expected_k[] = {3, 3, 3, 3, 2, 2, 2};
+    BOOST_TEST(k == std::vector<std::size_t>(expected_k, expected_k + 7));
+    remove_edge(0, 1, small);
+    BOOST_TEST_EQ(m.edge_removed(0, 1), 4u);
+    for (int i = 0; i < 4; ++i) BOOST_TEST_EQ(k[i], 2u);
+    for (int i = 9; i >= 1; --i) {
+      remove_edge(edges[i][0], edges[i][1], small);
+      m.edge_removed(edges[i][0], edges[i][1]);
+    }
+    BOOST_TEST(k == std::vector<std::size_t>(7, 0));
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,223 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Round-trips a compressed_sparse_row_graph through the binary CSR graph file
+// format and checks that the mapped graph has the same structure and
+// properties, and gives the same results in graph algorithms, and that
+// corrupt files are refused.
+
+#include <boost/graph/mapped_csr_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <fstream>
+#include <vector>
+#include <string>
+
+using namespace boost;
+
+struct City
+{
+  int population;
+  float latitude;
+};
+
+struct Road
+{
+  double length;
+  int lanes;
+};
+
+typedef compressed_sparse_row_graph<directedS, City, Road> Graph;
+typedef mapped_csr_graph<City, Road> MappedGraph;
+typedef compressed_sparse_row_graph<directedS> PlainGraph;
+typedef mapped_csr_graph<> MappedPlainGraph;
+
+template <typename G1, typename G2>
+void check_same_structure(const G1& g1, const G2& g2)
+{
+  BOOST_TEST(num_vertices(g1) == num_vertices(g2));
+  BOOST_TEST(num_edges(g1) == num_edges(g2));
+  typename graph_traits<G1>::vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = vertices(g1); vi != vi_end; ++vi) {
+    BOOST_TEST(out_degree(*vi, g1) == out_degree(*vi, g2));
+    typename graph_traits<G1>::out_edge_iterator e1, e1_end;
+    typename graph_traits<G2>::out_edge_iterator e2, e2_end;
+    boost::tie(e1, e1_end) = out_edges(*vi, g1);
+    boost::tie(e2, e2_end) = out_edges(*vi, g2);
+    for (; e1 != e1_end && e2 != e2_end; ++e1, ++e2) {
+      BOOST_TEST(target(*e1, g1) == target(*e2, g2));
+      BOOST_TEST(get(edge_index, g1, *e1) == get(edge_index, g2, *e2));
+    }
+    BOOST_TEST(e1 == e1_end && e2 == e2_end);
+  }
+  std::size_t count = 0;
+  typename graph_traits<G2>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g2); ei != ei_end; ++ei, ++count)
+    BOOST_TEST(get(edge_index, g2, *ei) == count);
+  BOOST_TEST(count == num_edges(g2));
+}
+
+int main()
+{
+  BOOST_CONCEPT_ASSERT((IncidenceGraphConcept<MappedGraph>));
+  BOOST_CONCEPT_ASSERT((AdjacencyGraphConcept<MappedGraph>));
+  BOOST_CONCEPT_ASSERT((VertexListGraphConcept<MappedGraph>));
+  BOOST_CONCEPT_ASSERT((EdgeListGraphConcept<MappedGraph>));
+
+  typedef erdos_renyi_iterator<minstd_rand, PlainGraph> ERGen;
+  minstd_rand gen(42);
+  const std::size_t n = 1000;
+  std::vector<std::pair<std::size_t, std::size_t> >
+    edge_list(ERGen(gen, n, 0.01), ERGen());
+  std::vector<Road> roads(edge_list.size());
+  uniform_int<> length(1, 100);
+  for (std::size_t i = 0; i < roads.size(); ++i) {
+    roads[i].length = length(gen);
+    roads[i].lanes = int(i % 4) + 1;
+  }
+  Graph g(edges_are_unsorted_multi_pass, edge_list.begin(), edge_list.end(),
+          roads.begin(), n);
+  for (std::size_t v = 0; v < n; ++v) {
+    g[v].population = int(v * 7);
+    g[v].latitude = float(v) / 10;
+  }
+
+  const std::string filename = "mapped_csr_graph_test.bin";
+  write_csr_graph_binary(filename, g);
+
+  {
+    MappedGraph mg(filename);
+    check_same_structure(g, mg);
+    for (std::size_t v = 0; v < n; ++v) {
+      BOOST_TEST(mg[v].population == g[v].population);
+      BOOST_TEST(get(&City::latitude, mg, v) == g[v].latitude);
+      BOOST_TEST(get(vertex_bundle, mg)[v].population == g[v].population);
+    }
+    graph_traits<Graph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+      BOOST_TEST(mg[*ei].lanes == g[*ei].lanes);
+      BOOST_TEST(get(&Road::length, mg, *ei) == g[*ei].length);
+    }
+
+    // Same shortest paths from the file as from the original graph
+    std::vector<double> d1(n), d2(n);
+    dijkstra_shortest_paths(g, 0, weight_map(get(&Road::length, g))
+                                  .distance_map(make_iterator_property_map(d1.begin(), get(vertex_index, g))));
+    dijkstra_shortest_paths(mg, 0, weight_map(get(&Road::length, mg))
+                                   .distance_map(make_iterator_property_map(d2.begin(), get(vertex_index, mg))));
+    BOOST_TEST(d1 == d2);
+
+    // Copies share the mapping
+    MappedGraph copy(mg);
+    mg = MappedGraph();
+    BOOST_TEST(num_vertices(mg) == 0);
+    BOOST_TEST(num_edges(copy) == num_edges(g));
+    std::vector<std::size_t> levels(n, 0);
+    breadth_first_search(copy, 0, visitor(make_bfs_visitor(
+      record_distances(make_iterator_property_map(levels.begin(), get(vertex_index, copy)),
+                       on_tree_edge()))));
+  }
+
+  // Graphs without properties
+  PlainGraph pg(edges_are_unsorted_multi_pass, edge_list.begin(),
+                edge_list.end(), n);
+  write_csr_graph_binary(filename, pg);
+  {
+    MappedPlainGraph mpg(filename);
+    check_same_structure(pg, mpg);
+
+    // Reading with the wrong property types is refused
+    bool threw = false;
+    try {
+      MappedGraph wrong(filename);
+    } catch (const bad_csr_graph_file&) {
+      threw = true;
+    }
+    BOOST_TEST(threw);
+  }
+
+  // A corrupt file maps, but does not validate
+  {
+    std::ifstream in(filename.c_str(), std::ios_base::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)),
+                            std::istreambuf_iterator<char>());
+    // 64-byte aligned copy
+    std::vector<boost::uint64_t>
+      aligned((std::max)(bytes.size(), std::size_t(4096)) / 8 + 16);
+    char* data = reinterpret_cast<char*>(&aligned[0]);
+    data += (64 - reinterpret_cast<std::size_t>(data) % 64) % 64;
+    std::memcpy(data, &bytes[0], bytes.size());
+    detail::csr_file_header h;
+    std::memcpy(&h, data, sizeof(h));
+
+    MappedPlainGraph sound(data, bytes.size());
+    sound.validate();
+
+    std::size_t* column = reinterpret_cast<std::size_t*>(data + h.column_offset);
+    column[num_edges(pg) / 2] = n + 5;
+    bool threw = false;
+    try {
+      MappedPlainGraph bad_target(data, bytes.size());
+      bad_target.validate();
+    } catch (const bad_csr_graph_file&) {
+      threw = true;
+    }
+    BOOST_TEST(threw);
+
+    std::memcpy(data, &bytes[0], bytes.size());
+    std::size_t* rowstart = reinterpret_cast<std::size_t*>(data + h.rowstart_offset);
+    rowstart[n / 2] = rowstart[n / 2 + 1] + 1;
+    threw = false;
+    try {
+      MappedPlainGraph bad_rows(data, bytes.size());
+      bad_rows.validate();
+    } catch (const bad_csr_graph_file&) {
+      threw = true;
+    }
+    BOOST_TEST(threw);
+
+    // A header whose counts wrap the computed file size is refused
+    std::memset(data, 0, 4096);
+    h = detail::make_csr_file_header<std::size_t, std::size_t,
+                                     no_property, no_property>
+          (boost::uint64_t(1) << 61, 0);
+    std::memcpy(data, &h, sizeof(h));
+    threw = false;
+    try {
+      MappedPlainGraph wrapped(data, 4096);
+    } catch (const bad_csr_graph_file&) {
+      threw = true;
+    }
+    BOOST_TEST(threw);
+  }
+
+  // A truncated file is refused by the constructor
+  {
+    std::ofstream out(filename.c_str(), std::ios_base::binary);
+    out << "BGLCSR";
+  }
+  bool threw = false;
+  try {
+    MappedPlainGraph truncated(filename);
+  } catch (const bad_csr_graph_file&) {
+    threw = true;
+  }
+  BOOST_TEST(threw);
+
+  std::remove(filename.c_str());
+  return boost::report_errors();
+}
@@ -0,0 +1,193 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that filter_kruskal_minimum_spanning_tree and, for several thread
+// counts, parallel_boruvka_minimum_spanning_tree find spanning forests of
+// the weight of those of kruskal_minimum_spanning_tree, on a connected
+// R-MAT graph with real weights stored in a CSR graph and on a
+// disconnected adjacency_list with small integer weights, and compares
+// their times with those of Kruskal's and Prim's algorithms.
+// Usage: min_spanning_tree_test [R-MAT scale [max threads]]
+
+#include <boost/graph/filter_kruskal_min_spanning_tree.hpp>
+#include <boost/graph/parallel_boruvka_min_spanning_tree.hpp>
+#include <boost/graph/kruskal_min_spanning_tree.hpp>
+#include <boost/graph/prim_minimum_spanning_tree.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/pending/disjoint_sets.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS, no_property, double> Graph;
+typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                       property<edge_weight_t, int> > ListGraph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+// The sorted weights of the edges of tree, which must be a spanning forest
+// of g: one edge fewer than vertices per component, and no cycle
+template <typename G, typename WeightMap>
+std::vector<typename property_traits<WeightMap>::value_type>
+forest_weights(const G& g, WeightMap weight,
+               const std::vector<typename graph_traits<G>::edge_descriptor>&
+                 tree)
+{
+  std::size_t n = num_vertices(g);
+  std::vector<std::size_t> comp(n);
+  std::size_t num = connected_components(g, &comp[0]);
+  BOOST_TEST_EQ(tree.size(), n - num);
+
+  std::vector<std::size_t> rank(n), parent(n);
+  disjoint_sets<std::size_t*, std::size_t*> ds(&rank[0], &parent[0]);
+  for (std::size_t v = 0; v < n; ++v) ds.make_set(v);
+  std::vector<typename property_traits<WeightMap>::value_type> weights;
+  for (std::size_t i = 0; i < tree.size(); ++i) {
+    std::size_t u = source(tree[i], g), v = target(tree[i], g);
+    BOOST_TEST(ds.find_set(u) != ds.find_set(v));
+    ds.union_set(u, v);
+    weights.push_back(get(weight, tree[i]));
+  }
+  std::sort(weights.begin(), weights.end());
+  return weights;
+}
+
+// Returns the sorted weights of the edges of the forest
+template <typename G, typename WeightMap>
+std::vector<typename property_traits<WeightMap>::value_type>
+check(const G& g, WeightMap weight, std::size_t max_threads)
+{
+  typedef typename graph_traits<G>::edge_descriptor edge_descriptor;
+  typedef typename property_traits<WeightMap>::value_type weight_type;
+  std::vector<edge_descriptor> tree;
+  std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  kruskal_minimum_spanning_tree(g, std::back_inserter(tree),
+                                weight_map(weight));
+  double serial = seconds_since(start);
+  std::vector<weight_type> expected = forest_weights(g, weight, tree);
+  std::cout << "  kruskal_minimum_spanning_tree: " << serial << " s\n";
+
+  tree.clear();
+  start = std::chrono::steady_clock::now();
+  filter_kruskal_minimum_spanning_tree(g, std::back_inserter(tree),
+                                       weight_map(weight));
+  double time = seconds_since(start);
+  std::cout << "  filter_kruskal_minimum_spanning_tree: " << time << " s ("
+            << serial / time << "x)\n";
+  BOOST_TEST(forest_weights(g, weight, tree) == expected);
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    tree.clear();
+    start = std::chrono::steady_clock::now();
+    parallel_boruvka_minimum_spanning_tree(g, std::back_inserter(tree),
+                                           weight, get(vertex_index, g),
+                                           threads);
+    time = seconds_since(start);
+    std::cout << "  parallel_boruvka_minimum_spanning_tree, " << threads
+              << " threads: " << time << " s (" << serial / time << "x)\n";
+    BOOST_TEST(forest_weights(g, weight, tree) == expected);
+  }
+  return expected;
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 20;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+  std::size_t n = std::size_t(1) << scale;
+
+  {
+    // Each edge is stored both ways, as Prim's algorithm needs, without
+    // self-loops, which it takes as tree edges, and a path through all the
+    // vertices makes the graph connected
+    typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+    std::vector<Edge> rmat(RMATIter(gen, n, 4 * n, 0.57, 0.19, 0.19, 0.05),
+                           RMATIter());
+    for (std::size_t v = 0; v + 1 < n; ++v) rmat.push_back(Edge(v, v + 1));
+    uniform_real<> random_weight(0, 1);
+    std::vector<Edge> edges;
+    std::vector<double> weights;
+    for (std::size_t i = 0; i < rmat.size(); ++i) {
+      if (rmat[i].first == rmat[i].second) continue;
+      double w = random_weight(gen);
+      edges.push_back(rmat[i]);
+      edges.push_back(Edge(rmat[i].second, rmat[i].first));
+      weights.push_back(w);
+      weights.push_back(w);
+    }
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+            weights.begin(), n);
+    std::cout << "R-MAT graph: " << n << " vertices, " << num_edges(g) / 2
+              << " edges\n";
+
+    std::vector<std::size_t> pred(n);
+    std::vector<double> dist(n);
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    prim_minimum_spanning_tree(g, &pred[0],
+                               weight_map(get(edge_bundle, g))
+                               .distance_map(&dist[0]));
+    std::cout << "  prim_minimum_spanning_tree: " << seconds_since(start)
+              << " s\n";
+    std::vector<double> prim_weights;
+    for (std::size_t v = 0; v < n; ++v)
+      if (pred[v] != v) prim_weights.push_back(dist[v]);
+    std::sort(prim_weights.begin(), prim_weights.end());
+    BOOST_TEST(check(g, get(edge_bundle, g), max_threads) == prim_weights);
+  }
+
+  {
+    // Many ties, a self-loop and a parallel edge
+    std::size_t m = n / 16;
+    typedef rmat_iterator<minstd_rand, ListGraph> RMATIter;
+    ListGraph g(RMATIter(gen, m, 2 * m, 0.57, 0.19, 0.19, 0.05), RMATIter(),
+                m);
+    add_edge(0, 0, g);
+    add_edge(source(*edges(g).first, g), target(*edges(g).first, g), g);
+    graph_traits<ListGraph>::edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+      put(edge_weight, g, *ei, int(1 + gen() % 10));
+    std::cout << "R-MAT adjacency_list: " << m << " vertices, "
+              << num_edges(g) << " edges\n";
+    check(g, get(edge_weight, g), max_threads);
+  }
+
+  {
+    ListGraph g(3);
+    std::vector<graph_traits<ListGraph>::edge_descriptor> tree;
+    filter_kruskal_minimum_spanning_tree(g, std::back_inserter(tree));
+    parallel_boruvka_minimum_spanning_tree(g, std::back_inserter(tree));
+    BOOST_TEST(tree.empty());
+    ListGraph empty(0);
+    filter_kruskal_minimum_spanning_tree(empty, std::back_inserter(tree));
+    parallel_boruvka_minimum_spanning_tree(empty, std::back_inserter(tree));
+    BOOST_TEST(tree.empty());
+  }
+
+  return boost::report_errors();
+}
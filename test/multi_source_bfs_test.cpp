@@ -0,0 +1,160 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the closeness centralities, eccentricities and mean geodesics
+// computed with multi-source breadth-first search against those computed
+// from Floyd-Warshall distance matrices on small undirected and directed
+// graphs, checks the distance summaries of batches of 64 to 512 searches
+// against one breadth-first search per vertex on a sparse random graph, and
+// reports the running times.
+// Usage: multi_source_bfs_test [vertices]
+
+#include <boost/graph/multi_source_bfs.hpp>
+#include <boost/graph/closeness_centrality.hpp>
+#include <boost/graph/eccentricity.hpp>
+#include <boost/graph/geodesic_distance.hpp>
+#include <boost/graph/undirected_graph.hpp>
+#include <boost/graph/directed_graph.hpp>
+#include <boost/graph/floyd_warshall_shortest.hpp>
+#include <boost/graph/exterior_property.hpp>
+#include <boost/graph/property_maps/constant_property_map.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/visitors.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <cmath>
+
+using namespace boost;
+
+template <typename Graph>
+void build_graph(Graph& g,
+                 std::vector<typename graph_traits<Graph>::vertex_descriptor>& v)
+{
+  for (std::size_t i = 0; i < v.size(); ++i)
+    v[i] = add_vertex(g);
+  add_edge(v[0], v[1], g);
+  add_edge(v[1], v[2], g);
+  add_edge(v[2], v[0], g);
+  add_edge(v[3], v[4], g);
+  add_edge(v[4], v[0], g);
+  add_edge(v[5], v[3], g);
+  add_edge(v[2], v[6], g);
+}
+
+template <typename Graph>
+void test_measures()
+{
+  typedef typename graph_traits<Graph>::vertex_descriptor Vertex;
+  typedef typename graph_traits<Graph>::edge_descriptor Edge;
+  typedef exterior_vertex_property<Graph, int> IntProperty;
+  typedef exterior_vertex_property<Graph, double> RealProperty;
+
+  Graph g;
+  std::vector<Vertex> v(7);
+  build_graph(g, v);
+
+  typename IntProperty::matrix_type distances(num_vertices(g));
+  typename IntProperty::matrix_map_type dm(distances, g);
+  floyd_warshall_all_pairs_shortest_paths
+    (g, dm, weight_map(constant_property_map<Edge, int>(1)));
+
+  typename IntProperty::container_type eccs(num_vertices(g)),
+    bfs_eccs(num_vertices(g));
+  typename IntProperty::map_type em(eccs, g), bfs_em(bfs_eccs, g);
+  std::pair<int, int> rd = all_eccentricities(g, dm, em);
+  std::pair<int, int> bfs_rd = all_eccentricities_bfs(g, bfs_em);
+  BOOST_TEST(rd == bfs_rd);
+
+  typename RealProperty::container_type cents(num_vertices(g)),
+    bfs_cents(num_vertices(g)), geos(num_vertices(g)),
+    bfs_geos(num_vertices(g));
+  typename RealProperty::map_type cm(cents, g), bfs_cm(bfs_cents, g),
+    gm(geos, g), bfs_gm(bfs_geos, g);
+  all_closeness_centralities(g, dm, cm);
+  all_closeness_centralities_bfs(g, bfs_cm);
+  double mean = all_mean_geodesics(g, dm, gm);
+  double bfs_mean = all_mean_geodesics_bfs(g, bfs_gm);
+  BOOST_TEST(mean == bfs_mean);
+
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    BOOST_TEST_EQ(em[v[i]], bfs_em[v[i]]);
+    BOOST_TEST(std::abs(cm[v[i]] - bfs_cm[v[i]]) < 1e-12);
+    BOOST_TEST(gm[v[i]] == bfs_gm[v[i]]);
+  }
+}
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+template <std::size_t Words>
+void test_batches(const Graph& g,
+                  const std::vector<detail::bfs_distance_summary>& expected)
+{
+  timer timer;
+  std::vector<detail::bfs_distance_summary> summaries;
+  detail::all_bfs_distance_summaries<Words>(g, get(vertex_index, g),
+                                            summaries);
+  std::cout << "  " << 64 * Words << " searches per batch: "
+            << timer.elapsed() << " s\n";
+  BOOST_TEST(summaries.size() == expected.size());
+  std::size_t wrong = 0;
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    if (summaries[i].sum != expected[i].sum
+        || summaries[i].eccentricity != expected[i].eccentricity
+        || summaries[i].reached != expected[i].reached)
+      ++wrong;
+  BOOST_TEST_EQ(wrong, 0u);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 5000;
+
+  test_measures<undirected_graph<> >();
+  test_measures<directed_graph<> >();
+
+  // Sparse directed random graph, with vertices that some searches do not
+  // reach
+  minstd_rand gen(1);
+  typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+  Graph g(edges_are_unsorted, ERIter(gen, n, 3.0 / n), ERIter(), n);
+  std::cout << n << " vertices, " << num_edges(g) << " edges\n";
+
+  timer timer;
+  std::vector<detail::bfs_distance_summary> expected(n);
+  std::vector<std::size_t> distance(n);
+  for (std::size_t s = 0; s < n; ++s) {
+    std::fill(distance.begin(), distance.end(), std::size_t(-1));
+    distance[s] = 0;
+    breadth_first_search
+      (g, vertex(s, g),
+       visitor(make_bfs_visitor(record_distances(&distance[0],
+                                                 on_tree_edge()))));
+    detail::bfs_distance_summary& e = expected[s];
+    e.sum = e.eccentricity = e.reached = 0;
+    for (std::size_t v = 0; v < n; ++v)
+      if (distance[v] != std::size_t(-1)) {
+        e.sum += distance[v];
+        e.eccentricity = (std::max)(e.eccentricity, distance[v]);
+        ++e.reached;
+      }
+  }
+  std::cout << "  one search per vertex: " << timer.elapsed() << " s\n";
+
+  test_batches<1>(g, expected);
+  test_batches<2>(g, expected);
+  test_batches<4>(g, expected);
+  test_batches<8>(g, expected);
+
+  return boost::report_errors();
+}
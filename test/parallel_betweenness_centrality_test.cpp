@@ -0,0 +1,164 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_brandes_betweenness_centrality computes the same
+// vertex and edge centralities as brandes_betweenness_centrality, on
+// unweighted and weighted directed random graphs and on an undirected
+// graph, for several thread counts, and reports its speedup.
+// Usage: parallel_betweenness_centrality_test [vertices [max threads]]
+
+#include <boost/graph/parallel_betweenness_centrality.hpp>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS, no_property, int> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+static bool close(const std::vector<double>& a, const std::vector<double>& b)
+{
+  if (a.size() != b.size()) return false;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    if (std::abs(a[i] - b[i]) > 1e-9 * (std::max)(1.0, std::abs(b[i])))
+      return false;
+  return true;
+}
+
+void test_graph(const Graph& g, bool weighted, const char* name,
+                std::size_t max_threads)
+{
+  std::cout << name << ": " << num_vertices(g) << " vertices, "
+            << num_edges(g) << " edges\n";
+  std::vector<double> expected(num_vertices(g)), expected_edge(num_edges(g));
+  std::vector<double> centrality(num_vertices(g)), edge(num_edges(g));
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  if (weighted)
+    brandes_betweenness_centrality
+      (g, weight_map(get(edge_bundle, g))
+            .centrality_map(make_iterator_property_map(expected.begin(), get(vertex_index, g)))
+            .edge_centrality_map(make_iterator_property_map(expected_edge.begin(), get(edge_index, g))));
+  else
+    brandes_betweenness_centrality
+      (g, make_iterator_property_map(expected.begin(), get(vertex_index, g)),
+       make_iterator_property_map(expected_edge.begin(), get(edge_index, g)));
+  double serial_time = seconds_since(start);
+  std::cout << "  brandes_betweenness_centrality: " << serial_time << " s\n";
+
+  for (std::size_t t = 1; t <= max_threads; t *= 2) {
+    std::fill(centrality.begin(), centrality.end(), -1.0);
+    std::fill(edge.begin(), edge.end(), -1.0);
+    start = std::chrono::steady_clock::now();
+    if (weighted)
+      parallel_brandes_betweenness_centrality
+        (g, weight_map(get(edge_bundle, g))
+              .centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, g)))
+              .edge_centrality_map(make_iterator_property_map(edge.begin(), get(edge_index, g)))
+              .num_threads(t));
+    else
+      parallel_brandes_betweenness_centrality
+        (g, centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, g)))
+              .edge_centrality_map(make_iterator_property_map(edge.begin(), get(edge_index, g)))
+              .num_threads(t));
+    double time = seconds_since(start);
+    std::cout << "  " << t << " thread(s): " << time << " s, speedup = "
+              << serial_time / time << ".\n";
+    BOOST_TEST(close(centrality, expected));
+    BOOST_TEST(close(edge, expected_edge));
+  }
+
+  // Vertex centrality alone
+  std::fill(centrality.begin(), centrality.end(), -1.0);
+  parallel_brandes_betweenness_centrality
+    (g, centrality_map(make_iterator_property_map(centrality.begin(), get(vertex_index, g)))
+          .num_threads(3));
+  if (!weighted) BOOST_TEST(close(centrality, expected));
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 2000;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                          : (std::max)(4u, std::thread::hardware_concurrency());
+  minstd_rand gen(1);
+
+  // Sparse directed random graph, with small integer weights so that many
+  // shortest paths tie
+  typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+  std::vector<Edge> edges(ERIter(gen, n, 4.0 / n), ERIter());
+  uniform_int<> random_weight(1, 3);
+  std::vector<int> weights(edges.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+    weights[i] = random_weight(gen);
+  Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+          weights.begin(), n);
+  test_graph(g, false, "Unweighted random graph", max_threads);
+  test_graph(g, true, "Weighted random graph", max_threads);
+
+  // Undirected graph with an interior edge index, where the sums are halved
+  {
+    typedef adjacency_list<vecS, vecS, undirectedS, no_property,
+                           property<edge_index_t, std::size_t> > UGraph;
+    UGraph ug(6);
+    std::size_t ends[][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {1, 3},
+                             {3, 4}, {4, 5}};
+    for (std::size_t i = 0; i < 7; ++i)
+      add_edge(ends[i][0], ends[i][1], i, ug);
+    std::vector<double> expected(6), expected_edge(7), centrality(6),
+                        edge(7);
+    brandes_betweenness_centrality
+      (ug, make_iterator_property_map(expected.begin(), get(vertex_index, ug)),
+       make_iterator_property_map(expected_edge.begin(), get(edge_index, ug)));
+    parallel_brandes_betweenness_centrality
+      (ug, make_iterator_property_map(centrality.begin(), get(vertex_index, ug)),
+       make_iterator_property_map(edge.begin(), get(edge_index, ug)));
+    BOOST_TEST(close(centrality, expected));
+    BOOST_TEST(close(edge, expected_edge));
+    // Every path from 4 or 5 to the cycle goes through 3 and (3, 4); half
+    // of those between 0 and 2 go through 3
+    BOOST_TEST(std::abs(centrality[3] - 6.5) < 1e-9);
+    BOOST_TEST(std::abs(edge[5] - 8.0) < 1e-9);
+  }
+
+  // Graph without edge indices, vertex centrality only
+  {
+    typedef adjacency_list<listS, vecS, directedS> LGraph;
+    LGraph lg(4);
+    add_edge(0, 1, lg);
+    add_edge(1, 2, lg);
+    add_edge(2, 3, lg);
+    add_edge(0, 2, lg);
+    std::vector<double> centrality(4);
+    parallel_brandes_betweenness_centrality
+      (lg, make_iterator_property_map(centrality.begin(), get(vertex_index, lg)));
+    BOOST_TEST(centrality[0] == 0.0);
+    BOOST_TEST(centrality[1] == 0.0);
+    BOOST_TEST(centrality[2] == 2.0);
+    BOOST_TEST(centrality[3] == 0.0);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_breadth_first_search computes the same distances as
+// breadth_first_search on an R-MAT graph, for several thread counts, and
+// reports its throughput.  Usage: parallel_breadth_first_search_test [scale
+// [edge factor [max threads]]]
+
+#include <boost/graph/parallel_breadth_first_search.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/atomic_bit_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static const std::size_t unreached = (std::numeric_limits<std::size_t>::max)();
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+// Counts discoveries and tree edges, which must happen once per vertex
+struct counting_visitor : public default_bfs_visitor
+{
+  std::atomic<std::size_t>* discovered;
+  std::atomic<std::size_t>* tree_edges;
+
+  template <typename V, typename G>
+  void discover_vertex(V, const G&) { ++*discovered; }
+  template <typename E, typename G>
+  void tree_edge(E, const G&) { ++*tree_edges; }
+};
+
+struct throwing_visitor : public default_bfs_visitor
+{
+  template <typename V, typename G>
+  void examine_vertex(V v, const G&)
+  { if (v == target) throw std::runtime_error("visitor failure"); }
+  Vertex target;
+};
+
+int main(int argc, char* argv[])
+{
+  int scale = argc > 1 ? lexical_cast<int>(argv[1]) : 16;
+  std::size_t edge_factor = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 16;
+  std::size_t max_threads = argc > 3 ? lexical_cast<std::size_t>(argv[3])
+                          : (std::max)(4u, std::thread::hardware_concurrency());
+
+  std::size_t n = std::size_t(1) << scale;
+  minstd_rand gen(1);
+  std::vector<Edge> edge_list(rmat_iterator<minstd_rand, Graph>(gen, n, edge_factor * n, 0.57, 0.19, 0.19, 0.05),
+                              rmat_iterator<minstd_rand, Graph>());
+  Graph g(edges_are_unsorted_multi_pass, edge_list.begin(), edge_list.end(),
+          n);
+  std::cout << n << " vertices, " << num_edges(g) << " edges.\n";
+
+  // Start from the vertex of highest degree, which reaches most of the graph
+  Vertex s = 0;
+  for (Vertex v = 0; v < n; ++v)
+    if (out_degree(v, g) > out_degree(s, g)) s = v;
+
+  std::vector<std::size_t> expected(n, unreached);
+  expected[s] = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  breadth_first_search(g, s, visitor(make_bfs_visitor(
+    record_distances(make_iterator_property_map(expected.begin(),
+                                                get(vertex_index, g)),
+                     on_tree_edge()))));
+  double serial_time = seconds_since(start);
+  std::cout << "breadth_first_search: " << serial_time << " seconds, "
+            << num_edges(g) / serial_time / 1e6 << " Medges/s.\n";
+  std::size_t reached = n - std::count(expected.begin(), expected.end(),
+                                       unreached);
+
+  for (std::size_t t = 1; t <= max_threads; t *= 2) {
+    std::vector<std::size_t> distance(n, unreached);
+    std::vector<Vertex> pred(n, graph_traits<Graph>::null_vertex());
+    distance[s] = 0;
+    start = std::chrono::steady_clock::now();
+    parallel_breadth_first_search(g, s, make_bfs_visitor(
+      std::make_pair(
+        record_distances(make_iterator_property_map(distance.begin(),
+                                                    get(vertex_index, g)),
+                         on_tree_edge()),
+        record_predecessors(make_iterator_property_map(pred.begin(),
+                                                       get(vertex_index, g)),
+                            on_tree_edge()))), t);
+    double time = seconds_since(start);
+    std::cout << t << " thread(s): " << time << " seconds, "
+              << num_edges(g) / time / 1e6 << " Medges/s, speedup = "
+              << serial_time / time << ".\n";
+    BOOST_TEST(distance == expected);
+    for (std::size_t v = 0; v < n; ++v)
+      if (v != s && distance[v] != unreached)
+        BOOST_TEST(distance[pred[v]] + 1 == distance[v]);
+
+    std::atomic<std::size_t> discovered(0), tree_edges(0);
+    counting_visitor counter;
+    counter.discovered = &discovered;
+    counter.tree_edges = &tree_edges;
+    parallel_breadth_first_search(g, s, counter, t);
+    BOOST_TEST(discovered == reached);
+    BOOST_TEST(tree_edges + 1 == reached);
+
+    // Exceptions from the visitor reach the caller
+    bool threw = false;
+    try {
+      throwing_visitor thrower;
+      thrower.target = 1;
+      parallel_breadth_first_search(g, s, thrower, t);
+    } catch (const std::runtime_error&) {
+      threw = true;
+    }
+    BOOST_TEST(threw == (expected[1] != unreached));
+  }
+
+  // Every bit is claimed exactly once when all threads race for all of them
+  atomic_bit_map<> bits(1000);
+  std::atomic<std::size_t> claimed(0);
+  graph::detail::run_in_parallel(4, [&](std::size_t) {
+    for (std::size_t i = 0; i < 1000; ++i)
+      if (test_and_set(bits, i)) ++claimed;
+  });
+  BOOST_TEST(claimed == 1000);
+  BOOST_TEST(get(bits, 999));
+  put(bits, 999, false);
+  BOOST_TEST(!get(bits, 999));
+  BOOST_TEST(get(bits, 998));
+
+  return boost::report_errors();
+}
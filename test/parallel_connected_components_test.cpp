@@ -0,0 +1,140 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_connected_components numbers the components as
+// connected_components does, on an undirected adjacency_list, on CSR
+// graphs storing an R-MAT graph with both directions of each edge or with
+// one (directed and bidirectional), and on the edge list itself, for
+// several thread counts, and compares the times.
+// Usage: parallel_connected_components_test [R-MAT scale [max threads]]
+
+#include <boost/graph/parallel_connected_components.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef adjacency_list<vecS, vecS, undirectedS> Graph;
+typedef compressed_sparse_row_graph<directedS> CSRGraph;
+typedef compressed_sparse_row_graph<bidirectionalS> BidirCSRGraph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+template <typename G>
+void check(const char* name, const G& g,
+           const std::vector<std::size_t>& expected, std::size_t num,
+           double serial, std::size_t max_threads)
+{
+  std::vector<std::size_t> comp(num_vertices(g));
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    std::size_t count = parallel_connected_components
+      (g, make_iterator_property_map(comp.begin(), get(vertex_index, g)),
+       threads);
+    double time = seconds_since(start);
+    std::cout << "  " << name << ", " << threads << " threads: " << time
+              << " s (" << serial / time << "x)\n";
+    BOOST_TEST_EQ(count, num);
+    BOOST_TEST(comp == expected);
+  }
+}
+
+void check_edges(const std::vector<Edge>& edges, std::size_t n,
+                 const std::vector<std::size_t>& expected, std::size_t num,
+                 double serial, std::size_t max_threads)
+{
+  std::vector<std::size_t> comp(n);
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    std::size_t count = parallel_connected_components
+      (edges.begin(), edges.end(), n, &comp[0], threads);
+    double time = seconds_since(start);
+    std::cout << "  edge list, " << threads << " threads: " << time
+              << " s (" << serial / time << "x)\n";
+    BOOST_TEST_EQ(count, num);
+    BOOST_TEST(comp == expected);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 20;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+
+  {
+    // Below the percolation threshold, with many small components
+    std::size_t n = 5000;
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    Graph g(ERIter(gen, n, 0.8 / n), ERIter(), n);
+    std::vector<std::size_t> expected(n);
+    std::chrono::steady_clock::time_point start
+      = std::chrono::steady_clock::now();
+    std::size_t num = connected_components(g, &expected[0]);
+    double serial = seconds_since(start);
+    std::cout << "Sparse random graph: " << n << " vertices, "
+              << num_edges(g) << " edges, " << num
+              << " components, connected_components: " << serial << " s\n";
+    check("adjacency_list", g, expected, num, serial, max_threads);
+  }
+
+  {
+    Graph g(0);
+    std::size_t* comp = 0;
+    BOOST_TEST_EQ(parallel_connected_components(g, comp), 0u);
+  }
+
+  // An R-MAT graph, whose isolated vertices are components of their own
+  std::size_t n = std::size_t(1) << scale;
+  typedef rmat_iterator<minstd_rand, CSRGraph> RMATIter;
+  std::vector<Edge> edges(RMATIter(gen, n, 4 * n, 0.57, 0.19, 0.19, 0.05),
+                          RMATIter());
+  std::size_t m = edges.size();
+  Graph g(edges.begin(), edges.end(), n);
+  std::vector<std::size_t> expected(n);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::size_t num = connected_components(g, &expected[0]);
+  double serial = seconds_since(start);
+  std::cout << "R-MAT graph: " << n << " vertices, " << m << " edges, "
+            << num << " components, connected_components: " << serial
+            << " s\n";
+
+  check("adjacency_list", g, expected, num, serial, max_threads);
+  check_edges(edges, n, expected, num, serial, max_threads);
+  {
+    BidirCSRGraph h(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+                    n);
+    check("bidirectional CSR", h, expected, num, serial, max_threads);
+    CSRGraph d(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+    check("directed CSR", d, expected, num, serial, max_threads);
+  }
+  for (std::size_t i = 0; i < m; ++i)
+    edges.push_back(Edge(edges[i].second, edges[i].first));
+  CSRGraph s(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+  check("symmetric CSR", s, expected, num, serial, max_threads);
+
+  return boost::report_errors();
+}
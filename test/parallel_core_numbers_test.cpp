@@ -0,0 +1,94 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_core_numbers gives the core numbers of core_numbers
+// on an undirected R-MAT graph, stored with both directions of each edge,
+// and on a directed random graph, for several thread counts, and compares
+// the times.
+// Usage: parallel_core_numbers_test [R-MAT scale [max threads]]
+
+#include <boost/graph/parallel_core_numbers.hpp>
+#include <boost/graph/core_numbers.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+void check(const Graph& g, std::size_t max_threads)
+{
+  std::size_t n = num_vertices(g);
+  std::vector<std::size_t> expected(n), cores(n);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::size_t expected_max = core_numbers
+    (g, make_iterator_property_map(expected.begin(), get(vertex_index, g)));
+  double serial = seconds_since(start);
+  std::cout << "  largest core number " << expected_max << ", core_numbers: "
+            << serial << " s\n";
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    std::size_t largest = parallel_core_numbers
+      (g, make_iterator_property_map(cores.begin(), get(vertex_index, g)),
+       get(vertex_index, g), threads);
+    double time = seconds_since(start);
+    std::cout << "  parallel_core_numbers, " << threads << " threads: "
+              << time << " s (" << serial / time << "x)\n";
+    BOOST_TEST_EQ(largest, expected_max);
+    BOOST_TEST(cores == expected);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 18;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+  std::size_t n = std::size_t(1) << scale;
+
+  {
+    typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+    std::vector<Edge> edges(RMATIter(gen, n, 8 * n, 0.57, 0.19, 0.19, 0.05),
+                            RMATIter());
+    std::size_t m = edges.size();
+    for (std::size_t i = 0; i < m; ++i)
+      edges.push_back(Edge(edges[i].second, edges[i].first));
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+    std::cout << "Undirected R-MAT graph: " << n << " vertices, " << m
+              << " edges\n";
+    check(g, max_threads);
+  }
+
+  {
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    Graph g(edges_are_unsorted, ERIter(gen, n / 4, 10.0 / (n / 4)), ERIter(),
+            n / 4);
+    std::cout << "Directed random graph: " << n / 4 << " vertices, "
+              << num_edges(g) << " edges\n";
+    check(g, max_threads);
+  }
+
+  return boost::report_errors();
+}
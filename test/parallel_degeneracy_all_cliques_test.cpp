@@ -0,0 +1,96 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_degeneracy_all_cliques visits the maximal cliques of
+// degeneracy_all_cliques on a graph made of dense communities joined by
+// sparse random edges, for several thread counts, and compares the times.
+// Usage: parallel_degeneracy_all_cliques_test [community size [communities [max threads]]]
+
+#include <boost/graph/parallel_degeneracy_all_cliques.hpp>
+#include <boost/graph/degeneracy_all_cliques.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+typedef std::vector<std::vector<std::size_t> > Cliques;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+struct clique_recorder
+{
+  template <typename Clique>
+  void clique(const Clique& c, const Graph&)
+  {
+    cliques->push_back(std::vector<std::size_t>(c.begin(), c.end()));
+    std::sort(cliques->back().begin(), cliques->back().end());
+  }
+
+  Cliques* cliques;
+};
+
+int main(int argc, char* argv[])
+{
+  std::size_t size = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 60;
+  std::size_t communities = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 20;
+  std::size_t max_threads = argc > 3 ? lexical_cast<std::size_t>(argv[3])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+
+  // Dense communities, each with edge probability 0.7, joined by a few
+  // random edges, stored with both directions of each edge
+  std::size_t n = size * communities;
+  std::vector<Edge> edges;
+  for (std::size_t c = 0; c < communities; ++c)
+    for (std::size_t u = 0; u < size; ++u)
+      for (std::size_t v = u + 1; v < size; ++v)
+        if (gen() % 10 < 7) edges.push_back(Edge(c * size + u, c * size + v));
+  for (std::size_t i = 0; i < 2 * n; ++i)
+    edges.push_back(Edge(gen() % n, gen() % n));
+  std::size_t m = edges.size();
+  for (std::size_t i = 0; i < m; ++i)
+    edges.push_back(Edge(edges[i].second, edges[i].first));
+  Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+  std::cout << n << " vertices, " << m << " edges\n";
+
+  Cliques expected, found;
+  clique_recorder expected_recorder = {&expected};
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  degeneracy_all_cliques(g, expected_recorder, 3);
+  double serial = seconds_since(start);
+  std::sort(expected.begin(), expected.end());
+  std::cout << "  " << expected.size()
+            << " maximal cliques, degeneracy_all_cliques: " << serial << " s\n";
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    found.clear();
+    clique_recorder recorder = {&found};
+    start = std::chrono::steady_clock::now();
+    parallel_degeneracy_all_cliques(g, recorder, 3, threads);
+    double time = seconds_since(start);
+    std::cout << "  parallel_degeneracy_all_cliques, " << threads
+              << " threads: " << time << " s (" << serial / time << "x)\n";
+    std::sort(found.begin(), found.end());
+    BOOST_TEST(found == expected);
+  }
+
+  return boost::report_errors();
+}
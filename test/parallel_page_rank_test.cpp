@@ -0,0 +1,150 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_page_rank converges to the ranks of page_rank on a
+// random graph without dangling vertices, and to ranks that sum to the
+// number of vertices on one with dangling vertices, for several thread
+// counts, and compares the time per iteration with page_rank.  Checks that
+// parallel_personalized_page_rank gives the estimates of
+// personalized_page_rank_push for a batch of seeds, and reports the time.
+// Usage: parallel_page_rank_test [vertices [max threads]]
+
+#include <boost/graph/parallel_page_rank.hpp>
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/personalized_page_rank.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+static double l1_distance(const std::vector<double>& a,
+                          const std::vector<double>& b)
+{
+  double d = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) d += std::abs(a[i] - b[i]);
+  return d;
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 200000;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+
+  // A random graph whose vertices all have out-edges, thanks to a cycle
+  // through all of them
+  typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+  std::vector<Edge> edges(ERIter(gen, n, 8.0 / n), ERIter());
+  for (std::size_t i = 0; i < n; ++i) edges.push_back(Edge(i, (i + 1) % n));
+  Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+  std::cout << n << " vertices, " << num_edges(g) << " edges\n";
+
+  std::vector<double> expected(n), ranks(n);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  graph::page_rank(g, make_iterator_property_map(expected.begin(), get(vertex_index, g)),
+                   graph::n_iterations(20));
+  double serial = seconds_since(start) / 20;
+  std::cout << "  page_rank: " << serial << " s per iteration\n";
+  graph::page_rank(g, make_iterator_property_map(expected.begin(), get(vertex_index, g)),
+                   graph::n_iterations(200));
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    std::size_t iterations = graph::parallel_page_rank
+      (g, make_iterator_property_map(ranks.begin(), get(vertex_index, g)),
+       0.85, 0.0, 20, get(vertex_index, g), threads);
+    double time = seconds_since(start) / 20;
+    BOOST_TEST_EQ(iterations, 20u);
+    std::cout << "  parallel_page_rank, " << threads << " threads: " << time
+              << " s per iteration (" << serial / time << "x)\n";
+
+    start = std::chrono::steady_clock::now();
+    iterations = graph::parallel_page_rank
+      (g, make_iterator_property_map(ranks.begin(), get(vertex_index, g)),
+       0.85, 1e-10, 200, get(vertex_index, g), threads);
+    std::cout << "    converged in " << iterations << " iterations, "
+              << seconds_since(start) << " s\n";
+    BOOST_TEST(iterations < 200);
+    BOOST_TEST(l1_distance(ranks, expected) < 1e-6 * n);
+  }
+
+  // A batch of personalized PageRanks
+  {
+    typedef std::vector<std::pair<std::size_t, double> > Estimates;
+    std::size_t num_seeds = 2000;
+    std::vector<std::size_t> seeds(num_seeds);
+    for (std::size_t i = 0; i < num_seeds; ++i) seeds[i] = (i * 7919) % n;
+    std::vector<Estimates> expected(num_seeds), results;
+    graph::personalized_page_rank_push<Graph> push(g);
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < num_seeds; ++i)
+      push(seeds[i], expected[i], 0.85, 1e-4);
+    double serial = seconds_since(start);
+    std::cout << "  personalized_page_rank_push, " << num_seeds
+              << " seeds: " << serial << " s\n";
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+      start = std::chrono::steady_clock::now();
+      graph::parallel_personalized_page_rank
+        (g, seeds.begin(), seeds.end(), results, 0.85, 1e-4,
+         get(vertex_index, g), threads);
+      double time = seconds_since(start);
+      std::cout << "  parallel_personalized_page_rank, " << threads
+                << " threads: " << time << " s (" << serial / time << "x)\n";
+      BOOST_TEST(results == expected);
+    }
+  }
+
+  // Dangling vertices: the ranks still sum to n and are a fixed point
+  {
+    typedef adjacency_list<vecS, vecS, bidirectionalS> AGraph;
+    AGraph ag(6);
+    add_edge(0, 1, ag);
+    add_edge(0, 2, ag);
+    add_edge(1, 2, ag);
+    add_edge(2, 0, ag);
+    add_edge(3, 2, ag);
+    add_edge(4, 5, ag);
+    std::vector<double> r(6);
+    std::size_t iterations = graph::parallel_page_rank
+      (ag, make_iterator_property_map(r.begin(), get(vertex_index, ag)),
+       0.85, 1e-12, 1000);
+    BOOST_TEST(iterations < 1000);
+    double sum = 0, dangling = r[5];
+    for (std::size_t i = 0; i < 6; ++i) sum += r[i];
+    BOOST_TEST(std::abs(sum - 6) < 1e-9);
+    double base = 0.15 + 0.85 * dangling / 6;
+    BOOST_TEST(std::abs(r[3] - base) < 1e-9);
+    BOOST_TEST(std::abs(r[4] - base) < 1e-9);
+    BOOST_TEST(std::abs(r[5] - (base + 0.85 * r[4])) < 1e-9);
+    BOOST_TEST(std::abs(r[1] - (base + 0.85 * r[0] / 2)) < 1e-9);
+    BOOST_TEST(std::abs(r[2] - (base + 0.85 * (r[0] / 2 + r[1] + r[3])))
+               < 1e-9);
+  }
+
+  return boost::report_errors();
+}
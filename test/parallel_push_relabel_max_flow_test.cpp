@@ -0,0 +1,173 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_push_relabel_max_flow finds the flow value of
+// push_relabel_max_flow and leaves a valid flow in the residual
+// capacities, for several thread counts, on a generated GENRMF network, on
+// a random graph and on the DIMACS max-flow files given on the command
+// line, read with read_dimacs_max_flow, and compares the times.
+// Usage: parallel_push_relabel_max_flow_test [GENRMF frame side
+//          [max threads [DIMACS file ...]]]
+
+#include <boost/graph/parallel_push_relabel_max_flow.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/read_dimacs.hpp>
+#include <boost/graph/random.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef adjacency_list_traits<vecS, vecS, directedS> Traits;
+typedef adjacency_list<vecS, vecS, directedS, no_property,
+  property<edge_capacity_t, long,
+    property<edge_residual_capacity_t, long,
+      property<edge_reverse_t, Traits::edge_descriptor> > > > Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+// Adds the edge (u, v) of capacity c and its reverse edge of capacity 0
+void add_flow_edge(Vertex u, Vertex v, long c, Graph& g)
+{
+  Traits::edge_descriptor e = add_edge(u, v, g).first;
+  Traits::edge_descriptor r = add_edge(v, u, g).first;
+  put(edge_capacity, g, e, c);
+  put(edge_capacity, g, r, 0);
+  put(edge_reverse, g, e, r);
+  put(edge_reverse, g, r, e);
+}
+
+// Whether the residual capacities describe a flow of the given value
+bool is_flow(const Graph& g, Vertex s, Vertex t, long value)
+{
+  std::vector<long> net(num_vertices(g), 0);
+  graph_traits<Graph>::edge_iterator ei, ei_end;
+  for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei) {
+    long r = get(edge_residual_capacity, g, *ei);
+    long f = get(edge_capacity, g, *ei) - r;
+    if (r < 0 || f != -(get(edge_capacity, g, get(edge_reverse, g, *ei))
+                        - get(edge_residual_capacity, g,
+                              get(edge_reverse, g, *ei))))
+      return false;
+    net[source(*ei, g)] += f;
+  }
+  for (std::size_t v = 0; v < net.size(); ++v)
+    if (v != s && v != t && net[v] != 0) return false;
+  return net[s] == value && net[t] == -value;
+}
+
+void check(Graph& g, Vertex s, Vertex t, std::size_t max_threads)
+{
+  std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  long expected = push_relabel_max_flow(g, s, t);
+  double serial = seconds_since(start);
+  std::cout << "  flow " << expected << ", push_relabel_max_flow: "
+            << serial << " s\n";
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    long flow = parallel_push_relabel_max_flow(g, s, t, threads);
+    double time = seconds_since(start);
+    std::cout << "  parallel_push_relabel_max_flow, " << threads
+              << " threads: " << time << " s (" << serial / time << "x)\n";
+    BOOST_TEST_EQ(flow, expected);
+    BOOST_TEST(is_flow(g, s, t, flow));
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 32;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+
+  {
+    // GENRMF: side frames of side x side grids, whose neighbors are joined
+    // by edges of capacity c2 * side * side, each vertex joined to a
+    // random vertex of the next frame by an edge of random capacity in
+    // [c1, c2]; the source is in the first frame and the sink in the last
+    const long c1 = 1, c2 = 10000;
+    std::size_t a = side, b = side, frame = a * a;
+    Graph g(frame * b);
+    for (std::size_t k = 0; k < b; ++k) {
+      for (std::size_t x = 0; x < a; ++x)
+        for (std::size_t y = 0; y < a; ++y) {
+          std::size_t v = k * frame + x * a + y;
+          long c = c2 * long(frame);
+          if (x + 1 < a) {
+            add_flow_edge(v, v + a, c, g);
+            add_flow_edge(v + a, v, c, g);
+          }
+          if (y + 1 < a) {
+            add_flow_edge(v, v + 1, c, g);
+            add_flow_edge(v + 1, v, c, g);
+          }
+        }
+      if (k + 1 < b) {
+        std::vector<std::size_t> perm(frame);
+        for (std::size_t i = 0; i < frame; ++i) perm[i] = i;
+        for (std::size_t i = frame; i > 1; --i)
+          std::swap(perm[i - 1], perm[gen() % i]);
+        for (std::size_t i = 0; i < frame; ++i)
+          add_flow_edge(k * frame + i, (k + 1) * frame + perm[i],
+                        c1 + long(gen() % (c2 - c1 + 1)), g);
+      }
+    }
+    std::cout << "GENRMF network: " << num_vertices(g) << " vertices, "
+              << num_edges(g) / 2 << " edges\n";
+    check(g, 0, num_vertices(g) - 1, max_threads);
+  }
+
+  {
+    std::size_t n = side * side * side, m = 4 * n;
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i) {
+      std::size_t u = gen() % n, v = gen() % n;
+      add_flow_edge(u, v, long(1 + gen() % 1000), g);
+    }
+    std::cout << "Random graph: " << n << " vertices, " << m << " edges\n";
+    check(g, 0, n - 1, max_threads);
+  }
+
+  for (int i = 3; i < argc; ++i) {
+    Graph g;
+    Vertex s = 0, t = 0;
+    std::ifstream in(argv[i]);
+    BOOST_TEST(in);
+    read_dimacs_max_flow(g, get(edge_capacity, g), get(edge_reverse, g), s,
+                         t, in);
+    std::cout << argv[i] << ": " << num_vertices(g) << " vertices, "
+              << num_edges(g) / 2 << " edges\n";
+    check(g, s, t, max_threads);
+  }
+
+  {
+    // The sink cannot be reached
+    Graph g(4);
+    add_flow_edge(0, 1, 5, g);
+    add_flow_edge(2, 3, 5, g);
+    BOOST_TEST_EQ(parallel_push_relabel_max_flow(g, 0, 3, 2), 0);
+    BOOST_TEST(is_flow(g, 0, 3, 0));
+  }
+
+  return boost::report_errors();
+}
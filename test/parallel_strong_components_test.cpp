@@ -0,0 +1,147 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_strong_components finds the components of
+// strong_components, on a directed R-MAT graph and on a graph of long
+// chains and cycles like a dependency graph, stored in a bidirectional CSR
+// graph and adjacency_list, for several thread counts, and compares the
+// times.  Each graph is also run with serial cutoffs of 0 and 64, so that
+// the forward-backward and coloring steps run whatever its size.
+// Usage: parallel_strong_components_test [R-MAT scale [max threads]]
+
+#include <boost/graph/parallel_strong_components.hpp>
+#include <boost/graph/strong_components.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<bidirectionalS> Graph;
+typedef adjacency_list<vecS, vecS, bidirectionalS> ListGraph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+// Renumbers the components in the order of their smallest vertex
+void renumber(std::vector<std::size_t>& comp)
+{
+  std::vector<std::size_t> number(comp.size(), comp.size());
+  std::size_t next = 0;
+  for (std::size_t v = 0; v < comp.size(); ++v) {
+    if (number[comp[v]] == comp.size()) number[comp[v]] = next++;
+    comp[v] = number[comp[v]];
+  }
+}
+
+template <typename G>
+void check(const G& g, std::size_t max_threads, std::size_t cutoff)
+{
+  std::size_t n = num_vertices(g);
+  std::vector<std::size_t> expected(n), comp(n);
+  std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  std::size_t num = strong_components
+    (g, make_iterator_property_map(expected.begin(), get(vertex_index, g)));
+  double serial = seconds_since(start);
+  renumber(expected);
+  std::cout << "  " << num << " components, strong_components: " << serial
+            << " s; serial cutoff " << cutoff << "\n";
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    std::size_t count = parallel_strong_components
+      (g, make_iterator_property_map(comp.begin(), get(vertex_index, g)),
+       get(vertex_index, g), threads, cutoff);
+    double time = seconds_since(start);
+    std::cout << "  parallel_strong_components, " << threads << " threads: "
+              << time << " s (" << serial / time << "x)\n";
+    BOOST_TEST_EQ(count, num);
+    BOOST_TEST(comp == expected);
+  }
+}
+
+template <typename G>
+void check(const G& g, std::size_t max_threads)
+{
+  check(g, max_threads, std::size_t(1) << 16);
+  check(g, max_threads, 64);
+  check(g, max_threads, 0);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 20;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+  std::size_t n = std::size_t(1) << scale;
+
+  {
+    typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+    std::vector<Edge> edges(RMATIter(gen, n, 8 * n, 0.57, 0.19, 0.19, 0.05),
+                            RMATIter());
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+    std::cout << "R-MAT graph: " << n << " vertices, " << num_edges(g)
+              << " edges\n";
+    check(g, max_threads);
+  }
+
+  {
+    // Chains of random lengths, each going forward from a random earlier
+    // vertex, some closed into cycles by an edge back to their start, and
+    // a few random edges between them
+    std::vector<Edge> edges;
+    std::size_t v = 1;
+    while (v < n) {
+      std::size_t start = gen() % v, length = 1 + gen() % 1000;
+      std::size_t u = start;
+      for (std::size_t i = 0; i < length && v < n; ++i, ++v) {
+        edges.push_back(Edge(u, v));
+        u = v;
+      }
+      if (gen() % 2) edges.push_back(Edge(u, start));
+    }
+    for (std::size_t i = 0; i < n / 100; ++i)
+      edges.push_back(Edge(gen() % n, gen() % n));
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+    std::cout << "Chains and cycles: " << n << " vertices, " << num_edges(g)
+              << " edges\n";
+    check(g, max_threads);
+  }
+
+  {
+    typedef rmat_iterator<minstd_rand, ListGraph> RMATIter;
+    std::size_t m = n / 16;
+    ListGraph g(RMATIter(gen, m, 4 * m, 0.57, 0.19, 0.19, 0.05), RMATIter(),
+                m);
+    add_edge(0, 0, g);
+    std::cout << "R-MAT adjacency_list: " << m << " vertices, "
+              << num_edges(g) << " edges\n";
+    check(g, max_threads);
+  }
+
+  {
+    ListGraph g(0);
+    std::size_t* comp = 0;
+    BOOST_TEST_EQ(parallel_strong_components(g, comp), 0u);
+  }
+
+  return boost::report_errors();
+}
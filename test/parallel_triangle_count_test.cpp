@@ -0,0 +1,79 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that parallel_count_triangles gives the results of count_triangles
+// on a skewed R-MAT graph for several thread counts, and compares the times.
+// Usage: parallel_triangle_count_test [R-MAT scale [max threads]]
+
+#include <boost/graph/parallel_triangle_count.hpp>
+#include <boost/graph/triangle_count.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <chrono>
+#include <thread>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                       - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 18;
+  std::size_t max_threads = argc > 2 ? lexical_cast<std::size_t>(argv[2])
+                                     : std::thread::hardware_concurrency();
+  if (max_threads == 0) max_threads = 1;
+  minstd_rand gen(1);
+
+  std::size_t n = std::size_t(1) << scale;
+  typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+  std::vector<Edge> edges(RMATIter(gen, n, 16 * n, 0.57, 0.19, 0.19, 0.05),
+                          RMATIter());
+  Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+  std::cout << "R-MAT graph: " << n << " vertices, " << num_edges(g)
+            << " arcs\n";
+
+  std::vector<std::size_t> expected_tri(n), tri(n);
+  std::vector<double> expected_cc(n), cc(n);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  triangle_totals expected = count_triangles
+    (g, make_iterator_property_map(expected_tri.begin(), get(vertex_index, g)),
+     make_iterator_property_map(expected_cc.begin(), get(vertex_index, g)));
+  double serial = seconds_since(start);
+  std::cout << "  " << expected.triangles << " triangles, count_triangles: "
+            << serial << " s\n";
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    triangle_totals totals = parallel_count_triangles
+      (g, make_iterator_property_map(tri.begin(), get(vertex_index, g)),
+       make_iterator_property_map(cc.begin(), get(vertex_index, g)),
+       get(vertex_index, g), threads);
+    double time = seconds_since(start);
+    std::cout << "  parallel_count_triangles, " << threads << " threads: "
+              << time << " s (" << serial / time << "x)\n";
+    BOOST_TEST_EQ(totals.triangles, expected.triangles);
+    BOOST_TEST_EQ(totals.triples, expected.triples);
+    BOOST_TEST(totals.transitivity == expected.transitivity);
+    BOOST_TEST(totals.mean_clustering == expected.mean_clustering);
+    BOOST_TEST(tri == expected_tri);
+    BOOST_TEST(cc == expected_cc);
+  }
+
+  return boost::report_errors();
+}
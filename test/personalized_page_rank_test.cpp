@@ -0,0 +1,162 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the personalized PageRank estimates of local push against power
+// iteration on an undirected random graph, where each estimate is within
+// epsilon * degree, and on a directed graph with dangling vertices, where
+// the errors sum to at most epsilon * edges, and reports the time per seed
+// and the error for several values of epsilon next to the time of one
+// page_rank call.
+// Usage: personalized_page_rank_test [vertices [seeds]]
+
+#include <boost/graph/personalized_page_rank.hpp>
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <cmath>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::pair<std::size_t, std::size_t> Edge;
+typedef std::vector<std::pair<Vertex, double> > Estimates;
+
+// Personalized PageRank of seed by power iteration, with the walk jumping
+// back to the seed from vertices without out-edges
+std::vector<double> power_iteration(const Graph& g, Vertex seed)
+{
+  std::size_t n = num_vertices(g);
+  std::vector<double> x(n), y(n);
+  x[seed] = 1;
+  for (double change = 1; change > 1e-13; ) {
+    std::fill(y.begin(), y.end(), 0.0);
+    double back = 0.15;
+    for (std::size_t u = 0; u < n; ++u) {
+      std::size_t degree = out_degree(u, g);
+      if (degree == 0) { back += 0.85 * x[u]; continue; }
+      graph_traits<Graph>::adjacency_iterator ai, ai_end;
+      for (boost::tie(ai, ai_end) = adjacent_vertices(u, g); ai != ai_end; ++ai)
+        y[*ai] += 0.85 * x[u] / degree;
+    }
+    y[seed] += back;
+    change = 0;
+    for (std::size_t v = 0; v < n; ++v) change += std::abs(y[v] - x[v]);
+    x.swap(y);
+  }
+  return x;
+}
+
+// Largest error over epsilon * degree, or over epsilon if the degree is 0,
+// and sum of the errors; also checks that no estimate is too large
+std::pair<double, double>
+errors(const Graph& g, const Estimates& estimates,
+       const std::vector<double>& exact, double epsilon)
+{
+  std::vector<double> p(num_vertices(g));
+  for (std::size_t j = 0; j < estimates.size(); ++j)
+    p[estimates[j].first] = estimates[j].second;
+  double largest = 0, sum = 0;
+  for (std::size_t v = 0; v < p.size(); ++v) {
+    BOOST_TEST(p[v] <= exact[v] + 1e-12);
+    double error = std::abs(exact[v] - p[v]);
+    std::size_t degree = out_degree(v, g);
+    largest = (std::max)(largest, error / (epsilon * (degree == 0 ? 1 : degree)));
+    sum += error;
+  }
+  return std::make_pair(largest, sum);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 50000;
+  std::size_t num_seeds = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 200;
+  minstd_rand gen(1);
+
+  // Undirected random graph, stored with both directions of each edge
+  {
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    std::vector<Edge> edges(ERIter(gen, n, 5.0 / n), ERIter());
+    std::size_t m = edges.size();
+    for (std::size_t i = 0; i < m; ++i)
+      edges.push_back(Edge(edges[i].second, edges[i].first));
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(), n);
+    std::cout << "Undirected random graph: " << n << " vertices, "
+              << num_edges(g) / 2 << " edges\n";
+
+    timer timer;
+    std::vector<double> ranks(n);
+    graph::page_rank(g, make_iterator_property_map(ranks.begin(), get(vertex_index, g)));
+    std::cout << "  page_rank: " << timer.elapsed() << " s\n";
+
+    std::vector<Vertex> seeds(num_seeds);
+    for (std::size_t i = 0; i < num_seeds; ++i) seeds[i] = (i * 7919) % n;
+    std::vector<std::vector<double> > exact(3);
+    for (std::size_t i = 0; i < 3; ++i) exact[i] = power_iteration(g, seeds[i]);
+
+    graph::personalized_page_rank_push<Graph> push(g);
+    Estimates estimates;
+    double epsilons[] = {1e-3, 1e-4, 1e-5, 1e-6};
+    for (int k = 0; k < 4; ++k) {
+      timer.restart();
+      std::size_t pushes = 0, touched = 0;
+      for (std::size_t i = 0; i < num_seeds; ++i) {
+        pushes += push(seeds[i], estimates, 0.85, epsilons[k]);
+        touched += estimates.size();
+      }
+      double time = timer.elapsed() / num_seeds;
+      double largest = 0, l1 = 0;
+      for (std::size_t i = 0; i < 3; ++i) {
+        push(seeds[i], estimates, 0.85, epsilons[k]);
+        std::pair<double, double> e = errors(g, estimates, exact[i], epsilons[k]);
+        largest = (std::max)(largest, e.first);
+        l1 += e.second / 3;
+      }
+      std::cout << "  epsilon " << epsilons[k] << ": " << time
+                << " s per seed, " << pushes / num_seeds << " pushes and "
+                << touched / num_seeds << " vertices per seed, L1 error "
+                << l1 << ", largest error " << largest
+                << " of epsilon * degree\n";
+      BOOST_TEST(largest <= 1);
+    }
+
+    // The function form gives the same estimates
+    Estimates other;
+    graph::personalized_page_rank(g, seeds[0], other, 0.85, 1e-6);
+    push(seeds[0], estimates, 0.85, 1e-6);
+    BOOST_TEST(other == estimates);
+  }
+
+  // Directed graph with dangling vertices
+  {
+    typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+    std::size_t small = n / 10;
+    Graph g(edges_are_unsorted, ERIter(gen, small, 2.0 / small), ERIter(),
+            small);
+    std::size_t dangling = 0;
+    for (std::size_t v = 0; v < small; ++v)
+      if (out_degree(v, g) == 0) ++dangling;
+    std::cout << "Directed random graph: " << small << " vertices, "
+              << num_edges(g) << " edges, " << dangling << " dangling\n";
+    graph::personalized_page_rank_push<Graph> push(g);
+    Estimates estimates;
+    for (std::size_t s = 0; s < 3; ++s) {
+      std::vector<double> exact = power_iteration(g, s);
+      push(s, estimates, 0.85, 1e-6);
+      std::pair<double, double> e = errors(g, estimates, exact, 1e-6);
+      BOOST_TEST(e.second <= 1e-6 * num_edges(g));
+    }
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,268 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that dijkstra_shortest_paths and breadth_first_search give the
+// same results with a search_workspace as without one, over many searches
+// with the same workspace, with integer and fractional weights, that a
+// short search on a large graph only initializes the vertices it reaches,
+// and compares the running times of short searches.
+// Usage: search_workspace_test [grid side [queries]]
+
+#include <boost/graph/search_workspace.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <iostream>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS, no_property, unsigned> Graph;
+typedef graph_traits<Graph>::vertex_descriptor Vertex;
+typedef std::pair<std::size_t, std::size_t> Edge;
+typedef search_workspace<Graph, unsigned> Workspace;
+
+struct search_done {};
+
+// Stops a search after it has examined limit vertices
+struct stop_after
+{
+  typedef on_examine_vertex event_filter;
+  explicit stop_after(std::size_t limit) : limit(limit) {}
+  void operator()(Vertex, const Graph&)
+  { if (limit-- == 0) throw search_done(); }
+  std::size_t limit;
+};
+
+Graph make_graph(std::vector<Edge>& edges, std::size_t n, minstd_rand& gen)
+{
+  uniform_int<unsigned> random_weight(1, 100);
+  std::vector<unsigned> weights(edges.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+    weights[i] = random_weight(gen);
+  return Graph(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+               weights.begin(), n);
+}
+
+// Complete searches from many sources with one workspace
+void check_results(minstd_rand& gen)
+{
+  const std::size_t n = 2000;
+  typedef erdos_renyi_iterator<minstd_rand, Graph> ERIter;
+  std::vector<Edge> edges(ERIter(gen, n, 2.0 / n), ERIter());
+  Graph g = make_graph(edges, n, gen);
+  Workspace workspace(g);
+  std::vector<unsigned> distance(n), hops(n);
+  uniform_int<std::size_t> random_vertex(0, n - 1);
+
+  for (int q = 0; q < 50; ++q) {
+    Vertex s = Vertex(random_vertex(gen));
+    dijkstra_shortest_paths
+      (g, s, weight_map(get(edge_bundle, g))
+               .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g))));
+    dijkstra_shortest_paths(g, s, weight_map(get(edge_bundle, g)).workspace(workspace));
+    Workspace::distance_map_type ws_distance = workspace.distance_map();
+    Workspace::predecessor_map_type ws_predecessor = workspace.predecessor_map();
+    for (Vertex v = 0; v < n; ++v) {
+      BOOST_TEST(get(ws_distance, v) == distance[v]);
+      BOOST_TEST(workspace.touched(v) == (distance[v] != Workspace::distance_type(-1)));
+      Vertex p = get(ws_predecessor, v);
+      if (p == v) {
+        BOOST_TEST(v == s || distance[v] == Workspace::distance_type(-1));
+        continue;
+      }
+      bool tight = false;
+      graph_traits<Graph>::out_edge_iterator ei, ei_end;
+      for (boost::tie(ei, ei_end) = out_edges(p, g); ei != ei_end; ++ei)
+        if (target(*ei, g) == v && distance[p] + g[*ei] == distance[v])
+          tight = true;
+      BOOST_TEST(tight);
+    }
+
+    // Hop counts
+    std::fill(hops.begin(), hops.end(), Workspace::distance_type(-1));
+    hops[s] = 0;
+    breadth_first_search
+      (g, s, visitor(make_bfs_visitor(record_distances(&hops[0], on_tree_edge()))));
+    breadth_first_search
+      (g, s, visitor(make_bfs_visitor(record_distances(ws_distance, on_tree_edge())))
+               .workspace(workspace));
+    for (Vertex v = 0; v < n; ++v)
+      BOOST_TEST(get(ws_distance, v) == hops[v]);
+  }
+}
+
+typedef compressed_sparse_row_graph<directedS, no_property, double>
+  RealGraph;
+typedef search_workspace<RealGraph, double> RealWorkspace;
+
+// Counts the calls to initialize_vertex
+struct count_initialized
+{
+  typedef on_initialize_vertex event_filter;
+  explicit count_initialized(std::size_t& count) : count(&count) {}
+  template <class G> void operator()(Vertex, const G&) { ++*count; }
+  std::size_t* count;
+};
+
+template <class G, class W>
+std::size_t num_touched(const G& g, const W& workspace)
+{
+  std::size_t touched = 0;
+  for (Vertex v = 0; v < num_vertices(g); ++v)
+    if (workspace.touched(v)) ++touched;
+  return touched;
+}
+
+// Fractional weights, and a visitor of the caller's
+void check_real_weights(minstd_rand& gen)
+{
+  const std::size_t n = 500;
+  typedef erdos_renyi_iterator<minstd_rand, RealGraph> ERIter;
+  std::vector<Edge> edges(ERIter(gen, n, 2.0 / n), ERIter());
+  uniform_int<unsigned> random_weight(1, 100);
+  std::vector<double> weights(edges.size());
+  for (std::size_t i = 0; i < weights.size(); ++i)
+    weights[i] = random_weight(gen) / 16.0;
+  RealGraph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+              weights.begin(), n);
+  RealWorkspace workspace(g);
+  std::vector<double> distance(n);
+  uniform_int<std::size_t> random_vertex(0, n - 1);
+
+  for (int q = 0; q < 20; ++q) {
+    Vertex s = Vertex(random_vertex(gen));
+    dijkstra_shortest_paths
+      (g, s, weight_map(get(edge_bundle, g))
+               .distance_map(make_iterator_property_map(distance.begin(), get(vertex_index, g))));
+    std::size_t initialized = 0;
+    dijkstra_shortest_paths
+      (g, s, weight_map(get(edge_bundle, g))
+               .visitor(make_dijkstra_visitor(count_initialized(initialized)))
+               .workspace(workspace));
+    // initialize_vertex fires once for each vertex reached
+    BOOST_TEST_EQ(initialized, num_touched(g, workspace));
+    RealWorkspace::distance_map_type ws_distance = workspace.distance_map();
+    RealWorkspace::predecessor_map_type ws_predecessor =
+      workspace.predecessor_map();
+    for (Vertex v = 0; v < n; ++v) {
+      BOOST_TEST_EQ(get(ws_distance, v), distance[v]);
+      // The unreached vertices are their own predecessors
+      Vertex p = get(ws_predecessor, v);
+      if (distance[v] == (std::numeric_limits<double>::max)())
+        BOOST_TEST_EQ(p, v);
+      else if (v != s)
+        BOOST_TEST(distance[p] < distance[v]);
+    }
+
+    initialized = 0;
+    breadth_first_search
+      (g, s, visitor(make_bfs_visitor(count_initialized(initialized)))
+               .workspace(workspace));
+    BOOST_TEST_EQ(initialized, num_touched(g, workspace));
+  }
+}
+
+// Searches that stop after a few hundred vertices, on a large grid
+void compare_times(std::size_t side, std::size_t num_queries, minstd_rand& gen)
+{
+  std::vector<Edge> edges;
+  for (std::size_t i = 0; i < side; ++i)
+    for (std::size_t j = 0; j < side; ++j) {
+      std::size_t v = i * side + j;
+      if (j + 1 < side) {
+        edges.push_back(Edge(v, v + 1));
+        edges.push_back(Edge(v + 1, v));
+      }
+      if (i + 1 < side) {
+        edges.push_back(Edge(v, v + side));
+        edges.push_back(Edge(v + side, v));
+      }
+    }
+  Graph g = make_graph(edges, side * side, gen);
+  Workspace workspace(g);
+  uniform_int<std::size_t> random_vertex(0, side * side - 1);
+  const std::size_t settled = 300;
+  double times[4] = {0, 0, 0, 0};
+  timer timer;
+
+  for (std::size_t q = 0; q < num_queries; ++q) {
+    Vertex s = Vertex(random_vertex(gen));
+    timer.restart();
+    try {
+      dijkstra_shortest_paths(g, s, weight_map(get(edge_bundle, g))
+                                      .visitor(make_dijkstra_visitor(stop_after(settled))));
+    } catch (const search_done&) {}
+    times[0] += timer.elapsed();
+    timer.restart();
+    try {
+      dijkstra_shortest_paths(g, s, weight_map(get(edge_bundle, g))
+                                      .visitor(make_dijkstra_visitor(stop_after(settled)))
+                                      .workspace(workspace));
+    } catch (const search_done&) {}
+    times[1] += timer.elapsed();
+
+    timer.restart();
+    try {
+      breadth_first_search(g, s, visitor(make_bfs_visitor(stop_after(settled))));
+    } catch (const search_done&) {}
+    times[2] += timer.elapsed();
+    timer.restart();
+    try {
+      breadth_first_search(g, s, visitor(make_bfs_visitor(stop_after(settled)))
+                                   .workspace(workspace));
+    } catch (const search_done&) {}
+    times[3] += timer.elapsed();
+  }
+  // A short search with a visitor initializes only the vertices it gets
+  // to, a few for each vertex examined
+  Vertex s = Vertex(random_vertex(gen));
+  std::size_t initialized = 0;
+  try {
+    dijkstra_shortest_paths(g, s, weight_map(get(edge_bundle, g))
+                                    .visitor(make_dijkstra_visitor
+                                               (std::make_pair(count_initialized(initialized),
+                                                               stop_after(settled))))
+                                    .workspace(workspace));
+  } catch (const search_done&) {}
+  BOOST_TEST_EQ(initialized, num_touched(g, workspace));
+  BOOST_TEST(initialized <= 4 * (settled + 1) + 1);
+  initialized = 0;
+  try {
+    breadth_first_search(g, s, visitor(make_bfs_visitor
+                                         (std::make_pair(count_initialized(initialized),
+                                                         stop_after(settled))))
+                                 .workspace(workspace));
+  } catch (const search_done&) {}
+  BOOST_TEST_EQ(initialized, num_touched(g, workspace));
+  BOOST_TEST(initialized <= 4 * (settled + 1) + 1);
+
+  std::cout << num_queries << " searches stopping after " << settled
+            << " of " << side * side << " vertices:\n"
+            << "  Dijkstra " << times[0] << " s, with a workspace "
+            << times[1] << " s\n"
+            << "  breadth-first search " << times[2]
+            << " s, with a workspace " << times[3] << " s\n";
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t side = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 1000;
+  std::size_t num_queries = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 100;
+  minstd_rand gen(1);
+  check_results(gen);
+  check_real_weights(gen);
+  compare_times(side, num_queries, gen);
+  return boost::report_errors();
+}
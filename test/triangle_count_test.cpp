@@ -0,0 +1,166 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the intersection kernels of count_triangles against
+// std::set_intersection, then checks the triangle counts and clustering
+// coefficients of count_triangles against num_triangles_on_vertex and
+// all_clustering_coefficients on a small graph with self-loops and parallel
+// edges and on a skewed R-MAT graph, stored both as an undirected
+// adjacency_list and as a directed compressed_sparse_row_graph with one
+// arc per edge, and compares their times.
+// Usage: triangle_count_test [R-MAT scale]
+
+#include <boost/graph/triangle_count.hpp>
+#include <boost/graph/clustering_coefficient.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <set>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+
+using namespace boost;
+
+typedef adjacency_list<setS, vecS, undirectedS> UGraph;
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+struct collect
+{
+  std::vector<std::size_t>* out;
+  void operator()(std::size_t x) const { out->push_back(x); }
+};
+
+void check_intersections(minstd_rand& gen)
+{
+  std::size_t sizes[] = {0, 1, 5, 40, 300, 5000};
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 6; ++j) {
+      std::set<std::size_t> sa, sb;
+      while (sa.size() < sizes[i]) sa.insert(gen() % 10000);
+      while (sb.size() < sizes[j]) sb.insert(gen() % 10000);
+      std::vector<std::size_t> a(sa.begin(), sa.end()), b(sb.begin(), sb.end());
+      std::vector<std::size_t> expected, found;
+      std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                            std::back_inserter(expected));
+      collect f = {&found};
+      const std::size_t* pa = a.empty() ? 0 : &a[0];
+      const std::size_t* pb = b.empty() ? 0 : &b[0];
+      std::size_t count = detail::sorted_intersect(pa, pa + a.size(),
+                                                   pb, pb + b.size(), f);
+      BOOST_TEST_EQ(count, expected.size());
+      BOOST_TEST(found == expected);
+      found.clear();
+      detail::gallop_intersect(pa, pa + a.size(), pb, pb + b.size(), f);
+      BOOST_TEST(found == expected);
+    }
+}
+
+// Compares count_triangles on g and on the simple undirected graph ug with
+// the same edges against the functions of clustering_coefficient.hpp on ug
+void check(const Graph& g, const UGraph& ug, bool report)
+{
+  std::size_t n = num_vertices(ug);
+  timer timer;
+  std::vector<double> expected_cc(n);
+  double expected_mean = all_clustering_coefficients
+    (ug, make_iterator_property_map(expected_cc.begin(), get(vertex_index, ug)));
+  std::vector<std::size_t> expected_tri(n);
+  boost::uintmax_t expected_triangles = 0, expected_triples = 0;
+  for (std::size_t v = 0; v < n; ++v) {
+    expected_tri[v] = num_triangles_on_vertex(ug, v);
+    expected_triangles += expected_tri[v];
+    expected_triples += num_paths_through_vertex(ug, v);
+  }
+  expected_triangles /= 3;
+  double reference = timer.elapsed();
+
+  std::vector<std::size_t> tri(n);
+  std::vector<double> cc(n);
+  timer.restart();
+  triangle_totals totals = count_triangles
+    (g, make_iterator_property_map(tri.begin(), get(vertex_index, g)),
+     make_iterator_property_map(cc.begin(), get(vertex_index, g)));
+  double time = timer.elapsed();
+  if (report)
+    std::cout << "  " << totals.triangles << " triangles, transitivity "
+              << totals.transitivity << ", mean clustering "
+              << totals.mean_clustering << "\n  clustering_coefficient.hpp: "
+              << reference << " s, count_triangles: " << time << " s\n";
+
+  BOOST_TEST_EQ(totals.triangles, expected_triangles);
+  BOOST_TEST_EQ(totals.triples, expected_triples);
+  BOOST_TEST(tri == expected_tri);
+  BOOST_TEST(std::abs(totals.mean_clustering - expected_mean) < 1e-9);
+  BOOST_TEST(std::abs(totals.transitivity - (expected_triples == 0 ? 0.0
+                      : 3.0 * expected_triangles / expected_triples)) < 1e-12);
+  for (std::size_t v = 0; v < n; ++v)
+    BOOST_TEST(std::abs(cc[v] - expected_cc[v]) < 1e-12);
+
+  // The undirected graph gives the same counts
+  std::vector<std::size_t> utri(n);
+  triangle_totals utotals = count_triangles
+    (ug, make_iterator_property_map(utri.begin(), get(vertex_index, ug)));
+  BOOST_TEST_EQ(utotals.triangles, expected_triangles);
+  BOOST_TEST(utri == expected_tri);
+}
+
+void check_edges(const std::vector<Edge>& edges, std::size_t n, bool report)
+{
+  Graph g(edges_are_unsorted, edges.begin(), edges.end(), n);
+  UGraph ug(n);
+  for (std::size_t i = 0; i < edges.size(); ++i)
+    if (edges[i].first != edges[i].second)
+      add_edge(edges[i].first, edges[i].second, ug);
+  if (report)
+    std::cout << "R-MAT graph: " << n << " vertices, " << num_edges(ug)
+              << " edges\n";
+  check(g, ug, report);
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t scale = argc > 1 ? lexical_cast<std::size_t>(argv[1]) : 12;
+  minstd_rand gen(1);
+  check_intersections(gen);
+
+  // Two triangles sharing the edge (1, 2), a pendant vertex, an isolated
+  // vertex, a self-loop, and arcs in both directions or repeated
+  {
+    Edge edges[] = {Edge(0, 1), Edge(1, 2), Edge(2, 0), Edge(3, 1),
+                    Edge(2, 3), Edge(1, 0), Edge(3, 2), Edge(4, 3),
+                    Edge(3, 3), Edge(2, 3)};
+    std::vector<Edge> e(edges, edges + 10);
+    check_edges(e, 6, false);
+    Graph g(edges_are_unsorted, e.begin(), e.end(), 6);
+    std::vector<std::size_t> tri(6);
+    triangle_totals totals = count_triangles
+      (g, make_iterator_property_map(tri.begin(), get(vertex_index, g)));
+    BOOST_TEST_EQ(totals.triangles, 2u);
+    BOOST_TEST_EQ(tri[1], 2u);
+    BOOST_TEST_EQ(tri[4], 0u);
+    BOOST_TEST_EQ(count_triangles(g).triangles, 2u);
+  }
+
+  // A skewed R-MAT graph
+  {
+    std::size_t n = std::size_t(1) << scale;
+    typedef rmat_iterator<minstd_rand, Graph> RMATIter;
+    std::vector<Edge> edges(RMATIter(gen, n, 8 * n, 0.57, 0.19, 0.19, 0.05),
+                            RMATIter());
+    check_edges(edges, n, true);
+  }
+
+  return boost::report_errors();
+}
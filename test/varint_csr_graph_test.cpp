@@ -0,0 +1,162 @@
+// Copyright 2026 The Trustees of Indiana University.
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that varint_csr_graph holds the same graph as the
+// compressed_sparse_row_graph it is built from, and compares their memory use
+// (bytes per edge) and traversal speed with breadth_first_search and
+// page_rank.  Usage: varint_csr_graph_test [scale [edge factor]]
+
+#include <boost/graph/varint_csr_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/small_world_generator.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+using namespace boost;
+
+typedef compressed_sparse_row_graph<directedS> Graph;
+typedef varint_csr_graph<> CompressedGraph;
+typedef std::pair<std::size_t, std::size_t> Edge;
+
+template <typename G>
+std::vector<std::size_t> bfs_levels(const G& g, std::size_t s)
+{
+  std::vector<std::size_t> levels(num_vertices(g), 0);
+  breadth_first_search(g, vertex(s, g), visitor(make_bfs_visitor(
+    record_distances(make_iterator_property_map(levels.begin(),
+                                                get(vertex_index, g)),
+                     on_tree_edge()))));
+  return levels;
+}
+
+template <typename G>
+std::vector<double> ranks(const G& g)
+{
+  std::vector<double> r(num_vertices(g));
+  graph::page_rank(g, make_iterator_property_map(r.begin(),
+                                                 get(vertex_index, g)));
+  return r;
+}
+
+// Time BFS from a few sources and 20 page_rank iterations on g, and report
+// the throughput in edges per second
+template <typename G>
+void benchmark(const G& g, const char* name, std::size_t bytes)
+{
+  const int num_sources = 4;
+  std::size_t m = num_edges(g);
+  timer t;
+  for (int s = 0; s < num_sources; ++s)
+    bfs_levels(g, std::size_t(s) * num_vertices(g) / num_sources);
+  double bfs_time = t.elapsed();
+  t.restart();
+  ranks(g);
+  double pr_time = t.elapsed();
+  std::cout << "  " << name << ": " << double(bytes) / m << " bytes/edge, "
+            << "BFS " << num_sources * m / (bfs_time > 0 ? bfs_time : 1e-9) / 1e6
+            << " Medges/s, page_rank " << 20 * m / (pr_time > 0 ? pr_time : 1e-9) / 1e6
+            << " Medges/s\n";
+}
+
+void test_graph(const std::vector<Edge>& edge_list, std::size_t n,
+                const char* name)
+{
+  Graph g(edges_are_unsorted_multi_pass, edge_list.begin(), edge_list.end(),
+          n);
+  CompressedGraph cg(g);
+  BOOST_TEST(num_vertices(cg) == n);
+  BOOST_TEST(num_edges(cg) == num_edges(g));
+
+  // Same adjacency lists, in sorted order
+  std::size_t index = 0;
+  for (std::size_t v = 0; v < n; ++v) {
+    std::vector<std::size_t> expected(adjacent_vertices(v, g).first,
+                                      adjacent_vertices(v, g).second);
+    std::sort(expected.begin(), expected.end());
+    BOOST_TEST(out_degree(v, cg) == expected.size());
+    std::vector<std::size_t> actual(adjacent_vertices(v, cg).first,
+                                    adjacent_vertices(v, cg).second);
+    BOOST_TEST(actual == expected);
+    graph_traits<CompressedGraph>::out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = out_edges(v, cg); ei != ei_end; ++ei) {
+      BOOST_TEST(source(*ei, cg) == v);
+      BOOST_TEST(get(edge_index, cg, *ei) == index++);
+    }
+    if (!expected.empty()) {
+      BOOST_TEST(edge(v, expected.back(), cg).second);
+      BOOST_TEST(target(edge(v, expected.back(), cg).first, cg)
+                 == expected.back());
+    }
+  }
+  BOOST_TEST(index == num_edges(g));
+
+  // Same results from the algorithms
+  BOOST_TEST(bfs_levels(g, 0) == bfs_levels(cg, 0));
+  std::vector<double> r1 = ranks(g), r2 = ranks(cg);
+  for (std::size_t v = 0; v < n; ++v)
+    BOOST_TEST(std::abs(r1[v] - r2[v]) <= 1e-9 * (std::abs(r1[v]) + 1));
+
+  std::cout << name << " graph, " << n << " vertices, " << num_edges(g)
+            << " edges:\n";
+  benchmark(g, "compressed_sparse_row_graph",
+            g.m_forward.m_rowstart.size() * sizeof(std::size_t)
+            + g.m_forward.m_column.size() * sizeof(std::size_t));
+  benchmark(cg, "varint_csr_graph", cg.encoded_size());
+}
+
+int main(int argc, char* argv[])
+{
+  BOOST_CONCEPT_ASSERT((IncidenceGraphConcept<CompressedGraph>));
+  BOOST_CONCEPT_ASSERT((AdjacencyGraphConcept<CompressedGraph>));
+  BOOST_CONCEPT_ASSERT((VertexListGraphConcept<CompressedGraph>));
+
+  int scale = argc > 1 ? lexical_cast<int>(argv[1]) : 16;
+  std::size_t edge_factor = argc > 2 ? lexical_cast<std::size_t>(argv[2]) : 16;
+  std::size_t n = std::size_t(1) << scale;
+  minstd_rand gen(1);
+
+  // Scale-free graph with random vertex numbering
+  std::vector<Edge> edge_list(rmat_iterator<minstd_rand, Graph>(gen, n, edge_factor * n, 0.57, 0.19, 0.19, 0.05),
+                              rmat_iterator<minstd_rand, Graph>());
+  test_graph(edge_list, n, "R-MAT");
+
+  // Graph with locality: neighbors have nearby indices
+  typedef small_world_iterator<minstd_rand, Graph> SWGen;
+  edge_list.assign(SWGen(gen, n, edge_factor, 0.05), SWGen());
+  test_graph(edge_list, n, "Small-world");
+
+  // Degenerate graphs
+  CompressedGraph empty;
+  BOOST_TEST(num_vertices(empty) == 0);
+  BOOST_TEST(num_edges(empty) == 0);
+  typedef graph_traits<CompressedGraph>::vertex_descriptor Vertex;
+  CompressedGraph isolated(5);
+  BOOST_TEST(out_degree(Vertex(4), isolated) == 0);
+  BOOST_TEST(adjacent_vertices(Vertex(4), isolated).first
+             == adjacent_vertices(Vertex(4), isolated).second);
+  Edge few[] = {Edge(0, 3), Edge(0, 1), Edge(0, 3), Edge(2, 0)};
+  CompressedGraph small(edges_are_unsorted_multi_pass, few, few + 4, 4);
+  std::vector<std::size_t> adj(adjacent_vertices(Vertex(0), small).first,
+                               adjacent_vertices(Vertex(0), small).second);
+  BOOST_TEST(adj.size() == 3 && adj[0] == 1 && adj[1] == 3 && adj[2] == 3);
+  BOOST_TEST(target(*out_edges(Vertex(2), small).first, small) == 0);
+  BOOST_TEST(!edge(Vertex(0), Vertex(2), small).second);
+  BOOST_TEST(edge(Vertex(2), Vertex(0), small).second);
+
+  return boost::report_errors();
+}